@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <memory>
 #include <sstream>
 #include <stdlib.h>
 #include <string.h>
@@ -32,6 +33,8 @@ std::string params_to_string (struct BrainFlowInputParams params)
     j["file_aux"] = params.file_aux;
     j["file_anc"] = params.file_anc;
     j["master_board"] = params.master_board;
+    j["buffer_storage"] = params.buffer_storage;
+    j["package_num_check"] = params.package_num_check;
     std::string post_str = j.dump ();
     return post_str;
 }
@@ -106,21 +109,122 @@ BoardShim::BoardShim (int board_id, struct BrainFlowInputParams params)
     serialized_params = params_to_string (params);
     this->params = params;
     this->board_id = board_id;
+    session_handle = -1;
+}
+
+int BoardShim::get_session_handle ()
+{
+    // session may be prepared by another BoardShim object with the same params, resolve lazily
+    if (session_handle < 0)
+    {
+        int handle = -1;
+        if (::get_session_handle (&handle, board_id, serialized_params.c_str ()) ==
+            (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            session_handle = handle;
+        }
+    }
+    return session_handle;
+}
+
+int BoardShim::call_by_handle (std::function<int (int)> func)
+{
+    int old_handle = get_session_handle ();
+    int res = func (old_handle);
+    // cached handle is stale if session was released and prepared again elsewhere, retry once
+    if ((res == (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR) && (old_handle >= 0))
+    {
+        session_handle = -1;
+        int new_handle = get_session_handle ();
+        if ((new_handle >= 0) && (new_handle != old_handle))
+        {
+            res = func (new_handle);
+        }
+    }
+    return res;
+}
+
+int BoardShim::get_preset_num_rows (int preset)
+{
+    // session may be prepared by another BoardShim object, fill cache lazily as well
+    auto it = preset_num_rows.find (preset);
+    if (it != preset_num_rows.end ())
+    {
+        return it->second;
+    }
+    int num_rows = get_num_rows (get_board_id (), preset);
+    preset_num_rows[preset] = num_rows;
+    return num_rows;
+}
+
+void BoardShim::cache_preset_num_rows ()
+{
+    preset_num_rows.clear ();
+    int master_board_id = get_board_id ();
+    int presets[3] = {0};
+    int len = 0;
+    if (::get_board_presets (master_board_id, presets, &len) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return;
+    }
+    for (int i = 0; i < len; i++)
+    {
+        int num_rows = 0;
+        if (::get_num_rows (master_board_id, presets[i], &num_rows) ==
+            (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            preset_num_rows[presets[i]] = num_rows;
+        }
+    }
 }
 
 void BoardShim::prepare_session ()
 {
-    int res = ::prepare_session (board_id, serialized_params.c_str ());
+    int handle = -1;
+    int res = ::prepare_session_with_handle (board_id, serialized_params.c_str (), &handle);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        session_handle = handle;
+    }
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to prepare session", res);
     }
+    cache_preset_num_rows ();
+}
+
+void BoardShim::register_data_callback (
+    brainflow_data_callback callback, void *user_data, int batch_size, int preset)
+{
+    int res = call_by_handle ([&] (int handle) {
+        return ::register_data_callback_by_handle (
+            callback, user_data, batch_size, preset, handle);
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to register data callback", res);
+    }
+}
+
+void BoardShim::unregister_data_callback (int preset)
+{
+    int res = call_by_handle (
+        [&] (int handle) { return ::unregister_data_callback_by_handle (preset, handle); });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to unregister data callback", res);
+    }
 }
 
 bool BoardShim::is_prepared ()
 {
     int prepared = 0;
-    int res = ::is_prepared (&prepared, board_id, serialized_params.c_str ());
+    int res = ::is_prepared_by_handle (&prepared, get_session_handle ());
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (!prepared) && (session_handle >= 0))
+    {
+        session_handle = -1; // released elsewhere, may be prepared again with the same params
+        res = ::is_prepared_by_handle (&prepared, get_session_handle ());
+    }
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to check session", res);
@@ -130,8 +234,9 @@ bool BoardShim::is_prepared ()
 
 void BoardShim::add_streamer (std::string streamer_params, int preset)
 {
-    int res =
-        ::add_streamer (streamer_params.c_str (), preset, board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) {
+        return ::add_streamer_by_handle (streamer_params.c_str (), preset, handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to add streamer", res);
@@ -140,8 +245,9 @@ void BoardShim::add_streamer (std::string streamer_params, int preset)
 
 void BoardShim::delete_streamer (std::string streamer_params, int preset)
 {
-    int res =
-        ::delete_streamer (streamer_params.c_str (), preset, board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) {
+        return ::delete_streamer_by_handle (streamer_params.c_str (), preset, handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to delete streamer", res);
@@ -150,8 +256,9 @@ void BoardShim::delete_streamer (std::string streamer_params, int preset)
 
 void BoardShim::start_stream (int buffer_size, std::string streamer_params)
 {
-    int res = ::start_stream (
-        buffer_size, streamer_params.c_str (), board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) {
+        return ::start_stream_by_handle (buffer_size, streamer_params.c_str (), handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to start stream", res);
@@ -160,7 +267,7 @@ void BoardShim::start_stream (int buffer_size, std::string streamer_params)
 
 void BoardShim::stop_stream ()
 {
-    int res = ::stop_stream (board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) { return ::stop_stream_by_handle (handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to stop stream", res);
@@ -169,7 +276,8 @@ void BoardShim::stop_stream ()
 
 void BoardShim::release_session ()
 {
-    int res = ::release_session (board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) { return ::release_session_by_handle (handle); });
+    session_handle = -1;
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to release session", res);
@@ -179,7 +287,9 @@ void BoardShim::release_session ()
 int BoardShim::get_board_data_count (int preset)
 {
     int data_count = 0;
-    int res = ::get_board_data_count (preset, &data_count, board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) {
+        return ::get_board_data_count_by_handle (preset, &data_count, handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to get board data count", res);
@@ -187,9 +297,24 @@ int BoardShim::get_board_data_count (int preset)
     return data_count;
 }
 
+int BoardShim::wait_for_board_data (int min_samples, int timeout_ms, int preset)
+{
+    int data_count = 0;
+    int res = call_by_handle ([&] (int handle) {
+        return ::wait_for_board_data_by_handle (
+            preset, min_samples, timeout_ms, &data_count, handle);
+    });
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) &&
+        (res != (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR))
+    {
+        throw BrainFlowException ("failed to wait for board data", res);
+    }
+    return data_count;
+}
+
 BrainFlowArray<double, 2> BoardShim::get_board_data (int preset)
 {
-    return get_board_data (get_board_data_count (preset), preset);
+    return read_board_data (get_board_data_count (preset), preset);
 }
 
 BrainFlowArray<double, 2> BoardShim::get_board_data (int num_datapoints, int preset)
@@ -199,43 +324,48 @@ BrainFlowArray<double, 2> BoardShim::get_board_data (int num_datapoints, int pre
         throw BrainFlowException (
             "invalid num_datapoints", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
     }
-    int num_samples = std::min (get_board_data_count (preset), num_datapoints);
-    int num_data_channels = get_num_rows (get_board_id (), preset);
-    double *buf = new double[num_samples * num_data_channels];
-    int res = ::get_board_data (num_samples, preset, buf, board_id, serialized_params.c_str ());
+    return read_board_data (std::min (get_board_data_count (preset), num_datapoints), preset);
+}
+
+BrainFlowArray<double, 2> BoardShim::read_board_data (int num_samples, int preset)
+{
+    int num_data_channels = get_preset_num_rows (preset);
+    // board controller writes directly into memory of returned array
+    std::unique_ptr<double[]> buf (new double[num_samples * num_data_channels]);
+    int res = call_by_handle ([&] (int handle) {
+        return ::get_board_data_by_handle (num_samples, preset, buf.get (), handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        delete[] buf;
         throw BrainFlowException ("failed to get board data", res);
     }
-    BrainFlowArray<double, 2> matrix (buf, num_data_channels, num_samples);
-    delete[] buf;
-    return matrix;
+    return BrainFlowArray<double, 2> (std::move (buf), num_data_channels, num_samples);
 }
 
 BrainFlowArray<double, 2> BoardShim::get_current_board_data (int num_samples, int preset)
 {
-    int num_data_channels = BoardShim::get_num_rows (get_board_id (), preset);
-    double *buf = new double[num_samples * num_data_channels];
+    int num_data_channels = get_preset_num_rows (preset);
+    std::unique_ptr<double[]> buf (new double[num_samples * num_data_channels]);
     int len = 0;
-    int res = ::get_current_board_data (
-        num_samples, preset, buf, &len, board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) {
+        return ::get_current_board_data_by_handle (
+            num_samples, preset, buf.get (), &len, handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        delete[] buf;
         throw BrainFlowException ("failed to get board data", res);
     }
-    BrainFlowArray<double, 2> matrix (buf, num_data_channels, len);
-    delete[] buf;
-    return matrix;
+    // rows are packed with len elements each, unused tail of the buffer is ignored
+    return BrainFlowArray<double, 2> (std::move (buf), num_data_channels, len);
 }
 
 std::string BoardShim::config_board (std::string config)
 {
     int response_len = 0;
     char response[8192];
-    int res = ::config_board (
-        config.c_str (), response, &response_len, board_id, serialized_params.c_str ());
+    int res = call_by_handle ([&] (int handle) {
+        return ::config_board_by_handle (config.c_str (), response, &response_len, handle);
+    });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to config board", res);
@@ -246,7 +376,8 @@ std::string BoardShim::config_board (std::string config)
 
 void BoardShim::config_board_with_bytes (const char *bytes, int len)
 {
-    int res = ::config_board_with_bytes (bytes, len, board_id, serialized_params.c_str ());
+    int res = call_by_handle (
+        [&] (int handle) { return ::config_board_with_bytes_by_handle (bytes, len, handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to config board with bytes", res);
@@ -255,18 +386,103 @@ void BoardShim::config_board_with_bytes (const char *bytes, int len)
 
 void BoardShim::insert_marker (double value, int preset)
 {
-    int res = ::insert_marker (value, preset, board_id, serialized_params.c_str ());
+    int res = call_by_handle (
+        [&] (int handle) { return ::insert_marker_by_handle (value, preset, handle); });
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         throw BrainFlowException ("failed to insert marker", res);
     }
 }
 
+void BoardShim::register_reader (std::string reader_name, int preset)
+{
+    int res = call_by_handle ([&] (int handle) {
+        return ::register_reader_by_handle (reader_name.c_str (), preset, handle);
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to register reader", res);
+    }
+}
+
+void BoardShim::unregister_reader (std::string reader_name, int preset)
+{
+    int res = call_by_handle ([&] (int handle) {
+        return ::unregister_reader_by_handle (reader_name.c_str (), preset, handle);
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to unregister reader", res);
+    }
+}
+
+void BoardShim::get_reader_stats (std::string reader_name, int *lag, int *overflow, int preset)
+{
+    int res = call_by_handle ([&] (int handle) {
+        return ::get_reader_stats_by_handle (
+            reader_name.c_str (), preset, lag, overflow, handle);
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get reader stats", res);
+    }
+}
+
+json BoardShim::get_board_metrics (int preset)
+{
+    char metrics_str[16000];
+    int string_len = 0;
+    int res = call_by_handle ([&] (int handle) {
+        return ::get_board_metrics_by_handle (preset, metrics_str, &string_len, handle);
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to get board metrics", res);
+    }
+    std::string data (metrics_str, 0, string_len);
+    return json::parse (data);
+}
+
+BrainFlowArray<double, 2> BoardShim::read_since_cursor (std::string reader_name, int preset)
+{
+    int lag = 0;
+    int overflow = 0;
+    get_reader_stats (reader_name, &lag, &overflow, preset);
+    return read_since_cursor (reader_name, lag, preset);
+}
+
+BrainFlowArray<double, 2> BoardShim::read_since_cursor (
+    std::string reader_name, int num_datapoints, int preset)
+{
+    if (num_datapoints < 0)
+    {
+        throw BrainFlowException (
+            "invalid num_datapoints", (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    }
+    int lag = 0;
+    int overflow = 0;
+    get_reader_stats (reader_name, &lag, &overflow, preset);
+    int num_samples = std::min (lag, num_datapoints);
+    int num_data_channels = get_preset_num_rows (preset);
+    std::unique_ptr<double[]> buf (new double[num_samples * num_data_channels]);
+    int len = 0;
+    int res = call_by_handle ([&] (int handle) {
+        return ::read_since_cursor_by_handle (
+            reader_name.c_str (), num_samples, preset, buf.get (), &len, handle);
+    });
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to read since cursor", res);
+    }
+    return BrainFlowArray<double, 2> (std::move (buf), num_data_channels, len);
+}
+
 int BoardShim::get_board_id ()
 {
     int master_board_id = board_id;
     if ((board_id == (int)BoardIds::STREAMING_BOARD) ||
-        (board_id == (int)BoardIds::PLAYBACK_FILE_BOARD))
+        (board_id == (int)BoardIds::PLAYBACK_FILE_BOARD) ||
+        (board_id == (int)BoardIds::SHARED_MEMORY_BOARD))
     {
         if (params.master_board == (int)BoardIds::NO_BOARD)
         {
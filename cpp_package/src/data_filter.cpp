@@ -441,6 +441,28 @@ BrainFlowArray<double, 2> DataFilter::read_file (std::string file_name)
     return data;
 }
 
+BrainFlowArray<double, 2> DataFilter::read_file_range (
+    std::string prefix, double start_time, double end_time)
+{
+    int max_elements = 0;
+    int res =
+        get_num_elements_in_file_range (prefix.c_str (), start_time, end_time, &max_elements);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to determine number of samples in range", res);
+    }
+    std::unique_ptr<double[]> data_linear (new double[max_elements]);
+    int num_rows = 0;
+    int num_cols = 0;
+    res = ::read_file_range (data_linear.get (), &num_rows, &num_cols, prefix.c_str (),
+        start_time, end_time, max_elements);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        throw BrainFlowException ("failed to read file range", res);
+    }
+    return BrainFlowArray<double, 2> (std::move (data_linear), num_rows, num_cols);
+}
+
 void DataFilter::write_file (
     const BrainFlowArray<double, 2> &data, std::string file_name, std::string file_mode)
 {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdarg>
+#include <functional>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -21,6 +23,15 @@ class BoardShim
 {
     std::string serialized_params;
     struct BrainFlowInputParams params;
+    int session_handle; // -1 until session is prepared or found in board controller
+    // board description is static, rows per preset are cached to avoid lookups for each read
+    std::map<int, int> preset_num_rows;
+
+    int get_session_handle ();
+    int call_by_handle (std::function<int (int)> func);
+    int get_preset_num_rows (int preset);
+    void cache_preset_num_rows ();
+    BrainFlowArray<double, 2> read_board_data (int num_samples, int preset);
 
 public:
     /// disable BrainFlow loggers
@@ -230,8 +241,11 @@ public:
      * add streamer
      * @param streamer_params use it to pass data packages further or store them directly during
      streaming, supported values: "file://%file_name%:w", "file://%file_name%:a",
-     "streaming_board://%multicast_group_ip%:%port%"". Range for multicast addresses is from
-     "224.0.0.0" to "239.255.255.255"
+     "binary_file://%file_name%:w", "binary_file://%file_name%:a",
+     "compressed_file://%file_name%:w", "compressed_file://%file_name%:a",
+     "segmented_file://%prefix%:size_mb=%size%,duration=%seconds%",
+     "streaming_board://%multicast_group_ip%:%port%", "shm://%name%:seconds=%seconds%". Range
+     for multicast addresses is from "224.0.0.0" to "239.255.255.255"
      */
     void add_streamer (
         std::string streamer_params, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
@@ -239,11 +253,24 @@ public:
      * delete streamer
      * @param streamer_params use it to pass data packages further or store them directly during
      streaming, supported values: "file://%file_name%:w", "file://%file_name%:a",
-     "streaming_board://%multicast_group_ip%:%port%"". Range for multicast addresses is from
-     "224.0.0.0" to "239.255.255.255"
+     "binary_file://%file_name%:w", "binary_file://%file_name%:a",
+     "compressed_file://%file_name%:w", "compressed_file://%file_name%:a",
+     "segmented_file://%prefix%:size_mb=%size%,duration=%seconds%",
+     "streaming_board://%multicast_group_ip%:%port%", "shm://%name%:seconds=%seconds%". Range
+     for multicast addresses is from "224.0.0.0" to "239.255.255.255"
      */
     void delete_streamer (
         std::string streamer_params, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /**
+     * register callback which is called from a separate thread with channel major batches of data
+     * @param callback function to call, data pointer is valid only during the call
+     * @param user_data pointer passed to callback as is
+     * @param batch_size number of packages in each call, the last call may have less
+     */
+    void register_data_callback (brainflow_data_callback callback, void *user_data,
+        int batch_size = 1, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// unregister callback, the rest of data is delivered before return
+    void unregister_data_callback (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// check if session is ready or not
     bool is_prepared ();
     /// stop streaming thread, doesnt release other resources
@@ -257,6 +284,14 @@ public:
     int get_board_id ();
     /// get number of packages in ringbuffer
     int get_board_data_count (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /**
+     * block until ringbuffer has at least min_samples packages or timeout expires
+     * @param min_samples number of packages to wait for
+     * @param timeout_ms max time to wait in milliseconds
+     * @return number of packages in ringbuffer, less than min_samples if timeout expired
+     */
+    int wait_for_board_data (
+        int min_samples, int timeout_ms, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// get all collected data and flush it from internal buffer
     BrainFlowArray<double, 2> get_board_data (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     /// get required amount of datapoints or less and flush it from internal buffer
@@ -267,4 +302,28 @@ public:
     void config_board_with_bytes (const char *bytes, int len);
     /// insert marker in data stream
     void insert_marker (double value, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /**
+     * register named reader, each reader gets every package pushed after registration exactly
+     * once, independent from get_board_data and other readers
+     */
+    void register_reader (
+        std::string reader_name, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// unregister named reader
+    void unregister_reader (
+        std::string reader_name, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// get all packages which reader did not get yet, doesnt remove them from ringbuffer
+    BrainFlowArray<double, 2> read_since_cursor (
+        std::string reader_name, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// get required amount of packages or less which reader did not get yet
+    BrainFlowArray<double, 2> read_since_cursor (
+        std::string reader_name, int num_datapoints, int preset);
+    /**
+     * get reader state
+     * @param lag number of packages available for this reader
+     * @param overflow number of packages this reader lost because it was too slow
+     */
+    void get_reader_stats (std::string reader_name, int *lag, int *overflow,
+        int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    /// get counters of data loss, ring buffer usage, streamer queues and push latency
+    json get_board_metrics (int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
 };
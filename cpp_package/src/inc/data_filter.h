@@ -209,8 +209,13 @@ public:
     /// write file, in file data will be transposed
     static void write_file (
         const BrainFlowArray<double, 2> &data, std::string file_name, std::string file_mode);
-    /// read data from file, data will be transposed to original format
+    /// read data from file, data will be transposed to original format, text files and binary
+    /// recordings from binary_file and compressed_file streamers are supported
     static BrainFlowArray<double, 2> read_file (std::string file_name);
+    /// read samples with timestamps from start_time to end_time from segmented_file recording,
+    /// only blocks which overlap this range are read
+    static BrainFlowArray<double, 2> read_file_range (
+        std::string prefix, double start_time, double end_time);
     /// calc stddev
     static double calc_stddev (double *data, int start_pos, int end_pos);
     /// calc railed percentage
@@ -29,7 +29,8 @@ namespace brainflow
             this.board_id = board_id;
             this.input_params = input_params;
 
-            if ((board_id == (int)BoardIds.STREAMING_BOARD) || (board_id == (int)BoardIds.PLAYBACK_FILE_BOARD))
+            if ((board_id == (int)BoardIds.STREAMING_BOARD) || (board_id == (int)BoardIds.PLAYBACK_FILE_BOARD) ||
+                (board_id == (int)BoardIds.SHARED_MEMORY_BOARD))
             {
                 if (input_params.master_board != (int)BoardIds.NO_BOARD)
                 {
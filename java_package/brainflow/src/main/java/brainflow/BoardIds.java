@@ -9,6 +9,7 @@ import java.util.Map;
 public enum BoardIds
 {
     NO_BOARD (-100),
+    SHARED_MEMORY_BOARD (-4),
     PLAYBACK_FILE_BOARD (-3),
     STREAMING_BOARD (-2),
     SYNTHETIC_BOARD (-1),
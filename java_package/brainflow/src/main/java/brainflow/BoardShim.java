@@ -1299,6 +1299,7 @@ public class BoardShim
         this.master_board_id = board_id;
         if (
             (board_id == BoardIds.STREAMING_BOARD.get_code ()) || (board_id == BoardIds.PLAYBACK_FILE_BOARD.get_code ())
+                    || (board_id == BoardIds.SHARED_MEMORY_BOARD.get_code ())
         )
         {
             if (params.get_master_board () == BoardIds.NO_BOARD.get_code ())
@@ -1324,6 +1325,7 @@ public class BoardShim
         if (
             (board_id.get_code () == BoardIds.STREAMING_BOARD.get_code ())
                     || (board_id.get_code () == BoardIds.PLAYBACK_FILE_BOARD.get_code ())
+                    || (board_id.get_code () == BoardIds.SHARED_MEMORY_BOARD.get_code ())
         )
         {
             if (params.get_master_board () == BoardIds.NO_BOARD.get_code ())
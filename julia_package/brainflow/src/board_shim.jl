@@ -4,6 +4,7 @@ export BrainFlowInputParams
 @enum BoardIds begin
 
     NO_BOARD = -100
+    SHARED_MEMORY_BOARD = -4
     PLAYBACK_FILE_BOARD = -3
     STREAMING_BOARD = -2
     SYNTHETIC_BOARD = -1
@@ -221,7 +222,8 @@ struct BoardShim
 
     function BoardShim(id::Integer, params::BrainFlowInputParams)
         master_id = id
-        if id == Integer(STREAMING_BOARD) || id == Integer(PLAYBACK_FILE_BOARD)
+        if id == Integer(STREAMING_BOARD) || id == Integer(PLAYBACK_FILE_BOARD) ||
+                id == Integer(SHARED_MEMORY_BOARD)
             master_id = Integer(params.master_board)
         end
         new(master_id, id, JSON.json(params))
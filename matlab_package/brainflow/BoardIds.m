@@ -2,6 +2,7 @@ classdef BoardIds < int32
     % Store all supported board ids
     enumeration
         NO_BOARD(-100)
+        SHARED_MEMORY_BOARD(-4)
         PLAYBACK_FILE_BOARD(-3)
         STREAMING_BOARD(-2)
         SYNTHETIC_BOARD(-1)
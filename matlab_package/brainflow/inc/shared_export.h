@@ -0,0 +1,4 @@
+#pragma once
+
+#define SHARED_EXPORT
+#define CALLING_CONVENTION
\ No newline at end of file
@@ -14,6 +14,7 @@ export class BrainFlowError extends Error
 
 export enum BoardIds {
     NO_BOARD = -100,
+    SHARED_MEMORY_BOARD = -4,
     PLAYBACK_FILE_BOARD = -3,
     STREAMING_BOARD = -2,
     SYNTHETIC_BOARD = -1,
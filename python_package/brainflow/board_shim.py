@@ -18,6 +18,7 @@ class BoardIds(enum.IntEnum):
     """Enum to store all supported Board Ids"""
 
     NO_BOARD = -100
+    SHARED_MEMORY_BOARD = -4  #:
     PLAYBACK_FILE_BOARD = -3  #:
     STREAMING_BOARD = -2  #:
     SYNTHETIC_BOARD = -1  #:
@@ -84,6 +85,22 @@ class IpProtocolTypes(enum.IntEnum):
     TCP = 2  #:
 
 
+class BufferStorageTypes(enum.IntEnum):
+    """Enum to store types of ringbuffer storage"""
+
+    FLOAT64 = 0  #:
+    FLOAT32 = 1  #:
+    RAW_INT32 = 2  #:
+
+
+class PackageNumCheckTypes(enum.IntEnum):
+    """Enum to store modes of package num tracking"""
+
+    OFF = 0  #:
+    COUNT_GAPS = 1  #:
+    FILL_GAPS = 2  #:
+
+
 class BrainFlowPresets(enum.IntEnum):
     """Enum to store presets"""
 
@@ -123,6 +140,10 @@ class BrainFlowInputParams(object):
     :type file_aux: str
     :param file_anc: file
     :type file_anc: str
+    :param buffer_storage: how ringbuffer stores data, value from BufferStorageTypes enum
+    :type buffer_storage: int
+    :param package_num_check: how to track package num channel, value from PackageNumCheckTypes enum, gaps are reported by get_board_metrics
+    :type package_num_check: int
     """
 
     def __init__(self) -> None:
@@ -142,6 +163,8 @@ class BrainFlowInputParams(object):
         self.file_aux = ''
         self.file_anc = ''
         self.master_board = BoardIds.NO_BOARD.value
+        self.buffer_storage = BufferStorageTypes.FLOAT64.value
+        self.package_num_check = PackageNumCheckTypes.OFF.value
 
     def to_json(self) -> None:
         return json.dumps(self, default=lambda o: o.__dict__,
@@ -286,6 +309,17 @@ class BoardControllerDLL(object):
             ctypes.c_char_p
         ]
 
+        self.wait_for_board_data = self.lib.wait_for_board_data
+        self.wait_for_board_data.restype = ctypes.c_int
+        self.wait_for_board_data.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
         self.set_log_level_board_controller = self.lib.set_log_level_board_controller
         self.set_log_level_board_controller.restype = ctypes.c_int
         self.set_log_level_board_controller.argtypes = [
@@ -324,6 +358,173 @@ class BoardControllerDLL(object):
             ctypes.c_char_p
         ]
 
+        self.prepare_session_with_handle = self.lib.prepare_session_with_handle
+        self.prepare_session_with_handle.restype = ctypes.c_int
+        self.prepare_session_with_handle.argtypes = [
+            ctypes.c_int,
+            ctypes.c_char_p,
+            ndpointer(ctypes.c_int32)
+        ]
+
+        self.get_session_handle = self.lib.get_session_handle
+        self.get_session_handle.restype = ctypes.c_int
+        self.get_session_handle.argtypes = [
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int,
+            ctypes.c_char_p
+        ]
+
+        self.is_prepared_by_handle = self.lib.is_prepared_by_handle
+        self.is_prepared_by_handle.restype = ctypes.c_int
+        self.is_prepared_by_handle.argtypes = [
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.start_stream_by_handle = self.lib.start_stream_by_handle
+        self.start_stream_by_handle.restype = ctypes.c_int
+        self.start_stream_by_handle.argtypes = [
+            ctypes.c_int,
+            ctypes.c_char_p,
+            ctypes.c_int
+        ]
+
+        self.add_streamer_by_handle = self.lib.add_streamer_by_handle
+        self.add_streamer_by_handle.restype = ctypes.c_int
+        self.add_streamer_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.delete_streamer_by_handle = self.lib.delete_streamer_by_handle
+        self.delete_streamer_by_handle.restype = ctypes.c_int
+        self.delete_streamer_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.stop_stream_by_handle = self.lib.stop_stream_by_handle
+        self.stop_stream_by_handle.restype = ctypes.c_int
+        self.stop_stream_by_handle.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.get_current_board_data_by_handle = self.lib.get_current_board_data_by_handle
+        self.get_current_board_data_by_handle.restype = ctypes.c_int
+        self.get_current_board_data_by_handle.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.get_board_data_by_handle = self.lib.get_board_data_by_handle
+        self.get_board_data_by_handle.restype = ctypes.c_int
+        self.get_board_data_by_handle.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ctypes.c_int
+        ]
+
+        self.release_session_by_handle = self.lib.release_session_by_handle
+        self.release_session_by_handle.restype = ctypes.c_int
+        self.release_session_by_handle.argtypes = [
+            ctypes.c_int
+        ]
+
+        self.insert_marker_by_handle = self.lib.insert_marker_by_handle
+        self.insert_marker_by_handle.restype = ctypes.c_int
+        self.insert_marker_by_handle.argtypes = [
+            ctypes.c_double,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.get_board_data_count_by_handle = self.lib.get_board_data_count_by_handle
+        self.get_board_data_count_by_handle.restype = ctypes.c_int
+        self.get_board_data_count_by_handle.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.wait_for_board_data_by_handle = self.lib.wait_for_board_data_by_handle
+        self.wait_for_board_data_by_handle.restype = ctypes.c_int
+        self.wait_for_board_data_by_handle.argtypes = [
+            ctypes.c_int,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.config_board_by_handle = self.lib.config_board_by_handle
+        self.config_board_by_handle.restype = ctypes.c_int
+        self.config_board_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ndpointer(ctypes.c_ubyte),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.config_board_with_bytes_by_handle = self.lib.config_board_with_bytes_by_handle
+        self.config_board_with_bytes_by_handle.restype = ctypes.c_int
+        self.config_board_with_bytes_by_handle.argtypes = [
+            ndpointer(ctypes.c_ubyte),
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.register_reader_by_handle = self.lib.register_reader_by_handle
+        self.register_reader_by_handle.restype = ctypes.c_int
+        self.register_reader_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.unregister_reader_by_handle = self.lib.unregister_reader_by_handle
+        self.unregister_reader_by_handle.restype = ctypes.c_int
+        self.unregister_reader_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ctypes.c_int
+        ]
+
+        self.read_since_cursor_by_handle = self.lib.read_since_cursor_by_handle
+        self.read_since_cursor_by_handle.restype = ctypes.c_int
+        self.read_since_cursor_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ctypes.c_int,
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.get_reader_stats_by_handle = self.lib.get_reader_stats_by_handle
+        self.get_reader_stats_by_handle.restype = ctypes.c_int
+        self.get_reader_stats_by_handle.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_int,
+            ndpointer(ctypes.c_int32),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
+        self.get_board_metrics_by_handle = self.lib.get_board_metrics_by_handle
+        self.get_board_metrics_by_handle.restype = ctypes.c_int
+        self.get_board_metrics_by_handle.argtypes = [
+            ctypes.c_int,
+            ndpointer(ctypes.c_ubyte),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_int
+        ]
+
         self.get_sampling_rate = self.lib.get_sampling_rate
         self.get_sampling_rate.restype = ctypes.c_int
         self.get_sampling_rate.argtypes = [
@@ -566,8 +767,11 @@ class BoardShim(object):
         except BaseException:
             self.input_json = input_params.to_json()
         self.board_id = board_id
+        # resolved lazily, session may be prepared by another BoardShim object with the same params
+        self._session_handle = -1
         # we need it for streaming board
-        if board_id == BoardIds.STREAMING_BOARD.value or board_id == BoardIds.PLAYBACK_FILE_BOARD.value:
+        if board_id in (BoardIds.STREAMING_BOARD.value, BoardIds.PLAYBACK_FILE_BOARD.value,
+                        BoardIds.SHARED_MEMORY_BOARD.value):
             if input_params.master_board != BoardIds.NO_BOARD:
                 self._master_board_id = input_params.master_board
             else:
@@ -1182,19 +1386,43 @@ class BoardShim(object):
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to release sessions', res)
 
+    def _get_session_handle(self) -> int:
+        if self._session_handle < 0:
+            session_handle = numpy.zeros(1).astype(numpy.int32)
+            res = BoardControllerDLL.get_instance().get_session_handle(session_handle, self.board_id,
+                                                                       self.input_json)
+            if res == BrainFlowExitCodes.STATUS_OK.value:
+                self._session_handle = int(session_handle[0])
+        return self._session_handle
+
+    def _call_by_handle(self, func, *args) -> int:
+        old_handle = self._get_session_handle()
+        res = func(*args, old_handle)
+        # cached handle is stale if session was released and prepared again elsewhere, retry once
+        if res == BrainFlowExitCodes.BOARD_NOT_CREATED_ERROR.value and old_handle >= 0:
+            self._session_handle = -1
+            new_handle = self._get_session_handle()
+            if new_handle >= 0 and new_handle != old_handle:
+                res = func(*args, new_handle)
+        return res
+
     def prepare_session(self) -> None:
         """prepare streaming sesssion, init resources, you need to call it before any other BoardShim object methods"""
 
-        res = BoardControllerDLL.get_instance().prepare_session(self.board_id, self.input_json)
+        session_handle = numpy.zeros(1).astype(numpy.int32)
+
+        res = BoardControllerDLL.get_instance().prepare_session_with_handle(self.board_id, self.input_json,
+                                                                            session_handle)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to prepare streaming session', res)
+        self._session_handle = int(session_handle[0])
 
     def add_streamer(self, streamer_params: str, preset: int = BrainFlowPresets.DEFAULT_PRESET) -> None:
         """Add streamer
 
         :param preset: preset
         :type preset: int
-        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "streaming_board://%multicast_group_ip%:%port%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
+        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "binary_file://%file_name%:w", "binary_file://%file_name%:a", "compressed_file://%file_name%:w", "compressed_file://%file_name%:a", "segmented_file://%prefix%:size_mb=%size%,duration=%seconds%", "streaming_board://%multicast_group_ip%:%port%", "shm://%name%:seconds=%seconds%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
         :type streamer_params: str
         """
 
@@ -1206,7 +1434,7 @@ class BoardShim(object):
             except BaseException:
                 streamer = streamer_params
 
-        res = BoardControllerDLL.get_instance().add_streamer(streamer, preset, self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().add_streamer_by_handle, streamer, preset)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to add streamer', res)
 
@@ -1215,7 +1443,7 @@ class BoardShim(object):
 
         :param preset: preset
         :type preset: int
-        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "streaming_board://%multicast_group_ip%:%port%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
+        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "binary_file://%file_name%:w", "binary_file://%file_name%:a", "compressed_file://%file_name%:w", "compressed_file://%file_name%:a", "segmented_file://%prefix%:size_mb=%size%,duration=%seconds%", "streaming_board://%multicast_group_ip%:%port%", "shm://%name%:seconds=%seconds%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
         :type streamer_params: str
         """
 
@@ -1227,7 +1455,7 @@ class BoardShim(object):
             except BaseException:
                 streamer = streamer_params
 
-        res = BoardControllerDLL.get_instance().delete_streamer(streamer, preset, self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().delete_streamer_by_handle, streamer, preset)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to delete streamer', res)
 
@@ -1236,7 +1464,7 @@ class BoardShim(object):
 
         :param num_samples: size of ring buffer to keep data
         :type num_samples: int
-        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "streaming_board://%multicast_group_ip%:%port%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
+        :param streamer_params parameter to stream data from brainflow, supported vals: "file://%file_name%:w", "file://%file_name%:a", "binary_file://%file_name%:w", "binary_file://%file_name%:a", "compressed_file://%file_name%:w", "compressed_file://%file_name%:a", "segmented_file://%prefix%:size_mb=%size%,duration=%seconds%", "streaming_board://%multicast_group_ip%:%port%", "shm://%name%:seconds=%seconds%". Range for multicast addresses is from "224.0.0.0" to "239.255.255.255"
         :type streamer_params: str
         """
 
@@ -1248,21 +1476,22 @@ class BoardShim(object):
             except BaseException:
                 streamer = streamer_params
 
-        res = BoardControllerDLL.get_instance().start_stream(num_samples, streamer, self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().start_stream_by_handle, num_samples, streamer)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to start streaming session', res)
 
     def stop_stream(self) -> None:
         """Stop streaming data"""
 
-        res = BoardControllerDLL.get_instance().stop_stream(self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().stop_stream_by_handle)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to stop streaming session', res)
 
     def release_session(self) -> None:
         """release all resources"""
 
-        res = BoardControllerDLL.get_instance().release_session(self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().release_session_by_handle)
+        self._session_handle = -1
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to release streaming session', res)
 
@@ -1281,8 +1510,8 @@ class BoardShim(object):
         data_arr = numpy.zeros(int(num_samples * package_length)).astype(numpy.float64)
         current_size = numpy.zeros(1).astype(numpy.int32)
 
-        res = BoardControllerDLL.get_instance().get_current_board_data(num_samples, preset, data_arr, current_size,
-                                                                       self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().get_current_board_data_by_handle,
+                                   num_samples, preset, data_arr, current_size)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to get current data', res)
 
@@ -1303,11 +1532,33 @@ class BoardShim(object):
 
         data_size = numpy.zeros(1).astype(numpy.int32)
 
-        res = BoardControllerDLL.get_instance().get_board_data_count(preset, data_size, self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().get_board_data_count_by_handle, preset, data_size)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to obtain buffer size', res)
         return data_size[0]
 
+    def wait_for_board_data(self, min_samples: int, timeout_ms: int,
+                            preset: int = BrainFlowPresets.DEFAULT_PRESET) -> int:
+        """Block until ringbuffer has at least min_samples elements or timeout expires
+
+        :param min_samples: number of elements to wait for
+        :type min_samples: int
+        :param timeout_ms: max time to wait in milliseconds
+        :type timeout_ms: int
+        :param preset: preset
+        :type preset: int
+        :return: number of elements in ring buffer, less than min_samples if timeout expired
+        :rtype: int
+        """
+
+        data_size = numpy.zeros(1).astype(numpy.int32)
+
+        res = self._call_by_handle(BoardControllerDLL.get_instance().wait_for_board_data_by_handle,
+                                   preset, min_samples, timeout_ms, data_size)
+        if res != BrainFlowExitCodes.STATUS_OK.value and res != BrainFlowExitCodes.SYNC_TIMEOUT_ERROR.value:
+            raise BrainFlowError('unable to wait for board data', res)
+        return data_size[0]
+
     def get_board_id(self) -> int:
         """Get's the actual board id, can be different than provided
 
@@ -1328,7 +1579,7 @@ class BoardShim(object):
         :rtype: int
         """
 
-        res = BoardControllerDLL.get_instance().insert_marker(value, preset, self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().insert_marker_by_handle, value, preset)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to insert marker', res)
 
@@ -1340,7 +1591,11 @@ class BoardShim(object):
         """
         prepared = numpy.zeros(1).astype(numpy.int32)
 
-        res = BoardControllerDLL.get_instance().is_prepared(prepared, self.board_id, self.input_json)
+        res = BoardControllerDLL.get_instance().is_prepared_by_handle(prepared, self._get_session_handle())
+        if res == BrainFlowExitCodes.STATUS_OK.value and not prepared[0] and self._session_handle >= 0:
+            # released elsewhere, may be prepared again with the same params
+            self._session_handle = -1
+            res = BoardControllerDLL.get_instance().is_prepared_by_handle(prepared, self._get_session_handle())
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to check session status', res)
         return bool(prepared[0])
@@ -1365,12 +1620,109 @@ class BoardShim(object):
         package_length = BoardShim.get_num_rows(self._master_board_id, preset)
         data_arr = numpy.zeros(data_size * package_length).astype(numpy.float64)
 
-        res = BoardControllerDLL.get_instance().get_board_data(data_size, preset, data_arr, self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().get_board_data_by_handle,
+                                   data_size, preset, data_arr)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to get board data', res)
 
         return data_arr.reshape(package_length, data_size)
 
+    def register_reader(self, reader_name: str, preset: int = BrainFlowPresets.DEFAULT_PRESET) -> None:
+        """Register named reader, each reader gets every package pushed after registration exactly once, independent from get_board_data and other readers
+
+        :param reader_name: unique name of reader
+        :type reader_name: str
+        :param preset: preset
+        :type preset: int
+        """
+
+        res = self._call_by_handle(BoardControllerDLL.get_instance().register_reader_by_handle,
+                                   reader_name.encode(), preset)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to register reader', res)
+
+    def unregister_reader(self, reader_name: str, preset: int = BrainFlowPresets.DEFAULT_PRESET) -> None:
+        """Unregister named reader
+
+        :param reader_name: name of reader
+        :type reader_name: str
+        :param preset: preset
+        :type preset: int
+        """
+
+        res = self._call_by_handle(BoardControllerDLL.get_instance().unregister_reader_by_handle,
+                                   reader_name.encode(), preset)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to unregister reader', res)
+
+    def get_reader_stats(self, reader_name: str, preset: int = BrainFlowPresets.DEFAULT_PRESET) -> tuple:
+        """Get lag and overflow of named reader
+
+        :param reader_name: name of reader
+        :type reader_name: str
+        :param preset: preset
+        :type preset: int
+        :return: number of packages available for this reader and number of packages it lost
+        :rtype: tuple
+        """
+
+        lag = numpy.zeros(1).astype(numpy.int32)
+        overflow = numpy.zeros(1).astype(numpy.int32)
+
+        res = self._call_by_handle(BoardControllerDLL.get_instance().get_reader_stats_by_handle,
+                                   reader_name.encode(), preset, lag, overflow)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get reader stats', res)
+        return int(lag[0]), int(overflow[0])
+
+    def get_board_metrics(self, preset: int = BrainFlowPresets.DEFAULT_PRESET):
+        """Get counters of data loss, ring buffer usage, streamer queues and push latency
+
+        :param preset: preset
+        :type preset: int
+        :return: samples_pushed, samples_overwritten, buffer_count, buffer_high_water_mark, streamer_queue_depth, streamer_max_queue_depth, streamer_dropped, push_latency_us_bounds, push_latency_counts, samples_per_second, rate_window_seconds, preset_lock_contentions
+        :rtype: json
+        """
+
+        string = numpy.zeros(16000).astype(numpy.ubyte)
+        string_len = numpy.zeros(1).astype(numpy.int32)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().get_board_metrics_by_handle,
+                                   preset, string, string_len)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to get board metrics', res)
+        return json.loads(string.tobytes().decode('utf-8')[0:string_len[0]])
+
+    def read_since_cursor(self, reader_name: str, num_samples=None,
+                          preset: int = BrainFlowPresets.DEFAULT_PRESET) -> NDArray[Float64]:
+        """Get packages which named reader did not get yet, data stays in ringbuffer for other consumers
+
+        :param reader_name: name of reader
+        :type reader_name: str
+        :param num_samples: max number of packages to get, all available packages if None
+        :type num_samples: int
+        :param preset: preset
+        :type preset: int
+        :return: data from a board
+        :rtype: NDArray[Float64]
+        """
+
+        data_size, _ = self.get_reader_stats(reader_name, preset)
+        if num_samples is not None:
+            if num_samples < 0:
+                raise BrainFlowError('invalid num_samples', BrainFlowExitCodes.INVALID_ARGUMENTS_ERROR.value)
+            else:
+                data_size = min(data_size, num_samples)
+        package_length = BoardShim.get_num_rows(self._master_board_id, preset)
+        data_arr = numpy.zeros(data_size * package_length).astype(numpy.float64)
+        current_size = numpy.zeros(1).astype(numpy.int32)
+
+        res = self._call_by_handle(BoardControllerDLL.get_instance().read_since_cursor_by_handle,
+                                   reader_name.encode(), data_size, preset, data_arr, current_size)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to read since cursor', res)
+
+        return data_arr[0:current_size[0] * package_length].reshape(package_length, current_size[0])
+
     def config_board(self, config) -> str:
         """Use this method carefully and only if you understand what you are doing, do NOT use it to start or stop streaming
 
@@ -1386,8 +1738,8 @@ class BoardShim(object):
         string = numpy.zeros(4096).astype(numpy.ubyte)
         string_len = numpy.zeros(1).astype(numpy.int32)
 
-        res = BoardControllerDLL.get_instance().config_board(config_string, string, string_len, self.board_id,
-                                                             self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().config_board_by_handle,
+                                   config_string, string, string_len)
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to config board', res)
         return string.tobytes().decode('utf-8')[0:string_len[0]]
@@ -1398,6 +1750,7 @@ class BoardShim(object):
         :param bytes_to_send: bytes to send
         :type config: ndarray astype(numpy.ubyte)
         """
-        res = BoardControllerDLL.get_instance().config_board_with_bytes(bytes_to_send, len(bytes_to_send), self.board_id, self.input_json)
+        res = self._call_by_handle(BoardControllerDLL.get_instance().config_board_with_bytes_by_handle,
+                                   bytes_to_send, len(bytes_to_send))
         if res != BrainFlowExitCodes.STATUS_OK.value:
             raise BrainFlowError('unable to config board', res)
@@ -318,6 +318,27 @@ class DataHandlerDLL(object):
             ndpointer(ctypes.c_int32)
         ]
 
+        self.read_file_range = self.lib.read_file_range
+        self.read_file_range.restype = ctypes.c_int
+        self.read_file_range.argtypes = [
+            ndpointer(ctypes.c_double),
+            ndpointer(ctypes.c_int32),
+            ndpointer(ctypes.c_int32),
+            ctypes.c_char_p,
+            ctypes.c_double,
+            ctypes.c_double,
+            ctypes.c_int
+        ]
+
+        self.get_num_elements_in_file_range = self.lib.get_num_elements_in_file_range
+        self.get_num_elements_in_file_range.restype = ctypes.c_int
+        self.get_num_elements_in_file_range.argtypes = [
+            ctypes.c_char_p,
+            ctypes.c_double,
+            ctypes.c_double,
+            ndpointer(ctypes.c_int32)
+        ]
+
         self.perform_rolling_filter = self.lib.perform_rolling_filter
         self.perform_rolling_filter.restype = ctypes.c_int
         self.perform_rolling_filter.argtypes = [
@@ -1330,7 +1351,7 @@ class DataFilter(object):
 
     @classmethod
     def read_file(cls, file_name: str):
-        """read data from file
+        """read data from file, text files and binary recordings from binary_file and compressed_file streamers are supported
 
         :param file_name: file name to read
         :type file_name: str
@@ -1361,6 +1382,41 @@ class DataFilter(object):
         data_arr = data_arr[0:num_rows[0] * num_cols[0]].reshape(num_rows[0], num_cols[0])
         return data_arr
 
+    @classmethod
+    def read_file_range(cls, prefix: str, start_time: float, end_time: float):
+        """read samples with timestamps from start_time to end_time from segmented_file recording, only blocks which overlap this range are read
+
+        :param prefix: prefix used for segmented_file streamer
+        :type prefix: str
+        :param start_time: start of the range, inclusive
+        :type start_time: float
+        :param end_time: end of the range, inclusive
+        :type end_time: float
+        :return: 2d numpy array with data from this range
+        :rtype: 2d numpy array
+        """
+        try:
+            file = prefix.encode()
+        except BaseException:
+            file = prefix
+
+        num_elements = numpy.zeros(1).astype(numpy.int32)
+        res = DataHandlerDLL.get_instance().get_num_elements_in_file_range(file, start_time, end_time, num_elements)
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to determine number of elements in range', res)
+
+        data_arr = numpy.zeros(num_elements[0]).astype(numpy.float64)
+        num_rows = numpy.zeros(1).astype(numpy.int32)
+        num_cols = numpy.zeros(1).astype(numpy.int32)
+
+        res = DataHandlerDLL.get_instance().read_file_range(data_arr, num_rows, num_cols, file, start_time,
+                                                            end_time, num_elements[0])
+        if res != BrainFlowExitCodes.STATUS_OK.value:
+            raise BrainFlowError('unable to read file range', res)
+
+        data_arr = data_arr[0:num_rows[0] * num_cols[0]].reshape(num_rows[0], num_cols[0])
+        return data_arr
+
     @classmethod
     def get_version(cls) -> str:
         """get version of brainflow libraries
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "board_info_getter.h" // include it here for matlab
+#include "shared_export.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    // data is channel major: data[channel * num_samples + sample], valid only during the call
+    typedef void (CALLING_CONVENTION *brainflow_data_callback) (
+        const double *data, int num_rows, int num_samples, int preset, void *user_data);
+
+    // data acquisition methods
+    SHARED_EXPORT int CALLING_CONVENTION prepare_session (
+        int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION start_stream (int buffer_size, const char *streamer_params,
+        int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION stop_stream (
+        int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION release_session (
+        int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int get_current_board_data (int num_samples, int preset, double *data_buf,
+        int *returned_samples, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_data_count (
+        int preset, int *result, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_data (int data_count, int preset,
+        double *data_buf, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION wait_for_board_data (int preset, int min_samples,
+        int timeout_ms, int *result, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION config_board (const char *config, char *response,
+        int *response_len, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION config_board_with_bytes (
+        const char *bytes, int len, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION is_prepared (
+        int *prepared, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION insert_marker (
+        double marker_value, int preset, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION add_streamer (
+        const char *streamer, int preset, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION delete_streamer (
+        const char *streamer, int preset, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION register_data_callback (brainflow_data_callback callback,
+        void *user_data, int batch_size, int preset, int board_id,
+        const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION unregister_data_callback (
+        int preset, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION release_all_sessions ();
+
+    // session handle identifies prepared session, methods below skip json parsing and board lookup
+    SHARED_EXPORT int CALLING_CONVENTION prepare_session_with_handle (
+        int board_id, const char *json_brainflow_input_params, int *session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_session_handle (
+        int *session_handle, int board_id, const char *json_brainflow_input_params);
+    SHARED_EXPORT int CALLING_CONVENTION start_stream_by_handle (
+        int buffer_size, const char *streamer_params, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION stop_stream_by_handle (int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION release_session_by_handle (int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_current_board_data_by_handle (int num_samples,
+        int preset, double *data_buf, int *returned_samples, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_data_count_by_handle (
+        int preset, int *result, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_board_data_by_handle (
+        int data_count, int preset, double *data_buf, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION wait_for_board_data_by_handle (
+        int preset, int min_samples, int timeout_ms, int *result, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION config_board_by_handle (
+        const char *config, char *response, int *response_len, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION config_board_with_bytes_by_handle (
+        const char *bytes, int len, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION is_prepared_by_handle (int *prepared, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION insert_marker_by_handle (
+        double marker_value, int preset, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION add_streamer_by_handle (
+        const char *streamer, int preset, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION delete_streamer_by_handle (
+        const char *streamer, int preset, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION register_data_callback_by_handle (
+        brainflow_data_callback callback, void *user_data, int batch_size, int preset,
+        int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION unregister_data_callback_by_handle (
+        int preset, int session_handle);
+    // named cursors, each reader gets every package once without removing it from ring buffer
+    SHARED_EXPORT int CALLING_CONVENTION register_reader_by_handle (
+        const char *reader_name, int preset, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION unregister_reader_by_handle (
+        const char *reader_name, int preset, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION read_since_cursor_by_handle (const char *reader_name,
+        int max_samples, int preset, double *data_buf, int *returned_samples, int session_handle);
+    SHARED_EXPORT int CALLING_CONVENTION get_reader_stats_by_handle (
+        const char *reader_name, int preset, int *lag, int *overflow, int session_handle);
+    // json with data loss, buffer, streamer and push latency counters of a preset
+    SHARED_EXPORT int CALLING_CONVENTION get_board_metrics_by_handle (
+        int preset, char *metrics, int *len, int session_handle);
+
+    // logging methods
+    SHARED_EXPORT int CALLING_CONVENTION set_log_level_board_controller (int log_level);
+    SHARED_EXPORT int CALLING_CONVENTION set_log_file_board_controller (const char *log_file);
+    SHARED_EXPORT int CALLING_CONVENTION log_message_board_controller (
+        int log_level, char *message);
+
+    // platform types and methods
+    typedef const struct JNINativeInterface *JNIEnv; // A handle to use Java's JNI
+    SHARED_EXPORT int CALLING_CONVENTION java_set_jnienv (JNIEnv *java_jnienv);
+    SHARED_EXPORT int CALLING_CONVENTION get_version_board_controller (
+        char *version, int *num_chars, int max_chars);
+
+#ifdef __cplusplus
+}
+#endif
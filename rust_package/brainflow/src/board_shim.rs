@@ -29,7 +29,9 @@ impl BoardShim {
         let json_brainflow_input_params = serde_json::to_string(&input_params)?;
         let json_brainflow_input_params = CString::new(json_brainflow_input_params)?;
         let master_board_id =
-            if let BoardIds::StreamingBoard | BoardIds::PlaybackFileBoard = board_id {
+            if let BoardIds::StreamingBoard | BoardIds::PlaybackFileBoard | BoardIds::SharedMemoryBoard =
+                board_id
+            {
                 num::FromPrimitive::from_usize(*input_params.master_board()).unwrap()
             } else {
                 board_id
@@ -29,7 +29,7 @@ pub enum BrainFlowExitCodes {
     UnsupportedClassifierAndMetricCombinationError = 23,
 }
 impl BoardIds {
-    pub const FIRST: BoardIds = BoardIds::PlaybackFileBoard;
+    pub const FIRST: BoardIds = BoardIds::SharedMemoryBoard;
 }
 impl BoardIds {
     pub const LAST: BoardIds = BoardIds::ExplorePlus32ChanBoard;
@@ -38,6 +38,7 @@ impl BoardIds {
 #[derive(FromPrimitive, ToPrimitive, Debug, Copy, Clone, Hash, PartialEq, Eq)]
 pub enum BoardIds {
     NoBoard = -100,
+    SharedMemoryBoard = -4,
     PlaybackFileBoard = -3,
     StreamingBoard = -2,
     SyntheticBoard = -1,
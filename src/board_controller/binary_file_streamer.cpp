@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <string.h>
+
+#include "binary_file_streamer.h"
+#include "board.h"
+#include "brainflow_constants.h"
+
+
+BinaryFileStreamer::BinaryFileStreamer (const char *file, const char *file_mode, int data_len,
+    int board_id, int preset, json preset_descr, bool compressed)
+    : Streamer (data_len, compressed ? "compressed_file" : "binary_file", file, file_mode)
+{
+    strncpy (this->file, file, BRAINFLOW_FILE_NAME_LIMIT - 1);
+    this->file[BRAINFLOW_FILE_NAME_LIMIT - 1] = '\0';
+    strncpy (this->file_mode, file_mode, BRAINFLOW_FILE_NAME_LIMIT - 1);
+    this->file_mode[BRAINFLOW_FILE_NAME_LIMIT - 1] = '\0';
+    fp = NULL;
+    header.board_id = board_id;
+    header.preset = preset;
+    header.num_rows = len;
+    header.descr = preset_descr.dump ();
+    header.compressed = compressed;
+    buffered_bytes = 0;
+    block_samples = 0;
+    write_failed = false;
+}
+
+BinaryFileStreamer::~BinaryFileStreamer ()
+{
+    if (fp != NULL)
+    {
+        flush_block ();
+        flush_buffer ();
+        fclose (fp);
+        fp = NULL;
+    }
+}
+
+int BinaryFileStreamer::init_streamer ()
+{
+    if (len <= 0)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (header.compressed)
+    {
+        block.resize ((size_t)BFREC_BLOCK_SAMPLES * len);
+    }
+    else
+    {
+        size_t sample_bytes = len * sizeof (double);
+        // buffer holds whole samples only
+        size_t buffer_samples =
+            std::max ((size_t)1, (size_t)BFREC_WRITE_BUFFER_SIZE / sample_bytes);
+        write_buffer.resize (buffer_samples * sample_bytes);
+    }
+    if ((strcmp (file_mode, "a") == 0) || (strcmp (file_mode, "a+") == 0))
+    {
+        return open_for_append ();
+    }
+    if ((strcmp (file_mode, "w") != 0) && (strcmp (file_mode, "w+") != 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    fp = fopen (file, "wb");
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    setvbuf (fp, NULL, _IONBF, 0); // data is buffered in write_buffer already
+    return bfrec_write_header (fp, header);
+}
+
+int BinaryFileStreamer::open_for_append ()
+{
+    FILE *existing_fp = fopen (file, "rb");
+    if (existing_fp == NULL)
+    {
+        // new file, same as write mode
+        fp = fopen (file, "wb");
+        if (fp == NULL)
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        setvbuf (fp, NULL, _IONBF, 0);
+        return bfrec_write_header (fp, header);
+    }
+    fclose (existing_fp);
+    BFRecReader reader;
+    int res = reader.open (file);
+    const BFRecHeader &existing = reader.get_header ();
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) || (existing.num_rows != header.num_rows) ||
+        (existing.board_id != header.board_id) || (existing.preset != header.preset) ||
+        (existing.compressed != header.compressed))
+    {
+        // dont mix data of different boards or formats in one recording
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    header.header_size = existing.header_size;
+    int64_t data_end = reader.get_data_end ();
+    reader.close ();
+    fp = fopen (file, "r+b");
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    setvbuf (fp, NULL, _IONBF, 0);
+    // incomplete sample or block at the end is overwritten
+    if (bfrec_seek (fp, data_end, SEEK_SET) != 0)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BinaryFileStreamer::stream_data (double *data)
+{
+    stream_packages (data, 1);
+}
+
+void BinaryFileStreamer::stream_packages (double *data, int count)
+{
+    if ((buffered_bytes == 0) && (block_samples == 0))
+    {
+        pending_since = std::chrono::steady_clock::now ();
+    }
+    if (header.compressed)
+    {
+        int done = 0;
+        while (done < count)
+        {
+            int num_samples = std::min (count - done, BFREC_BLOCK_SAMPLES - block_samples);
+            memcpy (block.data () + (size_t)block_samples * len, data + (size_t)done * len,
+                sizeof (double) * num_samples * len);
+            block_samples += num_samples;
+            done += num_samples;
+            if (block_samples == BFREC_BLOCK_SAMPLES)
+            {
+                flush_block ();
+            }
+        }
+        flush_pending ();
+        return;
+    }
+    size_t sample_bytes = len * sizeof (double);
+    int done = 0;
+    while (done < count)
+    {
+        size_t free_samples = (write_buffer.size () - buffered_bytes) / sample_bytes;
+        size_t num_samples = std::min ((size_t)(count - done), free_samples);
+        bfrec_encode (data + (size_t)done * len, num_samples * len,
+            write_buffer.data () + buffered_bytes);
+        buffered_bytes += num_samples * sample_bytes;
+        done += (int)num_samples;
+        if (buffered_bytes == write_buffer.size ())
+        {
+            flush_buffer ();
+        }
+    }
+    flush_pending ();
+}
+
+void BinaryFileStreamer::flush_pending ()
+{
+    if ((buffered_bytes == 0) && (block_samples == 0))
+    {
+        return;
+    }
+    // slow boards fill buffer or block for minutes, dont keep their data only in memory
+    auto now = std::chrono::steady_clock::now ();
+    if (std::chrono::duration_cast<std::chrono::milliseconds> (now - pending_since).count () >=
+        BFREC_FLUSH_INTERVAL_MS)
+    {
+        flush_block ();
+        flush_buffer ();
+    }
+}
+
+void BinaryFileStreamer::flush_buffer ()
+{
+    if (buffered_bytes > 0)
+    {
+        size_t written = fwrite (write_buffer.data (), 1, buffered_bytes, fp);
+        check_write (written == buffered_bytes, buffered_bytes);
+        buffered_bytes = 0;
+    }
+}
+
+void BinaryFileStreamer::flush_block ()
+{
+    if (block_samples > 0)
+    {
+        int res = bfrec_write_block (fp, block.data (), block_samples, len, write_buffer);
+        check_write (res == (int)BrainFlowExitCodes::STATUS_OK, write_buffer.size ());
+        block_samples = 0;
+    }
+}
+
+void BinaryFileStreamer::check_write (bool res, size_t bytes)
+{
+    if ((!res) && (!write_failed))
+    {
+        Board::get_board_logger ()->error (
+            "failed to write {} bytes to {}, data is lost", bytes, file);
+    }
+    else if ((res) && (write_failed))
+    {
+        Board::get_board_logger ()->info ("writes to {} are restored", file);
+    }
+    write_failed = !res;
+}
@@ -52,11 +52,11 @@ bool BLELibBoard::init_dll_loader ()
             blelib_path = lib_name;
         }
 
-        Board::board_logger->debug ("use dyn lib: {}", blelib_path.c_str ());
+        Board::get_board_logger ()->debug ("use dyn lib: {}", blelib_path.c_str ());
         BLELibBoard::dll_loader = new DLLLoader (blelib_path.c_str ());
         if (!BLELibBoard::dll_loader->load_library ())
         {
-            Board::board_logger->error ("failed to load lib");
+            Board::get_board_logger ()->error ("failed to load lib");
             delete BLELibBoard::dll_loader;
             BLELibBoard::dll_loader = NULL;
         }
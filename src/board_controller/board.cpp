@@ -1,15 +1,21 @@
 #include <algorithm>
+#include <chrono>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "binary_file_streamer.h"
 #include "board.h"
 #include "board_controller.h"
+#include "brainflow_env_vars.h"
+#include "callback_streamer.h"
 #include "custom_cast.h"
 #include "file_streamer.h"
 #include "multicast_streamer.h"
 #include "plotjuggler_udp_streamer.h"
-
-#include "spdlog/sinks/null_sink.h"
+#include "segmented_file_streamer.h"
+#include "shared_memory_streamer.h"
+#include "streamer_pool.h"
 
 #define LOGGER_NAME "board_logger"
 
@@ -36,8 +42,9 @@ int Board::set_log_level (int level)
     }
     try
     {
-        Board::board_logger->set_level (spdlog::level::level_enum (log_level));
-        Board::board_logger->flush_on (spdlog::level::level_enum (log_level));
+        std::shared_ptr<spdlog::logger> logger = Board::get_board_logger ();
+        logger->set_level (spdlog::level::level_enum (log_level));
+        logger->flush_on (spdlog::level::level_enum (log_level));
     }
     catch (...)
     {
@@ -49,19 +56,19 @@ int Board::set_log_level (int level)
 int Board::set_log_file (const char *log_file)
 {
 #ifdef __ANDROID__
-    Board::board_logger->error ("For Android set_log_file is unavailable");
+    Board::get_board_logger ()->error ("For Android set_log_file is unavailable");
     return (int)BrainFlowExitCodes::GENERAL_ERROR;
 #else
     try
     {
-        spdlog::level::level_enum level = Board::board_logger->level ();
-        Board::board_logger = spdlog::create<spdlog::sinks::null_sink_st> (
-            "null_logger"); // to dont set logger to nullptr and avoid race condition
+        spdlog::level::level_enum level = Board::get_board_logger ()->level ();
+        // old logger is only unregistered, sessions which hold a copy keep using it until they
+        // load the new one
         spdlog::drop (LOGGER_NAME);
-        Board::board_logger = spdlog::basic_logger_mt (LOGGER_NAME, log_file);
-        Board::board_logger->set_level (level);
-        Board::board_logger->flush_on (level);
-        spdlog::drop ("null_logger");
+        std::shared_ptr<spdlog::logger> logger = spdlog::basic_logger_mt (LOGGER_NAME, log_file);
+        logger->set_level (level);
+        logger->flush_on (level);
+        std::atomic_store (&Board::board_logger, logger);
     }
     catch (...)
     {
@@ -79,12 +86,7 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
         return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
     }
 
-    for (auto it = dbs.begin (), next_it = it; it != dbs.end (); it = next_it)
-    {
-        ++next_it;
-        delete it->second;
-        dbs.erase (it);
-    }
+    free_data_buffers ();
     for (auto it = marker_queues.begin (), next_it = it; it != marker_queues.end (); it = next_it)
     {
         ++next_it;
@@ -125,10 +127,25 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
 
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
+        DataBufferLayout layout = DataBufferLayout::SAMPLE_MAJOR;
+        if (is_brainflow_channel_major_layout ())
+        {
+            safe_logger (spdlog::level::info, "use channel major layout for data buffers");
+            layout = DataBufferLayout::CHANNEL_MAJOR;
+        }
+        // buffers commit memory in chunks as data arrives, so even MAX_CAPTURE_SAMPLES is cheap
+        DataBufferMemory memory = DataBufferMemory::HEAP;
+        if (is_brainflow_hugepages_memory ())
+        {
+            safe_logger (spdlog::level::info, "use huge pages for data buffers");
+            memory = DataBufferMemory::HUGEPAGES;
+        }
         for (auto &el : board_descr.items ())
         {
             json board_preset = el.value ();
-            DataBuffer *db = new DataBuffer ((int)board_preset["num_rows"], buffer_size);
+            int preset_int = preset_to_int (el.key ());
+            BaseDataBuffer *db = new SPSCDataBuffer ((int)board_preset["num_rows"], buffer_size,
+                layout, memory, get_channel_storage (preset_int));
             if (!db->is_ready ())
             {
                 safe_logger (
@@ -139,10 +156,18 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
             }
             else
             {
-                int preset_int = preset_to_int (el.key ());
+                std::lock_guard<std::mutex> wait_lock (data_wait_mutex);
                 dbs[preset_int] = db;
                 marker_queues[preset_int] = std::deque<double> ();
             }
+            // positions of the old buffer mean nothing for the new one
+            for (auto &reader : readers[preset_int])
+            {
+                reader.second.position = 0;
+            }
+            preset_locks[preset_int].lock ();
+            preset_metrics[preset_int].reset ();
+            preset_locks[preset_int].unlock ();
         }
     }
 
@@ -156,46 +181,242 @@ int Board::prepare_for_acquisition (int buffer_size, const char *streamer_params
 
 void Board::push_package (double *package, int preset)
 {
-    std::string preset_str = preset_to_string (preset);
-    if ((board_descr.find (preset_str) == board_descr.end ()) || (dbs.find (preset) == dbs.end ()))
+    push_packages (package, 1, preset);
+}
+
+void Board::set_frame_metrics (const FrameMetrics &frames, int preset)
+{
+    if (dbs.find (preset) == dbs.end ())
+    {
+        return;
+    }
+    preset_locks[preset].lock ();
+    preset_metrics[preset].frames = frames;
+    preset_locks[preset].unlock ();
+}
+
+void Board::push_packages (double *packages, int count, int preset)
+{
+    if (count < 1)
+    {
+        return;
+    }
+    auto descr_it = preset_descrs.find (preset);
+    if ((descr_it == preset_descrs.end ()) || (dbs.find (preset) == dbs.end ()))
     {
         safe_logger (spdlog::level::err, "invalid json or push_package args, no such key");
         return;
     }
+    int num_rows = descr_it->second.num_rows;
+    int marker_channel = descr_it->second.marker_channel;
+    auto push_start = std::chrono::steady_clock::now ();
 
+    CountingSpinLock &lock = preset_locks[preset];
     lock.lock ();
-    json board_preset = board_descr[preset_str];
-    try
+    PresetMetrics &metrics = preset_metrics[preset];
+    if (params.package_num_check != (int)PackageNumCheckTypes::OFF)
     {
-        int marker_channel = board_preset["marker_channel"];
-        if (marker_queues[preset].empty ())
-        {
-            package[marker_channel] = 0.0;
-        }
-        else
+        count = check_package_nums (
+            descr_it->second, metrics, gap_buffers[preset], packages, count, &packages);
+    }
+    if ((marker_channel >= 0) && (marker_channel < num_rows))
+    {
+        std::deque<double> &markers = marker_queues[preset];
+        // one marker per package like for single packages
+        for (int i = 0; i < count; i++)
         {
-            double marker = marker_queues[preset].at (0);
-            package[marker_channel] = marker;
-            marker_queues[preset].pop_front ();
+            double *package = packages + i * num_rows;
+            if (markers.empty ())
+            {
+                package[marker_channel] = 0.0;
+            }
+            else
+            {
+                package[marker_channel] = markers.front ();
+                markers.pop_front ();
+            }
         }
     }
-    catch (...)
+    else
     {
         safe_logger (spdlog::level::err, "Failed to get marker channel/value");
     }
 
     if (dbs[preset] != NULL)
     {
-        dbs[preset]->add_data (package);
+        dbs[preset]->add_data (packages, (size_t)count);
+        metrics.high_water_mark =
+            std::max (metrics.high_water_mark, dbs[preset]->get_data_count ());
     }
-    if (streamers.find (preset) != streamers.end ())
+    // streamers may wait for space in their queues, so they get packages after unlock. Only one
+    // thread pushes to a preset, packages and gap buffer are not changed till this push ends
+    std::vector<Streamer *> preset_streamers;
+    auto streamers_it = streamers.find (preset);
+    if ((streamers_it != streamers.end ()) && (!streamers_it->second.empty ()))
     {
-        for (auto &streamer : streamers[preset])
+        preset_streamers = streamers_it->second;
+        for (Streamer *streamer : preset_streamers)
         {
-            streamer->stream_data (package);
+            streamer->pin ();
         }
     }
+    auto push_end = std::chrono::steady_clock::now ();
+    update_push_metrics (metrics, count, push_start, push_end);
     lock.unlock ();
+    notify_data_waiters (preset);
+
+    for (Streamer *streamer : preset_streamers)
+    {
+        streamer->stream_packages (packages, count);
+        streamer->unpin ();
+    }
+}
+
+void Board::wait_for_unpin (Streamer *streamer)
+{
+    while (streamer->is_pinned ())
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+}
+
+int Board::check_package_nums (const PresetDescr &descr, PresetMetrics &metrics,
+    std::vector<double> &gap_buffer, double *packages, int count, double **result)
+{
+    *result = packages;
+    int num_rows = descr.num_rows;
+    int channel = descr.package_num_channel;
+    int timestamp_channel = descr.timestamp_channel;
+    if ((channel < 0) || (channel >= num_rows))
+    {
+        return count;
+    }
+    bool fill = (params.package_num_check == (int)PackageNumCheckTypes::FILL_GAPS);
+    int copied = 0; // packages already moved to gap_buffer
+    gap_buffer.clear ();
+
+    for (int i = 0; i < count; i++)
+    {
+        double *package = packages + i * num_rows;
+        double package_num = package[channel];
+        if (std::isnan (package_num))
+        {
+            continue;
+        }
+        double last = metrics.last_package_num;
+        double lost = 0.0;
+        if (last < 0.0)
+        {
+            metrics.min_package_num = package_num;
+            metrics.max_package_num = package_num;
+        }
+        else if (package_num > last)
+        {
+            lost = package_num - last - 1.0;
+        }
+        else if ((last - package_num >= PACKAGE_NUM_MIN_WRAP_RANGE) &&
+            ((package_num < metrics.min_package_num) ||
+                (last - package_num > (metrics.max_package_num - metrics.min_package_num) / 2)))
+        {
+            // counter range is learned from observed values, the first wrap is never a gap,
+            // short drops like 0, 1, 0 are not wraps, it needs at least min range of values
+            metrics.wraparounds++;
+            metrics.min_package_num = std::min (metrics.min_package_num, package_num);
+            lost = (metrics.max_package_num - last) + (package_num - metrics.min_package_num);
+        }
+        else
+        {
+            // state is not updated, so stale package does not break tracking of next ones
+            metrics.duplicates++;
+            continue;
+        }
+        metrics.max_package_num = std::max (metrics.max_package_num, package_num);
+        if (lost > 0.0)
+        {
+            metrics.package_gaps++;
+            metrics.lost_packages += (uint64_t)lost;
+        }
+
+        if ((fill) && (lost > 0.0) && (lost <= MAX_GAP_PLACEHOLDERS))
+        {
+            int num_placeholders = (int)lost;
+            gap_buffer.insert (gap_buffer.end (), packages + copied * num_rows, package);
+            copied = i;
+            double timestamp = (timestamp_channel >= 0) ? package[timestamp_channel] : 0.0;
+            for (int j = 1; j <= num_placeholders; j++)
+            {
+                gap_buffer.insert (gap_buffer.end (), num_rows, std::nan (""));
+                double *placeholder = gap_buffer.data () + gap_buffer.size () - num_rows;
+                double expected = last + j;
+                if (expected > metrics.max_package_num)
+                {
+                    expected -= metrics.max_package_num - metrics.min_package_num + 1.0;
+                }
+                placeholder[channel] = expected;
+                if (timestamp_channel >= 0)
+                {
+                    placeholder[timestamp_channel] = metrics.last_timestamp +
+                        (timestamp - metrics.last_timestamp) * j / (num_placeholders + 1);
+                }
+            }
+            metrics.placeholders += num_placeholders;
+        }
+        else if ((fill) && (lost > MAX_GAP_PLACEHOLDERS))
+        {
+            safe_logger (spdlog::level::warn, "gap of {} packages is too long to fill", lost);
+        }
+        metrics.last_package_num = package_num;
+        if (timestamp_channel >= 0)
+        {
+            metrics.last_timestamp = package[timestamp_channel];
+        }
+    }
+
+    if (gap_buffer.empty ())
+    {
+        return count;
+    }
+    gap_buffer.insert (
+        gap_buffer.end (), packages + copied * num_rows, packages + count * num_rows);
+    *result = gap_buffer.data ();
+    return (int)(gap_buffer.size () / num_rows);
+}
+
+void Board::update_push_metrics (PresetMetrics &metrics, int count,
+    std::chrono::steady_clock::time_point push_start,
+    std::chrono::steady_clock::time_point push_end)
+{
+    metrics.pushed += count;
+    long long latency_us =
+        std::chrono::duration_cast<std::chrono::microseconds> (push_end - push_start).count ();
+    int bucket = 0;
+    while ((bucket < PUSH_LATENCY_BUCKETS - 1) && (latency_us >= (1LL << bucket)))
+    {
+        bucket++;
+    }
+    metrics.push_latency[bucket]++;
+
+    double now = std::chrono::duration<double> (push_end.time_since_epoch ()).count ();
+    int last = (metrics.rate_next + RATE_HISTORY_SIZE - 1) % RATE_HISTORY_SIZE;
+    if ((metrics.rate_entries == 0) || (now - metrics.rate_times[last] >= 1.0))
+    {
+        metrics.rate_times[metrics.rate_next] = now;
+        metrics.rate_pushed[metrics.rate_next] = metrics.pushed;
+        metrics.rate_next = (metrics.rate_next + 1) % RATE_HISTORY_SIZE;
+        metrics.rate_entries = std::min (metrics.rate_entries + 1, RATE_HISTORY_SIZE);
+    }
+}
+
+void Board::notify_data_waiters (int preset)
+{
+    // pairs with the fence in wait_for_board_data: either waiter sees new data or we see waiter
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    int threshold = data_waiters[preset].min_threshold.load (std::memory_order_relaxed);
+    if ((threshold > 0) && (dbs[preset]->get_data_count () >= (size_t)threshold))
+    {
+        std::lock_guard<std::mutex> wait_lock (data_wait_mutex);
+        data_wait_cv.notify_all ();
+    }
 }
 
 int Board::insert_marker (double value, int preset)
@@ -205,27 +426,34 @@ int Board::insert_marker (double value, int preset)
         safe_logger (spdlog::level::err, "0 is a default value for marker, you can not use it.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    std::string preset_str = preset_to_string (preset);
-    if ((board_descr.find (preset_str) == board_descr.end ()) ||
+    if ((preset_descrs.find (preset) == preset_descrs.end ()) ||
         (marker_queues.find (preset) == marker_queues.end ()))
     {
         safe_logger (spdlog::level::err, "invalid preset");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    lock.lock ();
+    preset_locks[preset].lock ();
     marker_queues[preset].push_back (value);
-    lock.unlock ();
+    preset_locks[preset].unlock ();
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void Board::free_packages ()
+void Board::free_data_buffers ()
 {
+    std::lock_guard<std::mutex> wait_lock (data_wait_mutex);
     for (auto it = dbs.begin (), next_it = it; it != dbs.end (); it = next_it)
     {
         ++next_it;
         delete it->second;
         dbs.erase (it);
     }
+    // wake up consumers, they will find out that there is no buffer anymore
+    data_wait_cv.notify_all ();
+}
+
+void Board::free_packages ()
+{
+    free_data_buffers ();
 
     for (auto it = marker_queues.begin (), next_it = it; it != marker_queues.end (); it = next_it)
     {
@@ -234,26 +462,43 @@ void Board::free_packages ()
         marker_queues.erase (it);
     }
 
-    for (auto it = streamers.begin (), next_it = it; it != streamers.end (); it = next_it)
+    // keep entries, push_packages looks them up without locks
+    for (auto &preset_streamers : streamers)
     {
-        ++next_it;
-        for (auto &streamer : it->second)
+        for (auto &streamer : preset_streamers.second)
         {
+            wait_for_unpin (streamer);
             delete streamer;
         }
-        streamers.erase (it);
+        preset_streamers.second.clear ();
+    }
+    // streamers are deleted first, they wait for workers to deliver the rest of their data
+    if (streamer_pool != NULL)
+    {
+        delete streamer_pool;
+        streamer_pool = NULL;
+    }
+
+    for (auto &preset_lock : preset_locks)
+    {
+        if (preset_lock.second.get_contentions () > 0)
+        {
+            safe_logger (spdlog::level::debug, "lock for preset {} was contended {} times",
+                preset_lock.first, preset_lock.second.get_contentions ());
+        }
     }
 }
 
 int Board::add_streamer (const char *streamer_params, int preset)
 {
     std::string preset_str = preset_to_string (preset);
-    if (board_descr.find (preset_str) == board_descr.end ())
+    auto descr_it = preset_descrs.find (preset);
+    if (descr_it == preset_descrs.end ())
     {
         safe_logger (spdlog::level::err, "invalid preset");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
+    int num_rows = descr_it->second.num_rows;
     std::string streamer_type = "";
     std::string streamer_dest = "";
     std::string streamer_mods = "";
@@ -270,6 +515,27 @@ int Board::add_streamer (const char *streamer_params, int preset)
             streamer_dest.c_str (), streamer_mods.c_str ());
         streamer = new FileStreamer (streamer_dest.c_str (), streamer_mods.c_str (), num_rows);
     }
+    if (streamer_type == "binary_file")
+    {
+        safe_logger (spdlog::level::trace, "Binary File Streamer, file: {}, mods: {}",
+            streamer_dest.c_str (), streamer_mods.c_str ());
+        streamer = new BinaryFileStreamer (streamer_dest.c_str (), streamer_mods.c_str (),
+            num_rows, board_id, preset, board_descr[preset_str]);
+    }
+    if (streamer_type == "compressed_file")
+    {
+        safe_logger (spdlog::level::trace, "Compressed File Streamer, file: {}, mods: {}",
+            streamer_dest.c_str (), streamer_mods.c_str ());
+        streamer = new BinaryFileStreamer (streamer_dest.c_str (), streamer_mods.c_str (),
+            num_rows, board_id, preset, board_descr[preset_str], true);
+    }
+    if (streamer_type == "segmented_file")
+    {
+        safe_logger (spdlog::level::trace, "Segmented File Streamer, prefix: {}, mods: {}",
+            streamer_dest.c_str (), streamer_mods.c_str ());
+        streamer = new SegmentedFileStreamer (streamer_dest.c_str (), streamer_mods.c_str (),
+            num_rows, board_id, preset, board_descr[preset_str]);
+    }
     if (streamer_type == "streaming_board")
     {
         int port = 0;
@@ -284,7 +550,17 @@ int Board::add_streamer (const char *streamer_params, int preset)
         }
         safe_logger (spdlog::level::trace, "MultiCast Streamer, ip addr: {}, port: {}",
             streamer_dest.c_str (), streamer_mods.c_str ());
-        streamer = new MultiCastStreamer (streamer_dest.c_str (), port, num_rows);
+        int sampling_rate = board_descr[preset_str].value ("sampling_rate", 0);
+        streamer = new MultiCastStreamer (
+            streamer_dest.c_str (), port, num_rows, preset, sampling_rate);
+    }
+    if (streamer_type == "shm")
+    {
+        safe_logger (spdlog::level::trace, "Shared Memory Streamer, name: {}, mods: {}",
+            streamer_dest.c_str (), streamer_mods.c_str ());
+        int sampling_rate = board_descr[preset_str].value ("sampling_rate", 0);
+        streamer = new SharedMemoryStreamer (streamer_dest.c_str (), streamer_mods.c_str (),
+            num_rows, board_id, preset, sampling_rate);
     }
     if (streamer_type == "plotjuggler_udp")
     {
@@ -309,6 +585,18 @@ int Board::add_streamer (const char *streamer_params, int preset)
         safe_logger (spdlog::level::err, "unsupported streamer type {}", streamer_type.c_str ());
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    // push only enqueues packages, slow streamers should not block read thread
+    if (streamer_pool == NULL)
+    {
+        streamer_pool = new StreamerPool (get_brainflow_streamer_threads ());
+    }
+    StreamerOverflowPolicy policy = StreamerOverflowPolicy::DROP;
+    if (is_brainflow_streamer_blocking ())
+    {
+        policy = StreamerOverflowPolicy::BLOCK;
+    }
+    streamer = new AsyncStreamer (
+        streamer, streamer_pool, (size_t)get_brainflow_streamer_queue_size (), policy);
 
     res = streamer->init_streamer ();
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
@@ -319,9 +607,9 @@ int Board::add_streamer (const char *streamer_params, int preset)
     }
     else
     {
-        lock.lock ();
+        preset_locks[preset].lock ();
         streamers[preset].push_back (streamer);
-        lock.unlock ();
+        preset_locks[preset].unlock ();
     }
 
     return res;
@@ -343,18 +631,17 @@ int Board::delete_streamer (const char *streamer_params, int preset)
         return res;
     }
 
+    Streamer *removed = NULL;
     std::vector<Streamer *>::iterator it = streamers[preset].begin ();
-    res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     while (it != streamers[preset].end ())
     {
         if ((*it)->check_equals (streamer_type, streamer_dest, streamer_mods))
         {
-            lock.lock ();
-            delete *it;
-            it = streamers[preset].erase (it);
-            lock.unlock ();
-            res = (int)BrainFlowExitCodes::STATUS_OK;
-            safe_logger (spdlog::level::info, "streamer {} removed", streamer_params);
+            // streamer destructor flushes and closes files or sockets, spinlock must not wait for it
+            preset_locks[preset].lock ();
+            removed = *it;
+            streamers[preset].erase (it);
+            preset_locks[preset].unlock ();
             break;
         }
         else
@@ -363,11 +650,106 @@ int Board::delete_streamer (const char *streamer_params, int preset)
         }
     }
 
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    if (removed == NULL)
     {
         safe_logger (spdlog::level::err, "no such streamer found");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    return res;
+    wait_for_unpin (removed);
+    delete removed;
+    safe_logger (spdlog::level::info, "streamer {} removed", streamer_params);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::register_data_callback (
+    brainflow_data_callback callback, void *user_data, int batch_size, int preset)
+{
+    if ((callback == NULL) || (batch_size < 1) || (batch_size > CALLBACK_STREAMER_MAX_BATCH_SIZE))
+    {
+        safe_logger (spdlog::level::err, "invalid callback or batch size");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    auto descr_it = preset_descrs.find (preset);
+    if (descr_it == preset_descrs.end ())
+    {
+        safe_logger (spdlog::level::err, "invalid preset");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    for (auto &streamer : streamers[preset])
+    {
+        if (streamer->check_equals ("callback", "", ""))
+        {
+            safe_logger (spdlog::level::err, "callback for this preset is already registered");
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    int num_rows = descr_it->second.num_rows;
+    Streamer *streamer = new CallbackStreamer (callback, user_data, batch_size, preset, num_rows);
+    int res = streamer->init_streamer ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        safe_logger (spdlog::level::err, "failed to init callback streamer");
+        delete streamer;
+        return res;
+    }
+    preset_locks[preset].lock ();
+    streamers[preset].push_back (streamer);
+    preset_locks[preset].unlock ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::detach_data_callback (int preset, Streamer **streamer)
+{
+    *streamer = NULL;
+    if (streamers.find (preset) == streamers.end ())
+    {
+        safe_logger (spdlog::level::err, "no such streaming preset");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    preset_locks[preset].lock ();
+    for (auto it = streamers[preset].begin (); it != streamers[preset].end (); it++)
+    {
+        if ((*it)->check_equals ("callback", "", ""))
+        {
+            *streamer = *it;
+            streamers[preset].erase (it);
+            break;
+        }
+    }
+    preset_locks[preset].unlock ();
+    if (*streamer == NULL)
+    {
+        safe_logger (spdlog::level::err, "no callback registered for this preset");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    wait_for_unpin (*streamer);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+std::vector<Streamer *> Board::detach_data_callbacks ()
+{
+    std::vector<Streamer *> detached;
+    for (auto &preset_streamers : streamers)
+    {
+        Streamer *streamer = NULL;
+        preset_locks[preset_streamers.first].lock ();
+        for (auto it = preset_streamers.second.begin (); it != preset_streamers.second.end (); it++)
+        {
+            if ((*it)->check_equals ("callback", "", ""))
+            {
+                streamer = *it;
+                preset_streamers.second.erase (it);
+                break;
+            }
+        }
+        preset_locks[preset_streamers.first].unlock ();
+        if (streamer != NULL)
+        {
+            wait_for_unpin (streamer);
+            detached.push_back (streamer);
+        }
+    }
+    return detached;
 }
 
 int Board::parse_streamer_params (const char *streamer_params, std::string &streamer_type,
@@ -404,8 +786,7 @@ int Board::parse_streamer_params (const char *streamer_params, std::string &stre
 int Board::get_current_board_data (
     int num_samples, int preset, double *data_buf, int *returned_samples)
 {
-    std::string preset_str = preset_to_string (preset);
-    if (board_descr.find (preset_str) == board_descr.end ())
+    if (preset_descrs.find (preset) == preset_descrs.end ())
     {
         safe_logger (spdlog::level::err, "invalid preset");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
@@ -413,7 +794,7 @@ int Board::get_current_board_data (
     if (dbs.find (preset) == dbs.end ())
     {
         safe_logger (spdlog::level::err,
-            "stream is not started or no preset: {} found for this board", preset_str.c_str ());
+            "stream is not started or no preset: {} found for this board", preset);
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
     if (!dbs[preset])
@@ -425,12 +806,7 @@ int Board::get_current_board_data (
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-
-    double *buf = new double[num_samples * num_rows];
-    int num_data_points = (int)dbs[preset]->get_current_data (num_samples, buf);
-    reshape_data (num_data_points, preset, buf, data_buf);
-    delete[] buf;
+    int num_data_points = (int)dbs[preset]->get_current_data_by_channels (num_samples, data_buf);
     *returned_samples = num_data_points;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
@@ -458,8 +834,7 @@ int Board::get_board_data_count (int preset, int *result)
 
 int Board::get_board_data (int data_count, int preset, double *data_buf)
 {
-    std::string preset_str = preset_to_string (preset);
-    if (board_descr.find (preset_str) == board_descr.end ())
+    if (preset_descrs.find (preset) == preset_descrs.end ())
     {
         safe_logger (spdlog::level::err, "invalid preset");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
@@ -478,29 +853,319 @@ int Board::get_board_data (int data_count, int preset, double *data_buf)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
-    double *buf = new double[data_count * num_rows];
-    int num_data_points = (int)dbs[preset]->get_data (data_count, buf);
-    reshape_data (num_data_points, preset, buf, data_buf);
-    delete[] buf;
+    dbs[preset]->get_data_by_channels (data_count, data_buf);
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-void Board::reshape_data (int data_count, int preset, const double *buf, double *output_buf)
+int Board::wait_for_board_data (int preset, int min_samples, int timeout_ms, int *result)
 {
-    std::string preset_str = preset_to_string (preset);
-    int num_rows = (int)board_descr[preset_str]["num_rows"];
+    if ((min_samples < 1) || (timeout_ms < 0) || (!result))
+    {
+        safe_logger (spdlog::level::err, "invalid wait_for_board_data args");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    std::unique_lock<std::mutex> wait_lock (data_wait_mutex);
+    if (dbs.find (preset) == dbs.end ())
+    {
+        safe_logger (spdlog::level::err,
+            "stream is not startted or no preset: {} found for this board", preset);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    DataWaiters &waiters = data_waiters[preset];
+    std::multiset<int>::iterator threshold_it = waiters.thresholds.insert (min_samples);
+    waiters.min_threshold.store (*waiters.thresholds.begin (), std::memory_order_relaxed);
+    // pairs with the fence in notify_data_waiters
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    bool is_ready = data_wait_cv.wait_for (wait_lock, std::chrono::milliseconds (timeout_ms),
+        [this, preset, min_samples]
+        {
+            auto db_it = dbs.find (preset);
+            return (db_it == dbs.end ()) ||
+                (db_it->second->get_data_count () >= (size_t)min_samples);
+        });
+    waiters.thresholds.erase (threshold_it);
+    if (waiters.thresholds.empty ())
+    {
+        waiters.min_threshold.store (0, std::memory_order_relaxed);
+    }
+    else
+    {
+        waiters.min_threshold.store (*waiters.thresholds.begin (), std::memory_order_relaxed);
+    }
+
+    auto db_it = dbs.find (preset);
+    if (db_it == dbs.end ())
+    {
+        safe_logger (spdlog::level::err, "session was released during wait_for_board_data");
+        return (int)BrainFlowExitCodes::BOARD_NOT_READY_ERROR;
+    }
+    *result = (int)db_it->second->get_data_count ();
+    if (!is_ready)
+    {
+        return (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::get_board_metrics (int preset, std::string &metrics)
+{
+    if (preset_descrs.find (preset) == preset_descrs.end ())
+    {
+        safe_logger (spdlog::level::err, "invalid preset");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    auto db_it = dbs.find (preset);
+    if ((db_it == dbs.end ()) || (db_it->second == NULL))
+    {
+        safe_logger (spdlog::level::err,
+            "stream is not started or no preset: {} found for this board", preset);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    // copy under lock, all json work is done after unlock
+    preset_locks[preset].lock ();
+    PresetMetrics preset_copy = preset_metrics[preset];
+    size_t queue_depth = 0;
+    size_t max_queue_depth = 0;
+    uint64_t streamer_dropped = 0;
+    for (Streamer *streamer : streamers[preset])
+    {
+        AsyncStreamer *async_streamer = dynamic_cast<AsyncStreamer *> (streamer);
+        if (async_streamer != NULL)
+        {
+            StreamerStats stats = async_streamer->get_stats ();
+            queue_depth += stats.queue_depth;
+            max_queue_depth = std::max (max_queue_depth, stats.max_queue_depth);
+            streamer_dropped += stats.dropped;
+        }
+    }
+    preset_locks[preset].unlock ();
+
+    double samples_per_second = 0.0;
+    double rate_window = 0.0;
+    if (preset_copy.rate_entries > 0)
+    {
+        auto now = std::chrono::steady_clock::now ().time_since_epoch ();
+        int oldest = (preset_copy.rate_next + RATE_HISTORY_SIZE - preset_copy.rate_entries) %
+            RATE_HISTORY_SIZE;
+        rate_window = std::chrono::duration<double> (now).count () - preset_copy.rate_times[oldest];
+        if (rate_window > 0.0)
+        {
+            samples_per_second =
+                (double)(preset_copy.pushed - preset_copy.rate_pushed[oldest]) / rate_window;
+        }
+    }
+    json push_latency_bounds = json::array ();
+    json push_latency_counts = json::array ();
+    for (int i = 0; i < PUSH_LATENCY_BUCKETS; i++)
+    {
+        // the last bucket has no upper bound
+        if (i < PUSH_LATENCY_BUCKETS - 1)
+        {
+            push_latency_bounds.push_back (1LL << i);
+        }
+        push_latency_counts.push_back (preset_copy.push_latency[i]);
+    }
+
+    json result;
+    result["preset"] = preset;
+    result["samples_pushed"] = preset_copy.pushed;
+    result["samples_overwritten"] = db_it->second->get_overwritten_count ();
+    result["buffer_count"] = db_it->second->get_data_count ();
+    result["buffer_high_water_mark"] = preset_copy.high_water_mark;
+    result["streamer_queue_depth"] = queue_depth;
+    result["streamer_max_queue_depth"] = max_queue_depth;
+    result["streamer_dropped"] = streamer_dropped;
+    result["push_latency_us_bounds"] = push_latency_bounds;
+    result["push_latency_counts"] = push_latency_counts;
+    result["package_gaps"] = preset_copy.package_gaps;
+    result["packages_lost"] = preset_copy.lost_packages;
+    result["package_wraparounds"] = preset_copy.wraparounds;
+    result["package_duplicates"] = preset_copy.duplicates;
+    result["placeholders_inserted"] = preset_copy.placeholders;
+    result["frames_received"] = preset_copy.frames.received;
+    result["frame_gaps"] = preset_copy.frames.gaps;
+    result["frames_lost"] = preset_copy.frames.lost;
+    result["frames_out_of_order"] = preset_copy.frames.out_of_order;
+    result["frames_invalid"] = preset_copy.frames.invalid;
+    result["frame_sender_restarts"] = preset_copy.frames.restarts;
+    result["frame_delay_avg"] = (preset_copy.frames.received > 0) ?
+        preset_copy.frames.delay_sum / preset_copy.frames.received :
+        0.0;
+    result["samples_per_second"] = samples_per_second;
+    result["rate_window_seconds"] = rate_window;
+    result["preset_lock_contentions"] = preset_locks[preset].get_contentions ();
+    metrics = result.dump ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::find_reader (const char *reader_name, int preset, ReaderCursor **reader)
+{
+    if ((reader_name == NULL) || (reader_name[0] == '\0'))
+    {
+        safe_logger (spdlog::level::err, "reader name is empty");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    auto preset_it = readers.find (preset);
+    if (preset_it == readers.end ())
+    {
+        safe_logger (spdlog::level::err, "reader {} is not registered", reader_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    auto reader_it = preset_it->second.find (reader_name);
+    if (reader_it == preset_it->second.end ())
+    {
+        safe_logger (spdlog::level::err, "reader {} is not registered", reader_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    *reader = &reader_it->second;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::register_reader (const char *reader_name, int preset)
+{
+    if (preset_descrs.find (preset) == preset_descrs.end ())
+    {
+        safe_logger (spdlog::level::err, "invalid preset");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((reader_name == NULL) || (reader_name[0] == '\0'))
+    {
+        safe_logger (spdlog::level::err, "reader name is empty");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::map<std::string, ReaderCursor> &preset_readers = readers[preset];
+    if (preset_readers.find (reader_name) != preset_readers.end ())
+    {
+        safe_logger (spdlog::level::err, "reader {} already registered", reader_name);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    ReaderCursor reader;
+    // readers registered before start_stream get everything from the new buffer
+    auto db_it = dbs.find (preset);
+    if ((db_it != dbs.end ()) && (db_it->second != NULL))
+    {
+        reader.position = db_it->second->get_write_position ();
+    }
+    preset_readers[reader_name] = reader;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::unregister_reader (const char *reader_name, int preset)
+{
+    ReaderCursor *reader = NULL;
+    int res = find_reader (reader_name, preset, &reader);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    readers[preset].erase (reader_name);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::read_since_cursor (
+    const char *reader_name, int max_samples, int preset, double *data_buf, int *returned_samples)
+{
+    if ((!data_buf) || (!returned_samples) || (max_samples < 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    ReaderCursor *reader = NULL;
+    int res = find_reader (reader_name, preset, &reader);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    auto db_it = dbs.find (preset);
+    if (db_it == dbs.end ())
+    {
+        safe_logger (spdlog::level::err,
+            "stream is not started or no preset: {} found for this board", preset);
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if (!db_it->second)
+    {
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+
+    uint64_t skipped = 0;
+    *returned_samples = (int)db_it->second->get_data_by_channels_since (
+        &reader->position, (size_t)max_samples, data_buf, &skipped);
+    if (skipped > 0)
+    {
+        reader->overflow += skipped;
+        safe_logger (spdlog::level::warn, "reader {} lost {} packages", reader_name, skipped);
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int Board::get_reader_stats (const char *reader_name, int preset, int *lag, int *overflow)
+{
+    if ((!lag) || (!overflow))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    ReaderCursor *reader = NULL;
+    int res = find_reader (reader_name, preset, &reader);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    uint64_t available = 0;
+    uint64_t skipped = 0;
+    auto db_it = dbs.find (preset);
+    if ((db_it != dbs.end ()) && (db_it->second != NULL))
+    {
+        available = db_it->second->get_data_count_since (reader->position, &skipped);
+    }
+    // packages which are already overwritten are reported as lost before the next read
+    uint64_t lost = reader->overflow + skipped;
+    *lag = (int)available;
+    *overflow = (int)std::min (lost, (uint64_t)std::numeric_limits<int>::max ());
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
 
-    for (int i = 0; i < data_count; i++)
+void Board::parse_presets ()
+{
+    preset_descrs.clear ();
+    int presets[3] = {(int)BrainFlowPresets::DEFAULT_PRESET,
+        (int)BrainFlowPresets::AUXILIARY_PRESET, (int)BrainFlowPresets::ANCILLARY_PRESET};
+    for (int preset : presets)
     {
-        for (int j = 0; j < num_rows; j++)
+        auto preset_it = board_descr.find (preset_to_string (preset));
+        if (preset_it == board_descr.end ())
+        {
+            continue;
+        }
+        PresetDescr descr;
+        try
+        {
+            descr.name = preset_it->value ("name", std::string (""));
+            descr.num_rows = preset_it->value ("num_rows", 0);
+            descr.timestamp_channel = preset_it->value ("timestamp_channel", -1);
+            descr.marker_channel = preset_it->value ("marker_channel", -1);
+            descr.package_num_channel = preset_it->value ("package_num_channel", -1);
+            for (auto &el : preset_it->items ())
+            {
+                if ((el.value ().is_array ()) &&
+                    (el.key ().find ("_channels") != std::string::npos))
+                {
+                    descr.channels[el.key ()] = el.value ().get<std::vector<int>> ();
+                }
+            }
+        }
+        catch (json::exception &e)
         {
-            output_buf[j * data_count + i] = buf[i * num_rows + j];
+            safe_logger (spdlog::level::err, "invalid preset {}: {}", preset, e.what ());
+            continue;
         }
+        preset_descrs[preset] = descr;
     }
 }
 
-std::string Board::preset_to_string (int preset)
+const char *Board::preset_to_string (int preset)
 {
     if (preset == (int)BrainFlowPresets::DEFAULT_PRESET)
     {
@@ -535,3 +1200,67 @@ int Board::preset_to_int (std::string preset)
 
     return (int)BrainFlowPresets::DEFAULT_PRESET;
 }
+
+// empty result means FLOAT64 for all channels. Timestamps need double precision and markers are
+// stored exactly as user provided them, other channels are smaller
+std::vector<ChannelStorage> Board::get_channel_storage (int preset)
+{
+    std::vector<ChannelStorage> storage;
+    auto descr_it = preset_descrs.find (preset);
+    if ((params.buffer_storage == (int)BufferStorageTypes::FLOAT64) ||
+        (descr_it == preset_descrs.end ()))
+    {
+        return storage;
+    }
+    const PresetDescr &descr = descr_it->second;
+    storage.resize (descr.num_rows, ChannelStorage (DataBufferStorage::FLOAT32));
+    if (params.buffer_storage == (int)BufferStorageTypes::RAW_INT32)
+    {
+        for (auto &scale : raw_scales[preset])
+        {
+            if ((scale.first >= 0) && (scale.first < descr.num_rows) && (scale.second > 0))
+            {
+                storage[scale.first] = ChannelStorage (DataBufferStorage::INT32, scale.second);
+            }
+        }
+    }
+    if (descr.timestamp_channel >= 0)
+    {
+        storage[descr.timestamp_channel] = ChannelStorage (DataBufferStorage::FLOAT64);
+    }
+    if (descr.marker_channel >= 0)
+    {
+        storage[descr.marker_channel] = ChannelStorage (DataBufferStorage::FLOAT64);
+    }
+    // boards like galea put pc and device timestamps to other channels, float32 breaks them
+    auto other_it = descr.channels.find ("other_channels");
+    if (other_it != descr.channels.end ())
+    {
+        for (int channel : other_it->second)
+        {
+            if ((channel >= 0) && (channel < descr.num_rows))
+            {
+                storage[channel] = ChannelStorage (DataBufferStorage::FLOAT64);
+            }
+        }
+    }
+    return storage;
+}
+
+void Board::set_raw_scales (const std::string &channels, double scale, int preset)
+{
+    auto descr_it = preset_descrs.find (preset);
+    if (descr_it == preset_descrs.end ())
+    {
+        return;
+    }
+    auto channels_it = descr_it->second.channels.find (channels);
+    if (channels_it == descr_it->second.channels.end ())
+    {
+        return;
+    }
+    for (int channel : channels_it->second)
+    {
+        raw_scales[preset][channel] = scale;
+    }
+}
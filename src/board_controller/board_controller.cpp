@@ -7,12 +7,15 @@
 #endif
 
 #include <algorithm>
+#include <climits>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string.h>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "aavaa_v3.h"
 #include "ant_neuro.h"
@@ -50,6 +53,8 @@
 #include "notion_osc.h"
 #include "ntl_wifi.h"
 #include "playback_file_board.h"
+#include "rw_lock.h"
+#include "shared_memory_board.h"
 #include "streaming_board.h"
 #include "synthetic_board.h"
 #include "unicorn_board.h"
@@ -59,22 +64,57 @@
 using json = nlohmann::json;
 
 
-std::map<std::pair<int, struct BrainFlowInputParams>, std::shared_ptr<Board>> boards;
-std::mutex mutex;
+struct BoardSession
+{
+    std::pair<int, struct BrainFlowInputParams> key;
+    std::shared_ptr<Board> board;
+    std::mutex lock; // serializes calls to this board, other sessions are not affected
+    bool released;   // guarded by lock, set by release, calls in flight see it after lookup
+
+    BoardSession (std::pair<int, struct BrainFlowInputParams> key, std::shared_ptr<Board> board)
+        : key (key), board (board), released (false)
+    {
+    }
+};
+
+// registry_lock guards only these maps and is held for lookups, never during board calls
+std::map<std::pair<int, struct BrainFlowInputParams>, int> boards; // session handles by key
+std::unordered_map<int, std::shared_ptr<BoardSession>> sessions;
+int last_session_handle = 0;
+RWLock registry_lock;
+// serializes prepare and release so the same device can not be opened twice
+std::mutex lifecycle_mutex;
+std::mutex logger_mutex;
 
 std::pair<int, struct BrainFlowInputParams> get_key (
     int board_id, struct BrainFlowInputParams params);
 static int check_board_session (int board_id, const char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error = true);
+    int &session_handle, bool log_error = true);
 static int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params);
+static int lookup_session_handle (int board_id, const char *json_brainflow_input_params,
+    int &session_handle, bool log_error = true);
+static int get_next_session_handle ();
+static std::shared_ptr<BoardSession> find_session (int session_handle);
+static void delete_data_callbacks (std::vector<Streamer *> &callbacks);
 
 
 int prepare_session (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int session_handle = 0;
+    return prepare_session_with_handle (board_id, json_brainflow_input_params, &session_handle);
+}
+
+int prepare_session_with_handle (
+    int board_id, const char *json_brainflow_input_params, int *session_handle)
+{
+    if (session_handle == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::lock_guard<std::mutex> lifecycle_lock (lifecycle_mutex);
 
-    Board::board_logger->info ("incoming json: {}", json_brainflow_input_params);
+    Board::get_board_logger ()->info ("incoming json: {}", json_brainflow_input_params);
     struct BrainFlowInputParams params;
     int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
@@ -83,9 +123,14 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
     }
 
     std::pair<int, struct BrainFlowInputParams> key = get_key (board_id, params);
-    if (boards.find (key) != boards.end ())
+    bool exists = false;
+    {
+        SharedLockGuard lock (registry_lock);
+        exists = (boards.find (key) != boards.end ());
+    }
+    if (exists)
     {
-        Board::board_logger->error (
+        Board::get_board_logger ()->error (
             "Board with id {} and the same config already exists", board_id);
         return (int)BrainFlowExitCodes::ANOTHER_BOARD_IS_CREATED_ERROR;
     }
@@ -93,6 +138,9 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
     std::shared_ptr<Board> board = NULL;
     switch (static_cast<BoardIds> (board_id))
     {
+        case BoardIds::SHARED_MEMORY_BOARD:
+            board = std::shared_ptr<Board> (new SharedMemoryBoard (params));
+            break;
         case BoardIds::PLAYBACK_FILE_BOARD:
             board = std::shared_ptr<Board> (new PlaybackFileBoard (params));
             break;
@@ -280,7 +328,7 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
         default:
             return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
-    Board::board_logger->trace ("Board object created {}", board->get_board_id ());
+    Board::get_board_logger ()->trace ("Board object created {}", board->get_board_id ());
     res = board->prepare_session ();
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
@@ -288,192 +336,399 @@ int prepare_session (int board_id, const char *json_brainflow_input_params)
     }
     else
     {
-        boards[key] = board;
+        // board is prepared without registry lock, other sessions keep working meanwhile
+        std::lock_guard<RWLock> lock (registry_lock);
+        int handle = get_next_session_handle ();
+        boards[key] = handle;
+        sessions[handle] = std::make_shared<BoardSession> (key, board);
+        *session_handle = handle;
     }
     return res;
 }
 
-int is_prepared (int *prepared, int board_id, const char *json_brainflow_input_params)
+int get_session_handle (
+    int *session_handle, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
-    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    if (session_handle == NULL)
     {
-        *prepared = 1;
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
+    return lookup_session_handle (board_id, json_brainflow_input_params, *session_handle, false);
+}
+
+int is_prepared (int *prepared, int board_id, const char *json_brainflow_input_params)
+{
+    int session_handle = 0;
+    int res = get_session_handle (&session_handle, board_id, json_brainflow_input_params);
     if (res == (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR)
     {
         *prepared = 0;
-        res = (int)BrainFlowExitCodes::STATUS_OK;
+        return (int)BrainFlowExitCodes::STATUS_OK;
     }
-    return res;
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return is_prepared_by_handle (prepared, session_handle);
 }
 
 int start_stream (int buffer_size, const char *streamer_params, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->start_stream (buffer_size, streamer_params);
+    return start_stream_by_handle (buffer_size, streamer_params, session_handle);
 }
 
 int stop_stream (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->stop_stream ();
+    return stop_stream_by_handle (session_handle);
 }
 
 int insert_marker (double value, int preset, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->insert_marker (value, preset);
+    return insert_marker_by_handle (value, preset, session_handle);
 }
 
 int release_session (int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    res = board_it->second->release_session ();
-    boards.erase (board_it);
-    return res;
+    return release_session_by_handle (session_handle);
 }
 
 int get_current_board_data (int num_samples, int preset, double *data_buf, int *returned_samples,
     int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_current_board_data (
-        num_samples, preset, data_buf, returned_samples);
+    return get_current_board_data_by_handle (
+        num_samples, preset, data_buf, returned_samples, session_handle);
 }
 
 int get_board_data_count (
     int preset, int *result, int board_id, const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data_count (preset, result);
+    return get_board_data_count_by_handle (preset, result, session_handle);
 }
 
 int get_board_data (int data_count, int preset, double *data_buf, int board_id,
     const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return get_board_data_by_handle (data_count, preset, data_buf, session_handle);
+}
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
+int wait_for_board_data (int preset, int min_samples, int timeout_ms, int *result, int board_id,
+    const char *json_brainflow_input_params)
+{
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
         return res;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->get_board_data (data_count, preset, data_buf);
+    return wait_for_board_data_by_handle (preset, min_samples, timeout_ms, result, session_handle);
 }
 
-int set_log_level_board_controller (int log_level)
+int config_board (const char *config, char *response, int *response_len, int board_id,
+    const char *json_brainflow_input_params)
 {
-    std::lock_guard<std::mutex> lock (mutex);
-    return Board::set_log_level (log_level);
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return config_board_by_handle (config, response, response_len, session_handle);
 }
 
-int log_message_board_controller (int log_level, char *log_message)
+int config_board_with_bytes (
+    const char *bytes, int len, int board_id, const char *json_brainflow_input_params)
 {
-    // its a method for loggging from high level api dont add it to Board class since it should not
-    // be used internally
-    std::lock_guard<std::mutex> lock (mutex);
-    if (log_level < 0)
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        Board::board_logger->warn ("log level should be >= 0");
-        log_level = 0;
+        return res;
     }
-    else if (log_level > 6)
+    return config_board_with_bytes_by_handle (bytes, len, session_handle);
+}
+
+int add_streamer (
+    const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
+{
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
     {
-        Board::board_logger->warn ("log level should be <= 6");
-        log_level = 6;
+        return res;
+    }
+    return add_streamer_by_handle (streamer, preset, session_handle);
+}
+
+int delete_streamer (
+    const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
+{
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
     }
+    return delete_streamer_by_handle (streamer, preset, session_handle);
+}
 
-    Board::board_logger->log (spdlog::level::level_enum (log_level), "{}", log_message);
+int register_data_callback (brainflow_data_callback callback, void *user_data, int batch_size,
+    int preset, int board_id, const char *json_brainflow_input_params)
+{
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return register_data_callback_by_handle (
+        callback, user_data, batch_size, preset, session_handle);
+}
 
-    return (int)BrainFlowExitCodes::STATUS_OK;
+int unregister_data_callback (int preset, int board_id, const char *json_brainflow_input_params)
+{
+    int session_handle = 0;
+    int res = lookup_session_handle (board_id, json_brainflow_input_params, session_handle);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return unregister_data_callback_by_handle (preset, session_handle);
 }
 
-int set_log_file_board_controller (const char *log_file)
+int release_all_sessions ()
 {
-    std::lock_guard<std::mutex> lock (mutex);
-    return Board::set_log_file (log_file);
+    std::vector<Streamer *> callbacks;
+    {
+        std::lock_guard<std::mutex> lifecycle_lock (lifecycle_mutex);
+
+        std::unordered_map<int, std::shared_ptr<BoardSession>> released_sessions;
+        {
+            std::lock_guard<RWLock> lock (registry_lock);
+            released_sessions.swap (sessions);
+            boards.clear ();
+        }
+        for (auto &session : released_sessions)
+        {
+            std::lock_guard<std::mutex> lock (session.second->lock);
+            session.second->released = true;
+            std::vector<Streamer *> detached = session.second->board->detach_data_callbacks ();
+            callbacks.insert (callbacks.end (), detached.begin (), detached.end ());
+            session.second->board->release_session ();
+        }
+    }
+    delete_data_callbacks (callbacks);
+
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int java_set_jnienv (JNIEnv *java_jnienv)
+int is_prepared_by_handle (int *prepared, int session_handle)
 {
-    Board::java_jnienv = java_jnienv;
+    if (prepared == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    *prepared = (find_session (session_handle) != NULL) ? 1 : 0; // released ones are removed
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int config_board (const char *config, char *response, int *response_len, int board_id,
-    const char *json_brainflow_input_params)
+int start_stream_by_handle (int buffer_size, const char *streamer_params, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->start_stream (buffer_size, streamer_params);
+}
+
+int stop_stream_by_handle (int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->stop_stream ();
+}
+
+int insert_marker_by_handle (double value, int preset, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->insert_marker (value, preset);
+}
+
+int release_session_by_handle (int session_handle)
+{
+    std::vector<Streamer *> callbacks;
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    {
+        std::lock_guard<std::mutex> lifecycle_lock (lifecycle_mutex);
+
+        std::shared_ptr<BoardSession> session = NULL;
+        {
+            std::lock_guard<RWLock> lock (registry_lock);
+            auto session_it = sessions.find (session_handle);
+            if (session_it == sessions.end ())
+            {
+                return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+            }
+            session = session_it->second;
+            boards.erase (session->key);
+            sessions.erase (session_it);
+        }
+        // waits for calls in flight on this session only
+        std::lock_guard<std::mutex> lock (session->lock);
+        session->released = true;
+        callbacks = session->board->detach_data_callbacks ();
+        res = session->board->release_session ();
+    }
+    delete_data_callbacks (callbacks);
+    return res;
+}
+
+int get_current_board_data_by_handle (
+    int num_samples, int preset, double *data_buf, int *returned_samples, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_current_board_data (num_samples, preset, data_buf, returned_samples);
+}
+
+int get_board_data_count_by_handle (int preset, int *result, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_board_data_count (preset, result);
+}
+
+int get_board_data_by_handle (int data_count, int preset, double *data_buf, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_board_data (data_count, preset, data_buf);
+}
+
+int wait_for_board_data_by_handle (
+    int preset, int min_samples, int timeout_ms, int *result, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    // session lock is not held during waiting, board has its own sync for waiters and
+    // shared_ptr keeps board alive even if session is released from another thread
+    return session->board->wait_for_board_data (preset, min_samples, timeout_ms, result);
+}
+
+int config_board_by_handle (
+    const char *config, char *response, int *response_len, int session_handle)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if ((config == NULL) || (response == NULL) || (response_len == NULL))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
     {
-        return res;
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-    auto board_it = boards.find (key);
     std::string conf = config;
     std::string resp = "";
-    res = board_it->second->config_board (conf, resp);
+    int res = session->board->config_board (conf, resp);
     if (res == (int)BrainFlowExitCodes::STATUS_OK)
     {
         *response_len = (int)resp.length ();
@@ -482,74 +737,236 @@ int config_board (const char *config, char *response, int *response_len, int boa
     return res;
 }
 
-int config_board_with_bytes (
-    const char *bytes, int len, int board_id, const char *json_brainflow_input_params)
+int config_board_with_bytes_by_handle (const char *bytes, int len, int session_handle)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if ((bytes == NULL) || (len < 1))
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
     {
-        return res;
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->config_board_with_bytes (bytes, len);
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->config_board_with_bytes (bytes, len);
 }
 
-int add_streamer (
-    const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
+int add_streamer_by_handle (const char *streamer, int preset, int session_handle)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if (streamer == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
     {
-        return res;
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->add_streamer (streamer, preset);
+    return session->board->add_streamer (streamer, preset);
 }
 
-int delete_streamer (
-    const char *streamer, int preset, int board_id, const char *json_brainflow_input_params)
+int delete_streamer_by_handle (const char *streamer, int preset, int session_handle)
 {
-    std::lock_guard<std::mutex> lock (mutex);
     if (streamer == NULL)
     {
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
-    std::pair<int, struct BrainFlowInputParams> key;
-    int res = check_board_session (board_id, json_brainflow_input_params, key, false);
-    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
     {
-        return res;
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
-    auto board_it = boards.find (key);
-    return board_it->second->delete_streamer (streamer, preset);
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->delete_streamer (streamer, preset);
 }
 
-int release_all_sessions ()
+int register_data_callback_by_handle (brainflow_data_callback callback, void *user_data,
+    int batch_size, int preset, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->register_data_callback (callback, user_data, batch_size, preset);
+}
+
+int unregister_data_callback_by_handle (int preset, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    Streamer *streamer = NULL;
+    {
+        std::lock_guard<std::mutex> lock (session->lock);
+        if (session->released)
+        {
+            return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+        }
+        int res = session->board->detach_data_callback (preset, &streamer);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    std::vector<Streamer *> callbacks (1, streamer);
+    delete_data_callbacks (callbacks);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int register_reader_by_handle (const char *reader_name, int preset, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->register_reader (reader_name, preset);
+}
+
+int unregister_reader_by_handle (const char *reader_name, int preset, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->unregister_reader (reader_name, preset);
+}
+
+int read_since_cursor_by_handle (const char *reader_name, int max_samples, int preset,
+    double *data_buf, int *returned_samples, int session_handle)
 {
-    std::lock_guard<std::mutex> lock (mutex);
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->read_since_cursor (
+        reader_name, max_samples, preset, data_buf, returned_samples);
+}
 
-    for (auto it = boards.begin (), next_it = it; it != boards.end (); it = next_it)
+int get_reader_stats_by_handle (
+    const char *reader_name, int preset, int *lag, int *overflow, int session_handle)
+{
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
     {
-        ++next_it;
-        it->second->release_session ();
-        boards.erase (it);
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
+    std::lock_guard<std::mutex> lock (session->lock);
+    if (session->released)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    return session->board->get_reader_stats (reader_name, preset, lag, overflow);
+}
 
+int get_board_metrics_by_handle (int preset, char *metrics, int *len, int session_handle)
+{
+    if ((metrics == NULL) || (len == NULL))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::shared_ptr<BoardSession> session = find_session (session_handle);
+    if (session == NULL)
+    {
+        return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+    }
+    std::string result;
+    {
+        std::lock_guard<std::mutex> lock (session->lock);
+        if (session->released)
+        {
+            return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
+        }
+        int res = session->board->get_board_metrics (preset, result);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+    }
+    strcpy (metrics, result.c_str ());
+    *len = (int)result.size ();
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int set_log_level_board_controller (int log_level)
+{
+    std::lock_guard<std::mutex> lock (logger_mutex);
+    return Board::set_log_level (log_level);
+}
+
+int log_message_board_controller (int log_level, char *log_message)
+{
+    // its a method for loggging from high level api dont add it to Board class since it should not
+    // be used internally
+    std::lock_guard<std::mutex> lock (logger_mutex);
+    std::shared_ptr<spdlog::logger> logger = Board::get_board_logger ();
+    if (log_level < 0)
+    {
+        logger->warn ("log level should be >= 0");
+        log_level = 0;
+    }
+    else if (log_level > 6)
+    {
+        logger->warn ("log level should be <= 6");
+        log_level = 6;
+    }
+
+    logger->log (spdlog::level::level_enum (log_level), "{}", log_message);
+
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int set_log_file_board_controller (const char *log_file)
+{
+    std::lock_guard<std::mutex> lock (logger_mutex);
+    return Board::set_log_file (log_file);
+}
+
+int java_set_jnienv (JNIEnv *java_jnienv)
+{
+    Board::java_jnienv = java_jnienv;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -572,7 +989,7 @@ std::pair<int, struct BrainFlowInputParams> get_key (
 }
 
 int check_board_session (int board_id, const char *json_brainflow_input_params,
-    std::pair<int, struct BrainFlowInputParams> &key, bool log_error)
+    int &session_handle, bool log_error)
 {
     struct BrainFlowInputParams params;
     int res = string_to_brainflow_input_params (json_brainflow_input_params, &params);
@@ -581,20 +998,61 @@ int check_board_session (int board_id, const char *json_brainflow_input_params,
         return res;
     }
 
-    key = get_key (board_id, params);
-
-    if (boards.find (key) == boards.end ())
+    auto board_it = boards.find (get_key (board_id, params));
+    if (board_it == boards.end ())
     {
         if (log_error)
         {
-            Board::board_logger->error (
-                "Board with id {} and port provided config is not created", key.first);
+            Board::get_board_logger ()->error (
+                "Board with id {} and port provided config is not created", board_id);
         }
         return (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR;
     }
+    session_handle = board_it->second;
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int lookup_session_handle (
+    int board_id, const char *json_brainflow_input_params, int &session_handle, bool log_error)
+{
+    SharedLockGuard lock (registry_lock);
+    return check_board_session (
+        board_id, json_brainflow_input_params, session_handle, log_error);
+}
+
+// handles are not reused until overflow, so stale handle doesnt point to another session
+// called with exclusive registry lock
+int get_next_session_handle ()
+{
+    do
+    {
+        last_session_handle = (last_session_handle == INT_MAX) ? 1 : last_session_handle + 1;
+    } while (sessions.find (last_session_handle) != sessions.end ());
+    return last_session_handle;
+}
+
+// callback streamers deliver the last batch in destructor, it's called without session and
+// lifecycle locks since user callback may call board controller api, even for the same session
+void delete_data_callbacks (std::vector<Streamer *> &callbacks)
+{
+    for (Streamer *streamer : callbacks)
+    {
+        delete streamer;
+    }
+    callbacks.clear ();
+}
+
+std::shared_ptr<BoardSession> find_session (int session_handle)
+{
+    SharedLockGuard lock (registry_lock);
+    auto session_it = sessions.find (session_handle);
+    if (session_it == sessions.end ())
+    {
+        return NULL;
+    }
+    return session_it->second;
+}
+
 int string_to_brainflow_input_params (
     const char *json_brainflow_input_params, struct BrainFlowInputParams *params)
 {
@@ -618,11 +1076,16 @@ int string_to_brainflow_input_params (
         params->file_aux = config["file_aux"];
         params->file_anc = config["file_anc"];
         params->master_board = config["master_board"];
+        // optional, not all bindings send it
+        params->buffer_storage =
+            config.value ("buffer_storage", (int)BufferStorageTypes::FLOAT64);
+        params->package_num_check =
+            config.value ("package_num_check", (int)PackageNumCheckTypes::OFF);
         return (int)BrainFlowExitCodes::STATUS_OK;
     }
     catch (json::exception &e)
     {
-        Board::board_logger->error ("invalid input json, {}", e.what ());
+        Board::get_board_logger ()->error ("invalid input json, {}", e.what ());
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 }
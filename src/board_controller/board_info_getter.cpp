@@ -1,4 +1,3 @@
-#include <fstream>
 #include <set>
 #include <string.h>
 #include <string>
@@ -10,211 +9,189 @@
 #include "brainflow_constants.h"
 
 
-static int get_single_value (
-    int board_id, int preset, const char *param_name, int *value, bool use_logger = true);
-static int get_string_value (int board_id, int preset, const char *param_name, char *string,
+static const BoardPresetDescr *get_preset_descr (int board_id, int preset, int *res);
+static int get_single_value (int board_id, int preset, const char *param_name,
+    int BoardPresetDescr::*field, int *value, bool use_logger = true);
+static int get_string_value (int board_id, int preset, const char *param_name,
+    const char *BoardPresetDescr::*field, char *string, int *len, bool use_logger = true);
+static int get_array_value (int board_id, int preset, BoardChannelTypes type, int *output_array,
     int *len, bool use_logger = true);
-static int get_array_value (int board_id, int preset, const char *param_name, int *output_array,
-    int *len, bool use_logger = true);
-static std::string get_preset_str (int preset);
+static void log_missing_field (int board_id, int preset, const char *param_name);
 
 int get_board_presets (int board_id, int *presets, int *len)
 {
+    // same order as before, presets were sorted by name
+    const int ordered_presets[3] = {(int)BrainFlowPresets::ANCILLARY_PRESET,
+        (int)BrainFlowPresets::AUXILIARY_PRESET, (int)BrainFlowPresets::DEFAULT_PRESET};
     int counter = 0;
-    try
+    for (int i = 0; i < 3; i++)
     {
-        for (auto &el :
-            boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)].items ())
-        {
-            if (el.key () == "default")
-            {
-                presets[counter++] = (int)BrainFlowPresets::DEFAULT_PRESET;
-            }
-            else if (el.key () == "auxiliary")
-            {
-                presets[counter++] = (int)BrainFlowPresets::AUXILIARY_PRESET;
-            }
-            else if (el.key () == "ancillary")
-            {
-                presets[counter++] = (int)BrainFlowPresets::ANCILLARY_PRESET;
-            }
-            else
-            {
-                Board::board_logger->warn ("unknown preset found in json: {}", el.key ());
-            }
-        }
-        if (counter == 0)
-        {
-            Board::board_logger->error ("no presets found"); // more likely will never be executed
-            return (int)BrainFlowExitCodes::GENERAL_ERROR;
-        }
-        else
+        if (get_board_preset_descr (board_id, ordered_presets[i]) != NULL)
         {
-            *len = counter;
+            presets[counter++] = ordered_presets[i];
         }
-        return (int)BrainFlowExitCodes::STATUS_OK;
     }
-    catch (json::exception &e)
+    if (counter == 0)
     {
-        Board::board_logger->error (
-            "Failed to get board info: {}, usually it means that you provided wrong board id",
-            e.what ());
-        return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+        Board::get_board_logger ()->error ("no presets found for board {}", board_id);
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
+    *len = counter;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int get_board_descr (int board_id, int preset, char *board_descr, int *len)
 {
-    std::string preset_str = get_preset_str (preset);
-    try
-    {
-        std::string res =
-            boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)][preset_str]
-                .dump ();
-        if ((res.empty ()) || (res == "null"))
-        {
-            return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
-        }
-        else
-        {
-            strcpy (board_descr, res.c_str ());
-            *len = (int)strlen (res.c_str ());
-            return (int)BrainFlowExitCodes::STATUS_OK;
-        }
-    }
-    catch (json::exception &e)
+    const BoardPresetDescr *descr = get_board_preset_descr (board_id, preset);
+    if (descr == NULL)
     {
-        Board::board_logger->error (
-            "Failed to get board info: {}, usually it means that you provided wrong board id",
-            e.what ());
+        Board::get_board_logger ()->error (
+            "Failed to get board info for board {} and preset {}, usually it means that you "
+            "provided wrong board id",
+            board_id, preset);
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
+    std::string res = get_board_preset_json (descr).dump ();
+    strcpy (board_descr, res.c_str ());
+    *len = (int)strlen (res.c_str ());
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 int get_sampling_rate (int board_id, int preset, int *sampling_rate)
 {
-    return get_single_value (board_id, preset, "sampling_rate", sampling_rate);
+    return get_single_value (
+        board_id, preset, "sampling_rate", &BoardPresetDescr::sampling_rate, sampling_rate);
 }
 
 int get_package_num_channel (int board_id, int preset, int *package_num_channel)
 {
-    return get_single_value (board_id, preset, "package_num_channel", package_num_channel);
+    return get_single_value (board_id, preset, "package_num_channel",
+        &BoardPresetDescr::package_num_channel, package_num_channel);
 }
 
 int get_marker_channel (int board_id, int preset, int *marker_channel)
 {
-    return get_single_value (board_id, preset, "marker_channel", marker_channel);
+    return get_single_value (
+        board_id, preset, "marker_channel", &BoardPresetDescr::marker_channel, marker_channel);
 }
 
 int get_battery_channel (int board_id, int preset, int *battery_channel)
 {
-    return get_single_value (board_id, preset, "battery_channel", battery_channel);
+    return get_single_value (
+        board_id, preset, "battery_channel", &BoardPresetDescr::battery_channel, battery_channel);
 }
 
 int get_num_rows (int board_id, int preset, int *num_rows)
 {
-    return get_single_value (board_id, preset, "num_rows", num_rows);
+    return get_single_value (
+        board_id, preset, "num_rows", &BoardPresetDescr::num_rows, num_rows);
 }
 
 int get_timestamp_channel (int board_id, int preset, int *timestamp_channel)
 {
-    return get_single_value (board_id, preset, "timestamp_channel", timestamp_channel);
+    return get_single_value (board_id, preset, "timestamp_channel",
+        &BoardPresetDescr::timestamp_channel, timestamp_channel);
 }
 
 int get_eeg_names (int board_id, int preset, char *eeg_names, int *len)
 {
-    return get_string_value (board_id, preset, "eeg_names", eeg_names, len);
+    return get_string_value (
+        board_id, preset, "eeg_names", &BoardPresetDescr::eeg_names, eeg_names, len);
 }
 
 int get_device_name (int board_id, int preset, char *name, int *len)
 {
-    return get_string_value (board_id, preset, "name", name, len);
+    return get_string_value (
+        board_id, preset, "name", &BoardPresetDescr::name, name, len);
 }
 
 int get_eeg_channels (int board_id, int preset, int *eeg_channels, int *len)
 {
-    return get_array_value (board_id, preset, "eeg_channels", eeg_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::EEG, eeg_channels, len);
 }
 
 int get_emg_channels (int board_id, int preset, int *emg_channels, int *len)
 {
-    return get_array_value (board_id, preset, "emg_channels", emg_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::EMG, emg_channels, len);
 }
 
 int get_ecg_channels (int board_id, int preset, int *ecg_channels, int *len)
 {
-    return get_array_value (board_id, preset, "ecg_channels", ecg_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::ECG, ecg_channels, len);
 }
 
 int get_eog_channels (int board_id, int preset, int *eog_channels, int *len)
 {
-    return get_array_value (board_id, preset, "eog_channels", eog_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::EOG, eog_channels, len);
 }
 
 int get_eda_channels (int board_id, int preset, int *eda_channels, int *len)
 {
-    return get_array_value (board_id, preset, "eda_channels", eda_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::EDA, eda_channels, len);
 }
 
 int get_ppg_channels (int board_id, int preset, int *ppg_channels, int *len)
 {
-    return get_array_value (board_id, preset, "ppg_channels", ppg_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::PPG, ppg_channels, len);
 }
 
 int get_accel_channels (int board_id, int preset, int *accel_channels, int *len)
 {
-    return get_array_value (board_id, preset, "accel_channels", accel_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::ACCEL, accel_channels, len);
 }
 
 int get_rotation_channels (int board_id, int preset, int *rotation_channels, int *len)
 {
-    return get_array_value (board_id, preset, "rotation_channels", rotation_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::ROTATION, rotation_channels, len);
 }
 
 int get_analog_channels (int board_id, int preset, int *analog_channels, int *len)
 {
-    return get_array_value (board_id, preset, "analog_channels", analog_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::ANALOG, analog_channels, len);
 }
 
 int get_gyro_channels (int board_id, int preset, int *gyro_channels, int *len)
 {
-    return get_array_value (board_id, preset, "gyro_channels", gyro_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::GYRO, gyro_channels, len);
 }
 
 int get_other_channels (int board_id, int preset, int *other_channels, int *len)
 {
-    return get_array_value (board_id, preset, "other_channels", other_channels, len);
+    return get_array_value (board_id, preset, BoardChannelTypes::OTHER, other_channels, len);
 }
 
 int get_temperature_channels (int board_id, int preset, int *temperature_channels, int *len)
 {
-    return get_array_value (board_id, preset, "temperature_channels", temperature_channels, len);
+    return get_array_value (
+        board_id, preset, BoardChannelTypes::TEMPERATURE, temperature_channels, len);
 }
 
 int get_resistance_channels (int board_id, int preset, int *resistance_channels, int *len)
 {
-    return get_array_value (board_id, preset, "resistance_channels", resistance_channels, len);
+    return get_array_value (
+        board_id, preset, BoardChannelTypes::RESISTANCE, resistance_channels, len);
 }
 
 int get_magnetometer_channels (int board_id, int preset, int *magnetometer_channels, int *len)
 {
-    return get_array_value (board_id, preset, "magnetometer_channels", magnetometer_channels, len);
+    return get_array_value (
+        board_id, preset, BoardChannelTypes::MAGNETOMETER, magnetometer_channels, len);
 }
 
 int get_exg_channels (int board_id, int preset, int *exg_channels, int *len)
 {
     std::set<int> unique_channels;
-    const char *data_types[4] = {"eeg_channels", "emg_channels", "ecg_channels", "eog_channels"};
-    for (int i = 0; i < 4; i++)
+    const BoardPresetDescr *descr = get_board_preset_descr (board_id, preset);
+    if (descr != NULL)
     {
-        int channels[4096] = {0};
-        int channels_len = 0;
-        int res = get_array_value (board_id, preset, data_types[i], channels, &channels_len, false);
-        if (res == (int)BrainFlowExitCodes::STATUS_OK)
+        const BoardChannelTypes types[4] = {BoardChannelTypes::EEG, BoardChannelTypes::EMG,
+            BoardChannelTypes::ECG, BoardChannelTypes::EOG};
+        for (int i = 0; i < 4; i++)
         {
-            for (int i = 0; i < channels_len; i++)
+            const BoardChannels *channels = get_board_channels (descr, types[i]);
+            if (channels != NULL)
             {
-                unique_channels.insert (channels[i]);
+                unique_channels.insert (channels->values, channels->values + channels->len);
             }
         }
     }
@@ -232,116 +209,95 @@ int get_exg_channels (int board_id, int preset, int *exg_channels, int *len)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-static int get_single_value (
-    int board_id, int preset, const char *param_name, int *value, bool use_logger)
+static const BoardPresetDescr *get_preset_descr (int board_id, int preset, int *res)
 {
-    std::string preset_str = get_preset_str (preset);
-    if (preset_str.empty ())
+    if ((preset != (int)BrainFlowPresets::DEFAULT_PRESET) &&
+        (preset != (int)BrainFlowPresets::AUXILIARY_PRESET) &&
+        (preset != (int)BrainFlowPresets::ANCILLARY_PRESET))
     {
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        Board::get_board_logger ()->error ("unknown preset");
+        *res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return NULL;
     }
-    try
+    const BoardPresetDescr *descr = get_board_preset_descr (board_id, preset);
+    *res = (descr == NULL) ? (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR :
+                             (int)BrainFlowExitCodes::STATUS_OK;
+    return descr;
+}
+
+static void log_missing_field (int board_id, int preset, const char *param_name)
+{
+    Board::get_board_logger ()->error (
+        "Failed to get board info: no {} for board {} and preset {}, usually it means that "
+        "device has no such channels, use get_board_descr method for the info about supported "
+        "channels",
+        param_name, board_id, preset);
+}
+
+static int get_single_value (int board_id, int preset, const char *param_name,
+    int BoardPresetDescr::*field, int *value, bool use_logger)
+{
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    const BoardPresetDescr *descr = get_preset_descr (board_id, preset, &res);
+    if (res == (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
     {
-        int val =
-            (int)boards_struct
-                .brainflow_boards_json["boards"][std::to_string (board_id)][preset_str][param_name];
-        *value = val;
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        return res;
     }
-    catch (json::exception &e)
+    if ((descr == NULL) || (descr->*field < 0))
     {
         if (use_logger)
         {
-            Board::board_logger->error (
-                "Failed to get board info: {}, usually it means that device has no such channels, "
-                "use get_board_descr method for the info about supported channels",
-                e.what ());
+            log_missing_field (board_id, preset, param_name);
         }
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
+    *value = descr->*field;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-static int get_array_value (
-    int board_id, int preset, const char *param_name, int *output_array, int *len, bool use_logger)
+static int get_array_value (int board_id, int preset, BoardChannelTypes type, int *output_array,
+    int *len, bool use_logger)
 {
-    std::string preset_str = get_preset_str (preset);
-    if (preset_str.empty ())
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    const BoardPresetDescr *descr = get_preset_descr (board_id, preset, &res);
+    if (res == (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
     {
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        return res;
     }
-    try
-    {
-        std::vector<int> values =
-            boards_struct
-                .brainflow_boards_json["boards"][std::to_string (board_id)][preset_str][param_name];
-        if (!values.empty ())
-        {
-            memcpy (output_array, &values[0], sizeof (int) * values.size ());
-        }
-        *len = (int)values.size ();
-        return (int)BrainFlowExitCodes::STATUS_OK;
-    }
-    catch (json::exception &e)
+    const BoardChannels *channels = (descr == NULL) ? NULL : get_board_channels (descr, type);
+    if (channels == NULL)
     {
         if (use_logger)
         {
-            Board::board_logger->error (
-                "Failed to get board info: {}, usually it means that device has no such channels, "
-                "use get_board_descr method for the info about supported channels",
-                e.what ());
+            std::string param_name =
+                std::string (get_board_channel_type_name (type)) + "_channels";
+            log_missing_field (board_id, preset, param_name.c_str ());
         }
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
+    memcpy (output_array, channels->values, sizeof (int) * channels->len);
+    *len = channels->len;
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-static int get_string_value (
-    int board_id, int preset, const char *param_name, char *string, int *len, bool use_logger)
+static int get_string_value (int board_id, int preset, const char *param_name,
+    const char *BoardPresetDescr::*field, char *string, int *len, bool use_logger)
 {
-    std::string preset_str = get_preset_str (preset);
-    if (preset_str.empty ())
-    {
-        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
-    }
-    try
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    const BoardPresetDescr *descr = get_preset_descr (board_id, preset, &res);
+    if (res == (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
     {
-        std::string val =
-            boards_struct
-                .brainflow_boards_json["boards"][std::to_string (board_id)][preset_str][param_name];
-        strcpy (string, val.c_str ());
-        *len = (int)strlen (val.c_str ());
-        return (int)BrainFlowExitCodes::STATUS_OK;
+        return res;
     }
-    catch (json::exception &e)
+    if ((descr == NULL) || (descr->*field == NULL))
     {
         if (use_logger)
         {
-            Board::board_logger->error (
-                "Failed to get board info: {}, usually it means that device has no such channels, "
-                "use get_board_descr method for the info about supported channels",
-                e.what ());
+            log_missing_field (board_id, preset, param_name);
         }
         return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
     }
+    strcpy (string, descr->*field);
+    *len = (int)strlen (descr->*field);
+    return (int)BrainFlowExitCodes::STATUS_OK;
 }
-
-static std::string get_preset_str (int preset)
-{
-    std::string preset_str = "";
-    if (preset == (int)BrainFlowPresets::DEFAULT_PRESET)
-    {
-        preset_str = "default";
-    }
-    else if (preset == (int)BrainFlowPresets::AUXILIARY_PRESET)
-    {
-        preset_str = "auxiliary";
-    }
-    else if (preset == (int)BrainFlowPresets::ANCILLARY_PRESET)
-    {
-        preset_str = "ancillary";
-    }
-    else
-    {
-        Board::board_logger->error ("unknown preset");
-    }
-    return preset_str;
-}
\ No newline at end of file
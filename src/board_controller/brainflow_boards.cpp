@@ -1,1087 +1,485 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "brainflow_boards.h"
+#include "brainflow_constants.h"
 
-// clang-format off
 
-BrainFlowBoards::BrainFlowBoards()
+// static array per unique channel list, identical lists of different boards share it
+template <int... channels>
+struct ChannelList
 {
+    static const int values[sizeof... (channels)];
+    static const int len = (int)sizeof... (channels);
+};
 
-    /* For all real boards there are four required fields:
-     *   name
-     *   num_rows
-     *   timestamp_channel
-     *   marker_channel
-     * Nice to set:
-     *   package_num
-     *   sampling_rate
-     * Everything else is optional and up to device
-    */
+template <int... channels>
+const int ChannelList<channels...>::values[sizeof... (channels)] = {channels...};
 
-    brainflow_boards_json = {
-        {"boards", {
-            {"-3", json::object()},
-            {"-2", json::object()},
-            {"-1", json::object()},
-            {"0", json::object()},
-            {"1", json::object()},
-            {"2", json::object()},
-            {"3", json::object()},
-            {"4", json::object()},
-            {"5", json::object()},
-            {"6", json::object()},
-            {"7", json::object()},
-            {"8", json::object()},
-            {"9", json::object()},
-            {"10", json::object()},
-            {"11", json::object()},
-            {"13", json::object()},
-            {"14", json::object()},
-            {"16", json::object()},
-            {"17", json::object()},
-            {"18", json::object()},
-            {"19", json::object()},
-            {"20", json::object()},
-            {"21", json::object()},
-            {"22", json::object()},
-            {"23", json::object()},
-            {"24", json::object()},
-            {"25", json::object()},
-            {"26", json::object()},
-            {"27", json::object()},
-            {"28", json::object()},
-            {"29", json::object()},
-            {"30", json::object()},
-            {"31", json::object()},
-            {"32", json::object()},
-            {"33", json::object()},
-            {"34", json::object()},
-            {"35", json::object()},
-            {"36", json::object()},
-            {"37", json::object()},
-            {"38", json::object()},
-            {"39", json::object()},
-            {"40", json::object()},
-            {"41", json::object()},
-            {"42", json::object()},
-            {"44", json::object()},
-            {"45", json::object()},
-            {"46", json::object()},
-            {"47", json::object()},
-            {"48", json::object()},
-            {"49", json::object()},
-            {"50", json::object()},
-            {"51", json::object()},
-            {"52", json::object()},
-            {"53", json::object()}
-        }
-    }};
+#define CHANNELS(...) ChannelList<__VA_ARGS__>::values, ChannelList<__VA_ARGS__>::len
 
-    // available presets are: default, auxiliary, ancillary, default is required, other presets are optional
-    brainflow_boards_json["boards"]["-3"]["default"] = {{"name", "PlayBack"}};
-    brainflow_boards_json["boards"]["-3"]["auxiliary"] = {{"name", "PlayBack"}};
-    brainflow_boards_json["boards"]["-3"]["ancillary"] = {{"name", "PlayBack"}};
-    brainflow_boards_json["boards"]["-2"]["default"] = {{"name", "Streaming"}};
-    brainflow_boards_json["boards"]["-2"]["auxiliary"] = {{"name", "Streaming"}};
-    brainflow_boards_json["boards"]["-2"]["ancillary"] = {{"name", "Streaming"}};
-    brainflow_boards_json["boards"]["-1"]["default"] =
-    {
-        {"name", "Synthetic"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"battery_channel", 29},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eeg_names", "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8,F5,F7,F3,F1,F2,F4,F6,F8"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"accel_channels", {17, 18, 19}},
-        {"gyro_channels", {20, 21, 22}},
-        {"eda_channels", {23}},
-        {"ppg_channels", {24, 25}},
-        {"temperature_channels", {26}},
-        {"resistance_channels", {27, 28}}
-    };
-    brainflow_boards_json["boards"]["-1"]["auxiliary"] =
-    {
-        {"name", "SyntheticAux"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"num_rows", 20},
-        {"other_channels", {14, 15, 16, 17}},
-        {"battery_channel", 1},
-        {"accel_channels", {2, 3, 4}},
-        {"gyro_channels", {5, 6, 7}},
-        {"eda_channels", {8}},
-        {"ppg_channels", {9, 10}},
-        {"temperature_channels", {11}},
-        {"resistance_channels", {12, 13}}
-    };
-    brainflow_boards_json["boards"]["0"]["default"] =
-    {
-        {"name", "Cyton"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 22},
-        {"marker_channel", 23},
-        {"num_rows", 24},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"accel_channels", {9, 10, 11}},
-        {"analog_channels", {19, 20, 21}},
-        {"other_channels", {12, 13, 14, 15, 16, 17, 18}}
-    };
-    brainflow_boards_json["boards"]["1"]["default"] =
-    {
-        {"name", "Ganglion"},
-        {"sampling_rate", 200},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 13},
-        {"marker_channel", 14},
-        {"num_rows", 15},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {1, 2, 3, 4}},
-        {"accel_channels", {5, 6, 7}},
-        {"resistance_channels", {8, 9, 10, 11, 12}}
-    };
-    brainflow_boards_json["boards"]["2"]["default"] =
-    {
-        {"name", "CytonDaisy"},
-        {"sampling_rate", 125},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2,F7,F8,F3,F4,T7,T8,P3,P4"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"accel_channels", {17, 18, 19}},
-        {"analog_channels", {27, 28, 29}},
-        {"other_channels", {20, 21, 22, 23, 24, 25, 26}}
-    };
-    brainflow_boards_json["boards"]["3"]["default"] =
-    {
-        {"name", "Galea"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 19},
-        {"marker_channel", 20},
-        {"num_rows", 21},
-        {"eeg_channels", {7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eeg_names", "FP1,FP2,Fz,Cz,Pz,Oz,P3,P4,O1,O2"},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {5, 6}},
-        {"other_channels", {17, 18}},
-    };
-    brainflow_boards_json["boards"]["3"]["auxiliary"] =
-    {
-        {"name", "GaleaAuxiliary"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 8},
-        {"marker_channel", 9},
-        {"num_rows", 10},
-        {"battery_channel", 5},
-        {"eda_channels", {1}},
-        {"ppg_channels", {2, 3}},
-        {"other_channels", {6, 7}},
-        {"temperature_channels", {4}}
-    };
-    brainflow_boards_json["boards"]["4"]["default"] =
-    {
-        {"name", "GanglionWifi"},
-        {"sampling_rate", 1600},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 23},
-        {"marker_channel", 24},
-        {"num_rows", 25},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {1, 2, 3, 4}},
-        {"accel_channels", {5, 6, 7}},
-        {"analog_channels", {15, 16, 17}},
-        {"other_channels", {8, 9, 10, 11, 12, 13, 14}},
-        {"resistance_channels", {18, 19, 20, 21, 22}}
-    };
-    brainflow_boards_json["boards"]["5"]["default"] =
-    {
-        {"name", "CytonWifi"},
-        {"sampling_rate", 1000},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 22},
-        {"marker_channel", 23},
-        {"num_rows", 24},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"accel_channels", {9, 10, 11}},
-        {"analog_channels", {19, 20, 21}},
-        {"other_channels", {12, 13, 14, 15, 16, 17, 18}}
-    };
-    brainflow_boards_json["boards"]["6"]["default"] =
-    {
-        {"name", "CytonDaisyWifi"},
-        {"sampling_rate", 1000},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"accel_channels", {17, 18, 19}},
-        {"analog_channels", {27, 28, 29}},
-        {"other_channels", {20, 21, 22, 23, 24, 25, 26}}
-    };
-    brainflow_boards_json["boards"]["7"]["default"] =
-    {
-        {"name", "BrainBit"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"battery_channel", 9},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "T3,T4,O1,O2"},
-        {"resistance_channels", {5, 6, 7, 8}}
-    };
-    brainflow_boards_json["boards"]["8"]["default"] =
-    {
-        {"name", "Unicorn"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 17},
-        {"marker_channel", 18},
-        {"package_num_channel", 15},
-        {"num_rows", 19},
-        {"eeg_channels", {0, 1, 2, 3, 4, 5, 6, 7}},
-        {"eeg_names", "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8"},
-        {"accel_channels", {8, 9, 10}},
-        {"gyro_channels", {11, 12, 13}},
-        {"other_channels", {16}},
-        {"battery_channel", 14}
-    };
-    brainflow_boards_json["boards"]["9"]["default"] =
-    {
-        {"name", "CallibriEEG"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"package_num_channel", 0},
-        {"num_rows", 4},
-        {"eeg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["10"]["default"] =
-    {
-        {"name", "CallibriEMG"},
-        {"sampling_rate", 1000},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"package_num_channel", 0},
-        {"num_rows", 4},
-        {"emg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["11"]["default"] =
-    {
-        {"name", "CallibriECG"},
-        {"sampling_rate", 125},
-        {"timestamp_channel", 2},
-        {"marker_channel", 3},
-        {"package_num_channel", 0},
-        {"num_rows", 4},
-        {"ecg_channels", {1}}
-    };
-    brainflow_boards_json["boards"]["13"]["default"] =
-    {
-        {"name", "NotionOSC1"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "CP6,F6,C4,CP4,CP3,F5,C3,CP5"},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["14"]["default"] =
-    {
-        {"name", "NotionOSC2"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "CP5,F5,C3,CP3,CP6,F6,C4,CP4"},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["16"]["default"] =
-    {
-        {"name", "GforcePro"},
-        {"sampling_rate", 500},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 9},
-        {"marker_channel", 10},
-        {"num_rows", 11},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}}
-    };
-    brainflow_boards_json["boards"]["17"]["default"] =
-    {
-        {"name", "FreeEEG32"},
-        {"sampling_rate", 512},
-        {"timestamp_channel", 33},
-        {"marker_channel", 34},
-        {"package_num_channel", 0},
-        {"num_rows", 35},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}}
-    };
-    brainflow_boards_json["boards"]["18"]["default"] =
-    {
-        {"name", "BrainBitBLED"},
-        {"sampling_rate", 250},
-        {"battery_channel", 5},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "T3,T4,O1,O2"}
-    };
-    brainflow_boards_json["boards"]["19"]["default"] =
-    {
-        {"name", "GforceDual"},
-        {"sampling_rate", 500},
-        {"timestamp_channel", 3},
-        {"marker_channel", 4},
-        {"package_num_channel", 0},
-        {"num_rows", 5},
-        {"emg_channels", {1, 2}}
-    };
-    brainflow_boards_json["boards"]["20"]["default"] =
-    {
-        {"name", "GaleaSerial"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 19},
-        {"marker_channel", 20},
-        {"num_rows", 21},
-        {"eeg_channels", {7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"eeg_names", "FP1,FP2,Fz,Cz,Pz,Oz,P3,P4,O1,O2"},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {5, 6}},
-        {"other_channels", {17, 18}},
-    };
-    brainflow_boards_json["boards"]["20"]["auxiliary"] =
-    {
-        {"name", "GaleaSerialAuxiliary"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 8},
-        {"marker_channel", 9},
-        {"num_rows", 10},
-        {"battery_channel", 5},
-        {"eda_channels", {1}},
-        {"ppg_channels", {2, 3}},
-        {"other_channels", {6, 7}},
-        {"temperature_channels", {4}}
-    };
-    brainflow_boards_json["boards"]["21"]["default"] =
-    {
-        {"name", "MuseSBLED"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,Fp1,Fp2,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["21"]["auxiliary"] =
-    {
-        {"name", "MuseSBLEDAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["21"]["ancillary"] =
-    {
-        {"name", "MuseSBLEDAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["22"]["default"] =
-    {
-        {"name", "Muse2BLED"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,Fp1,Fp2,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["22"]["auxiliary"] =
-    {
-        {"name", "Muse2BLEDAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["22"]["ancillary"] =
-    {
-        {"name", "Muse2BLEDAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["23"]["default"] =
-    {
-        {"name", "CrownOSC"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "CP3,C3,F5,PO3,PO4,F6,C4,CP4"},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["24"]["default"] =
-    {
-        {"name", "AntNeuroEE410"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["25"]["default"] =
-    {
-        {"name", "AntNeuroEE411"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["26"]["default"] =
-    {
-        {"name", "AntNeuroEE430"},
-        {"sampling_rate", 512},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}}
-    };
-    brainflow_boards_json["boards"]["27"]["default"] =
-    {
-        {"name", "AntNeuroEE211"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 66},
-        {"marker_channel", 67},
-        {"package_num_channel", 0},
-        {"num_rows", 68},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"other_channels", {65}}
-    };
-    brainflow_boards_json["boards"]["28"]["default"] =
-    {
-        {"name", "AntNeuroEE212"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 34},
-        {"marker_channel", 35},
-        {"package_num_channel", 0},
-        {"num_rows", 36},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"other_channels", {33}}
-    };
-    brainflow_boards_json["boards"]["29"]["default"] =
-    {
-        {"name", "AntNeuroEE213"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"package_num_channel", 0},
-        {"num_rows", 20},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"other_channels", {17}}
-    };
-    brainflow_boards_json["boards"]["30"]["default"] =
-    {
-        {"name", "AntNeuroEE214"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 58},
-        {"marker_channel", 59},
-        {"package_num_channel", 0},
-        {"num_rows", 60},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56}},
-        {"other_channels", {57}}
-    };
-    brainflow_boards_json["boards"]["31"]["default"] =
-    {
-        {"name", "AntNeuroEE215"},
-        {"sampling_rate", 2000},
-        {"timestamp_channel", 90},
-        {"marker_channel", 91},
-        {"package_num_channel", 0},
-        {"num_rows", 92},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"emg_channels", {65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88}},
-        {"other_channels", {89}}
-    };
-    brainflow_boards_json["boards"]["32"]["default"] =
-    {
-        {"name", "AntNeuroEE221"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 18},
-        {"marker_channel", 19},
-        {"package_num_channel", 0},
-        {"num_rows", 20},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
-        {"other_channels", {17}}
-    };
-    brainflow_boards_json["boards"]["33"]["default"] =
-    {
-        {"name", "AntNeuroEE222"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 34},
-        {"marker_channel", 35},
-        {"package_num_channel", 0},
-        {"num_rows", 36},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"other_channels", {33}}
-    };
-    brainflow_boards_json["boards"]["34"]["default"] =
-    {
-        {"name", "AntNeuroEE223"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 58},
-        {"marker_channel", 59},
-        {"package_num_channel", 0},
-        {"num_rows", 60},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56}},
-        {"other_channels", {57}}
-    };
-    brainflow_boards_json["boards"]["35"]["default"] =
-    {
-        {"name", "AntNeuroEE224"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 66},
-        {"marker_channel", 67},
-        {"package_num_channel", 0},
-        {"num_rows", 68},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"other_channels", {65}}
-    };
-    brainflow_boards_json["boards"]["36"]["default"] =
-    {
-        {"name", "AntNeuroEE225"},
-        {"sampling_rate", 16000},
-        {"timestamp_channel", 90},
-        {"marker_channel", 91},
-        {"package_num_channel", 0},
-        {"num_rows", 92},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64}},
-        {"emg_channels", {65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88}},
-        {"other_channels", {89}}
-    };
-    brainflow_boards_json["boards"]["37"]["default"] =
-    {
-        {"name", "Enophone"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 5},
-        {"marker_channel", 6},
-        {"package_num_channel", 0},
-        {"num_rows", 7},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "A2,A1,C4,C3"}
-    };
-    brainflow_boards_json["boards"]["38"]["default"] =
-    {
-        {"name", "Muse2"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,Fp1,Fp2,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["38"]["auxiliary"] =
-    {
-        {"name", "Muse2Aux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["38"]["ancillary"] =
-    {
-        {"name", "Muse2Anc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["39"]["default"] =
-    {
-        {"name", "MuseS"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,Fp1,Fp2,TP10"},
-        {"other_channels", {5}}
-    };
-    brainflow_boards_json["boards"]["39"]["auxiliary"] =
-    {
-        {"name", "MuseSAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["39"]["ancillary"] =
-    {
-        {"name", "MuseSAnc"},
-        {"sampling_rate", 64},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["40"]["default"] =
-    {
-        {"name", "BrainAlive"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 15},
-        {"marker_channel", 16},
-        {"package_num_channel", 0},
-        {"num_rows", 17},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "F7,FT7,T7,CP5,CZ,C6,FC6,F4"},
-        {"accel_channels", {9, 10, 11}},
-        {"ppg_channels", {12, 13, 14}}
-    };
-    brainflow_boards_json["boards"]["41"]["default"] =
-    {
-        {"name", "Muse2016"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 5},
-        {"marker_channel", 6},
-        {"package_num_channel", 0},
-        {"num_rows", 7},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,Fp1,Fp2,TP10"}
-    };
-    brainflow_boards_json["boards"]["41"]["auxiliary"] =
-    {
-        {"name", "Muse2016Aux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["42"]["default"] =
-    {
-        {"name", "Muse2016BLED"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 5},
-        {"marker_channel", 6},
-        {"package_num_channel", 0},
-        {"num_rows", 7},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"eeg_names", "TP9,Fp1,Fp2,TP10"},
-    };
-    brainflow_boards_json["boards"]["42"]["auxiliary"] =
-    {
-        {"name", "Muse2016BLEDAux"},
-        {"sampling_rate", 52},
-        {"timestamp_channel", 7},
-        {"marker_channel", 8},
-        {"package_num_channel", 0},
-        {"num_rows", 9},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}}
-    };
-    brainflow_boards_json["boards"]["44"]["default"] =
-    {
-        {"name", "Explore4Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 6},
-        {"marker_channel", 7},
-        {"package_num_channel", 0},
-        {"num_rows", 8},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"other_channels", {5}} // data status
-    };
-    brainflow_boards_json["boards"]["44"]["auxiliary"] =
-    {
-        {"name", "Explore4Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["44"]["ancillary"] =
-    {
-        {"name", "Explore4Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["45"]["default"] =
-    {
-        {"name", "Explore8Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}} // data status
-    };
-    brainflow_boards_json["boards"]["45"]["auxiliary"] =
-    {
-        {"name", "Explore8Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["45"]["ancillary"] =
-    {
-        {"name", "Explore8Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["46"]["default"] =
-    {
-        {"name", "Ganglion"},
-        {"sampling_rate", 200},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 13},
-        {"marker_channel", 14},
-        {"num_rows", 15},
-        {"eeg_channels", {1, 2, 3, 4}},
-        {"emg_channels", {1, 2, 3, 4}},
-        {"ecg_channels", {1, 2, 3, 4}},
-        {"eog_channels", {1, 2, 3, 4}},
-        {"accel_channels", {5, 6, 7}},
-        {"resistance_channels", {8, 9, 10, 11, 12}}
-    };
+// clang-format off
+
+/* For all real boards there are four required fields:
+ *   name
+ *   num_rows
+ *   timestamp_channel
+ *   marker_channel
+ * Nice to set:
+ *   package_num
+ *   sampling_rate
+ * Everything else is optional and up to device
+ * Available presets are: default, auxiliary, ancillary, default is required, other presets are
+ * optional
+ */
+// board id, preset, name, sampling rate, package num channel, timestamp channel, marker channel,
+// num rows, battery channel, eeg names, channels
+static const BoardPresetDescr board_presets[] = {
+    {(int)BoardIds::SHARED_MEMORY_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "SharedMemory", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::SHARED_MEMORY_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "SharedMemory", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::SHARED_MEMORY_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "SharedMemory", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::PLAYBACK_FILE_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "PlayBack", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::PLAYBACK_FILE_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "PlayBack", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::PLAYBACK_FILE_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "PlayBack", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::STREAMING_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Streaming", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::STREAMING_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Streaming", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::STREAMING_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "Streaming", -1, -1, -1, -1, -1, -1, NULL, {}},
+    {(int)BoardIds::SYNTHETIC_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Synthetic", 250, 0, 30, 31, 32, 29, "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8,F5,F7,F3,F1,F2,F4,F6,F8",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EDA, CHANNELS (23)},
+         {BoardChannelTypes::PPG, CHANNELS (24, 25)},
+         {BoardChannelTypes::ACCEL, CHANNELS (17, 18, 19)},
+         {BoardChannelTypes::GYRO, CHANNELS (20, 21, 22)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (26)},
+         {BoardChannelTypes::RESISTANCE, CHANNELS (27, 28)}}},
+    {(int)BoardIds::SYNTHETIC_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "SyntheticAux", 250, 0, 18, 19, 20, 1, NULL,
+        {{BoardChannelTypes::EDA, CHANNELS (8)},
+         {BoardChannelTypes::PPG, CHANNELS (9, 10)},
+         {BoardChannelTypes::ACCEL, CHANNELS (2, 3, 4)},
+         {BoardChannelTypes::GYRO, CHANNELS (5, 6, 7)},
+         {BoardChannelTypes::OTHER, CHANNELS (14, 15, 16, 17)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (11)},
+         {BoardChannelTypes::RESISTANCE, CHANNELS (12, 13)}}},
+    {(int)BoardIds::CYTON_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Cyton", 250, 0, 22, 23, 24, -1, "Fp1,Fp2,C3,C4,P7,P8,O1,O2",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ACCEL, CHANNELS (9, 10, 11)},
+         {BoardChannelTypes::ANALOG, CHANNELS (19, 20, 21)},
+         {BoardChannelTypes::OTHER, CHANNELS (12, 13, 14, 15, 16, 17, 18)}}},
+    {(int)BoardIds::GANGLION_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Ganglion", 200, 0, 13, 14, 15, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ACCEL, CHANNELS (5, 6, 7)},
+         {BoardChannelTypes::RESISTANCE, CHANNELS (8, 9, 10, 11, 12)}}},
+    {(int)BoardIds::CYTON_DAISY_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CytonDaisy", 125, 0, 30, 31, 32, -1, "Fp1,Fp2,C3,C4,P7,P8,O1,O2,F7,F8,F3,F4,T7,T8,P3,P4",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::ACCEL, CHANNELS (17, 18, 19)},
+         {BoardChannelTypes::ANALOG, CHANNELS (27, 28, 29)},
+         {BoardChannelTypes::OTHER, CHANNELS (20, 21, 22, 23, 24, 25, 26)}}},
+    {(int)BoardIds::GALEA_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Galea", 250, 0, 19, 20, 21, -1, "FP1,FP2,Fz,Cz,Pz,Oz,P3,P4,O1,O2",
+        {{BoardChannelTypes::EEG, CHANNELS (7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EOG, CHANNELS (5, 6)},
+         {BoardChannelTypes::OTHER, CHANNELS (17, 18)}}},
+    {(int)BoardIds::GALEA_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "GaleaAuxiliary", 50, 0, 8, 9, 10, 5, NULL,
+        {{BoardChannelTypes::EDA, CHANNELS (1)},
+         {BoardChannelTypes::PPG, CHANNELS (2, 3)},
+         {BoardChannelTypes::OTHER, CHANNELS (6, 7)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (4)}}},
+    {(int)BoardIds::GANGLION_WIFI_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "GanglionWifi", 1600, 0, 23, 24, 25, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ACCEL, CHANNELS (5, 6, 7)},
+         {BoardChannelTypes::ANALOG, CHANNELS (15, 16, 17)},
+         {BoardChannelTypes::OTHER, CHANNELS (8, 9, 10, 11, 12, 13, 14)},
+         {BoardChannelTypes::RESISTANCE, CHANNELS (18, 19, 20, 21, 22)}}},
+    {(int)BoardIds::CYTON_WIFI_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CytonWifi", 1000, 0, 22, 23, 24, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ACCEL, CHANNELS (9, 10, 11)},
+         {BoardChannelTypes::ANALOG, CHANNELS (19, 20, 21)},
+         {BoardChannelTypes::OTHER, CHANNELS (12, 13, 14, 15, 16, 17, 18)}}},
+    {(int)BoardIds::CYTON_DAISY_WIFI_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CytonDaisyWifi", 1000, 0, 30, 31, 32, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::ACCEL, CHANNELS (17, 18, 19)},
+         {BoardChannelTypes::ANALOG, CHANNELS (27, 28, 29)},
+         {BoardChannelTypes::OTHER, CHANNELS (20, 21, 22, 23, 24, 25, 26)}}},
+    {(int)BoardIds::BRAINBIT_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "BrainBit", 250, 0, 10, 11, 12, 9, "T3,T4,O1,O2",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::RESISTANCE, CHANNELS (5, 6, 7, 8)}}},
+    {(int)BoardIds::UNICORN_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Unicorn", 250, 15, 17, 18, 19, 14, "Fz,C3,Cz,C4,Pz,PO7,Oz,PO8",
+        {{BoardChannelTypes::EEG, CHANNELS (0, 1, 2, 3, 4, 5, 6, 7)},
+         {BoardChannelTypes::ACCEL, CHANNELS (8, 9, 10)},
+         {BoardChannelTypes::GYRO, CHANNELS (11, 12, 13)},
+         {BoardChannelTypes::OTHER, CHANNELS (16)}}},
+    {(int)BoardIds::CALLIBRI_EEG_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CallibriEEG", 250, 0, 2, 3, 4, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1)}}},
+    {(int)BoardIds::CALLIBRI_EMG_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CallibriEMG", 1000, 0, 2, 3, 4, -1, NULL,
+        {{BoardChannelTypes::EMG, CHANNELS (1)}}},
+    {(int)BoardIds::CALLIBRI_ECG_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CallibriECG", 125, 0, 2, 3, 4, -1, NULL,
+        {{BoardChannelTypes::ECG, CHANNELS (1)}}},
+    {(int)BoardIds::NOTION_1_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "NotionOSC1", 250, 0, 10, 11, 12, -1, "CP6,F6,C4,CP4,CP3,F5,C3,CP5",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}},
+    {(int)BoardIds::NOTION_2_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "NotionOSC2", 250, 0, 10, 11, 12, -1, "CP5,F5,C3,CP3,CP6,F6,C4,CP4",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}},
+    {(int)BoardIds::GFORCE_PRO_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "GforcePro", 500, 0, 9, 10, 11, -1, NULL,
+        {{BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)}}},
+    {(int)BoardIds::FREEEEG32_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "FreeEEG32", 512, 0, 33, 34, 35, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)}}},
+    {(int)BoardIds::BRAINBIT_BLED_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "BrainBitBLED", 250, 0, 6, 7, 8, 5, "T3,T4,O1,O2",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)}}},
+    {(int)BoardIds::GFORCE_DUAL_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "GforceDual", 500, 0, 3, 4, 5, -1, NULL,
+        {{BoardChannelTypes::EMG, CHANNELS (1, 2)}}},
+    {(int)BoardIds::GALEA_SERIAL_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "GaleaSerial", 250, 0, 19, 20, 21, -1, "FP1,FP2,Fz,Cz,Pz,Oz,P3,P4,O1,O2",
+        {{BoardChannelTypes::EEG, CHANNELS (7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EOG, CHANNELS (5, 6)},
+         {BoardChannelTypes::OTHER, CHANNELS (17, 18)}}},
+    {(int)BoardIds::GALEA_SERIAL_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "GaleaSerialAuxiliary", 50, 0, 8, 9, 10, 5, NULL,
+        {{BoardChannelTypes::EDA, CHANNELS (1)},
+         {BoardChannelTypes::PPG, CHANNELS (2, 3)},
+         {BoardChannelTypes::OTHER, CHANNELS (6, 7)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (4)}}},
+    {(int)BoardIds::MUSE_S_BLED_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "MuseSBLED", 256, 0, 6, 7, 8, -1, "TP9,Fp1,Fp2,TP10",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::OTHER, CHANNELS (5)}}},
+    {(int)BoardIds::MUSE_S_BLED_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "MuseSBLEDAux", 52, 0, 7, 8, 9, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)}}},
+    {(int)BoardIds::MUSE_S_BLED_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "MuseSBLEDAnc", 64, 0, 4, 5, 6, -1, NULL,
+        {{BoardChannelTypes::PPG, CHANNELS (1, 2, 3)}}},
+    {(int)BoardIds::MUSE_2_BLED_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Muse2BLED", 256, 0, 6, 7, 8, -1, "TP9,Fp1,Fp2,TP10",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::OTHER, CHANNELS (5)}}},
+    {(int)BoardIds::MUSE_2_BLED_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Muse2BLEDAux", 52, 0, 7, 8, 9, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)}}},
+    {(int)BoardIds::MUSE_2_BLED_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "Muse2BLEDAnc", 64, 0, 4, 5, 6, -1, NULL,
+        {{BoardChannelTypes::PPG, CHANNELS (1, 2, 3)}}},
+    {(int)BoardIds::CROWN_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "CrownOSC", 256, 0, 10, 11, 12, -1, "CP3,C3,F5,PO3,PO4,F6,C4,CP4",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}},
+    {(int)BoardIds::ANT_NEURO_EE_410_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE410", 2000, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}},
+    {(int)BoardIds::ANT_NEURO_EE_411_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE411", 2000, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}},
+    {(int)BoardIds::ANT_NEURO_EE_430_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE430", 512, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}},
+    {(int)BoardIds::ANT_NEURO_EE_211_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE211", 2000, 0, 66, 67, 68, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64)},
+         {BoardChannelTypes::OTHER, CHANNELS (65)}}},
+    {(int)BoardIds::ANT_NEURO_EE_212_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE212", 2000, 0, 34, 35, 36, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::OTHER, CHANNELS (33)}}},
+    {(int)BoardIds::ANT_NEURO_EE_213_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE213", 2000, 0, 18, 19, 20, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::OTHER, CHANNELS (17)}}},
+    {(int)BoardIds::ANT_NEURO_EE_214_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE214", 2000, 0, 58, 59, 60, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::EMG, CHANNELS (33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56)},
+         {BoardChannelTypes::OTHER, CHANNELS (57)}}},
+    {(int)BoardIds::ANT_NEURO_EE_215_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE215", 2000, 0, 90, 91, 92, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64)},
+         {BoardChannelTypes::EMG, CHANNELS (65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88)},
+         {BoardChannelTypes::OTHER, CHANNELS (89)}}},
+    {(int)BoardIds::ANT_NEURO_EE_221_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE221", 16000, 0, 18, 19, 20, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)},
+         {BoardChannelTypes::OTHER, CHANNELS (17)}}},
+    {(int)BoardIds::ANT_NEURO_EE_222_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE222", 16000, 0, 34, 35, 36, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::OTHER, CHANNELS (33)}}},
+    {(int)BoardIds::ANT_NEURO_EE_223_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE223", 16000, 0, 58, 59, 60, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::EMG, CHANNELS (33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56)},
+         {BoardChannelTypes::OTHER, CHANNELS (57)}}},
+    {(int)BoardIds::ANT_NEURO_EE_224_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE224", 16000, 0, 66, 67, 68, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64)},
+         {BoardChannelTypes::OTHER, CHANNELS (65)}}},
+    {(int)BoardIds::ANT_NEURO_EE_225_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE225", 16000, 0, 90, 91, 92, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64)},
+         {BoardChannelTypes::EMG, CHANNELS (65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88)},
+         {BoardChannelTypes::OTHER, CHANNELS (89)}}},
+    {(int)BoardIds::ENOPHONE_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Enophone", 250, 0, 5, 6, 7, -1, "A2,A1,C4,C3",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)}}},
+    {(int)BoardIds::MUSE_2_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Muse2", 256, 0, 6, 7, 8, -1, "TP9,Fp1,Fp2,TP10",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::OTHER, CHANNELS (5)}}},
+    {(int)BoardIds::MUSE_2_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Muse2Aux", 52, 0, 7, 8, 9, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)}}},
+    {(int)BoardIds::MUSE_2_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "Muse2Anc", 64, 0, 4, 5, 6, -1, NULL,
+        {{BoardChannelTypes::PPG, CHANNELS (1, 2, 3)}}},
+    {(int)BoardIds::MUSE_S_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "MuseS", 256, 0, 6, 7, 8, -1, "TP9,Fp1,Fp2,TP10",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::OTHER, CHANNELS (5)}}},
+    {(int)BoardIds::MUSE_S_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "MuseSAux", 52, 0, 7, 8, 9, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)}}},
+    {(int)BoardIds::MUSE_S_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "MuseSAnc", 64, 0, 4, 5, 6, -1, NULL,
+        {{BoardChannelTypes::PPG, CHANNELS (1, 2, 3)}}},
+    {(int)BoardIds::BRAINALIVE_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "BrainAlive", 250, 0, 15, 16, 17, -1, "F7,FT7,T7,CP5,CZ,C6,FC6,F4",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::PPG, CHANNELS (12, 13, 14)},
+         {BoardChannelTypes::ACCEL, CHANNELS (9, 10, 11)}}},
+    {(int)BoardIds::MUSE_2016_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Muse2016", 256, 0, 5, 6, 7, -1, "TP9,Fp1,Fp2,TP10",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)}}},
+    {(int)BoardIds::MUSE_2016_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Muse2016Aux", 52, 0, 7, 8, 9, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)}}},
+    {(int)BoardIds::MUSE_2016_BLED_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Muse2016BLED", 256, 0, 5, 6, 7, -1, "TP9,Fp1,Fp2,TP10",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)}}},
+    {(int)BoardIds::MUSE_2016_BLED_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Muse2016BLEDAux", 52, 0, 7, 8, 9, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)}}},
+    {(int)BoardIds::EXPLORE_4_CHAN_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Explore4Channels", 250, 0, 6, 7, 8, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::OTHER, CHANNELS (5)}}}, // data status
+    {(int)BoardIds::EXPLORE_4_CHAN_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Explore4Channels", 20, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (7, 8, 9)}}},
+    {(int)BoardIds::EXPLORE_4_CHAN_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "Explore4Channels", 1, 0, 4, 5, 6, 2, NULL,
+        {{BoardChannelTypes::OTHER, CHANNELS (3)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (1)}}},
+    {(int)BoardIds::EXPLORE_8_CHAN_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Explore8Channels", 250, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}}, // data status
+    {(int)BoardIds::EXPLORE_8_CHAN_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Explore8Channels", 20, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (7, 8, 9)}}},
+    {(int)BoardIds::EXPLORE_8_CHAN_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "Explore8Channels", 1, 0, 4, 5, 6, 2, NULL,
+        {{BoardChannelTypes::OTHER, CHANNELS (3)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (1)}}},
+    {(int)BoardIds::GANGLION_NATIVE_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Ganglion", 200, 0, 13, 14, 15, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4)},
+         {BoardChannelTypes::ACCEL, CHANNELS (5, 6, 7)},
+         {BoardChannelTypes::RESISTANCE, CHANNELS (8, 9, 10, 11, 12)}}},
     // todo add other data types and check/fix sampling rates for them
-    brainflow_boards_json["boards"]["47"]["default"] =
-    {
-        {"name", "Emotibit"},
-        {"sampling_rate", 25}, // random value for now
-        {"package_num_channel", 0},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["47"]["auxiliary"] =
-    {
-        {"name", "Emotibit"},
-        {"sampling_rate", 25},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"num_rows", 6},
-        {"ppg_channels", {1, 2, 3}}
-    };
-    brainflow_boards_json["boards"]["47"]["ancillary"] =
-    {
-        {"name", "Emotibit"},
-        {"sampling_rate", 15},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"num_rows", 6},
-        {"eda_channels", {1}},
-        {"temperature_channels", {2}},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["48"]["default"] =
-    {
-        {"name", "GaleaV4"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 27},
-        {"marker_channel", 28},
-        {"num_rows", 29},
-        {"eeg_channels", {9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}},
-        {"eeg_names", "F1,C3,F2,Cz,C4,Pz,P4,O2,P3,O1,X1,X2,X3,X4,X5,X6"},
-        {"emg_channels", {1, 2, 3, 4, 7, 8}},
-        {"eog_channels", {5, 6}},
-        {"other_channels", {25, 26}},
-    };
-    brainflow_boards_json["boards"]["48"]["auxiliary"] =
-    {
-        {"name", "GaleaV4Auxiliary"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 17},
-        {"marker_channel", 18},
-        {"num_rows", 19},
-        {"battery_channel", 5},
-        {"eda_channels", {1}},
-        {"ppg_channels", {2, 3}},
-        {"accel_channels", {6, 7, 8}},
-        {"gyro_channels", {9, 10, 11}},
-        {"magnetometer_channels", {12, 13, 14}},
-        {"other_channels", {15, 16}},
-        {"temperature_channels", {4}}
-    };
-    brainflow_boards_json["boards"]["49"]["default"] =
-    {
-        {"name", "GaleaSerial"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 27},
-        {"marker_channel", 28},
-        {"num_rows", 29},
-        {"eeg_channels", {9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}},
-        {"eeg_names", "F1,C3,F2,Cz,C4,Pz,P4,O2,P3,O1,X1,X2,X3,X4,X5,X6"},
-        {"emg_channels", {1, 2, 3, 4, 7, 8}},
-        {"eog_channels", {5, 6}},
-        {"other_channels", {25, 26}},
-    };
-    brainflow_boards_json["boards"]["49"]["auxiliary"] =
-    {
-        {"name", "GaleaSerialAuxiliary"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 17},
-        {"marker_channel", 18},
-        {"num_rows", 19},
-        {"battery_channel", 5},
-        {"eda_channels", {1}},
-        {"ppg_channels", {2, 3}},
-        {"accel_channels", {6, 7, 8}},
-        {"gyro_channels", {9, 10, 11}},
-        {"magnetometer_channels", {12, 13, 14}},
-        {"other_channels", {15, 16}},
-        {"temperature_channels", {4}}
-    };
-    brainflow_boards_json["boards"]["50"]["default"] =
-    {
-        {"name", "NtlWifi"},
-        {"sampling_rate", 250},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 23},
-        {"marker_channel", 24},
-        {"num_rows", 25},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "Fp1,Fp2,C3,C4,P7,P8,O1,O2"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"accel_channels", {9, 10, 11}},
-        {"analog_channels", {19, 20, 21}},
-        {"other_channels", {12, 13, 14, 15, 16, 17, 18}},
-        {"battery_channel", 22}
-    };
-    brainflow_boards_json["boards"]["51"]["default"] =
-    {
-        {"name", "AntNeuroEE511"},
-        {"sampling_rate", 4096},
-        {"timestamp_channel", 30},
-        {"marker_channel", 31},
-        {"package_num_channel", 0},
-        {"num_rows", 32},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24}},
-        {"emg_channels", {25, 26, 27, 28}},
-        {"other_channels", {29}}
-    };
-    brainflow_boards_json["boards"]["52"]["default"] =
-    {
-        {"name", "FreeEEG128"},
-        {"sampling_rate", 256},
-        {"timestamp_channel", 129},
-        {"marker_channel", 130},
-        {"package_num_channel", 0},
-        {"num_rows", 131},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128}}
-    };
-    brainflow_boards_json["boards"]["53"]["default"] =
-    {
-        {"name", "AAVAA V3"},
-        {"sampling_rate", 50},
-        {"package_num_channel", 0},
-        {"timestamp_channel", 15},
-        {"marker_channel", 16},
-        {"num_rows", 17},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eeg_names", "L1,L2,L3,L4,R1,R2,R3,R4"},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"eog_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"rotation_channels", {9, 10, 11}},
-        {"battery_channel", 12},
-        {"other_channels", {13, 14}}
-    };
-    brainflow_boards_json["boards"]["54"]["default"] =
-    {
-        {"name", "ExplorePlus8Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8}},
-        {"other_channels", {9}} // data status
-    };
-    brainflow_boards_json["boards"]["54"]["auxiliary"] =
-    {
-        {"name", "ExplorePlus8Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["54"]["ancillary"] =
-    {
-        {"name", "ExplorePlus8Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
-    brainflow_boards_json["boards"]["55"]["default"] =
-    {
-        {"name", "ExplorePlus32Channels"},
-        {"sampling_rate", 250},
-        {"timestamp_channel", 34},
-        {"marker_channel", 35},
-        {"package_num_channel", 0},
-        {"num_rows", 36},
-        {"eeg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"emg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"ecg_channels", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32}},
-        {"other_channels", {33}} // data status
-    };
-    brainflow_boards_json["boards"]["55"]["auxiliary"] =
-    {
-        {"name", "ExplorePlus32Channels"},
-        {"sampling_rate", 20},
-        {"timestamp_channel", 10},
-        {"marker_channel", 11},
-        {"package_num_channel", 0},
-        {"num_rows", 12},
-        {"accel_channels", {1, 2, 3}},
-        {"gyro_channels", {4, 5, 6}},
-        {"magnetometer_channels", {7, 8, 9}}
-    };
-    brainflow_boards_json["boards"]["55"]["ancillary"] =
+    {(int)BoardIds::EMOTIBIT_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "Emotibit", 25, 0, 10, 11, 12, -1, NULL, // sampling rate is a random value for now
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (7, 8, 9)}}},
+    {(int)BoardIds::EMOTIBIT_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "Emotibit", 25, 0, 4, 5, 6, -1, NULL,
+        {{BoardChannelTypes::PPG, CHANNELS (1, 2, 3)}}},
+    {(int)BoardIds::EMOTIBIT_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "Emotibit", 15, 0, 4, 5, 6, -1, NULL,
+        {{BoardChannelTypes::EDA, CHANNELS (1)},
+         {BoardChannelTypes::OTHER, CHANNELS (3)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (2)}}},
+    {(int)BoardIds::GALEA_BOARD_V4, (int)BrainFlowPresets::DEFAULT_PRESET, "GaleaV4", 250, 0, 27, 28, 29, -1, "F1,C3,F2,Cz,C4,Pz,P4,O2,P3,O1,X1,X2,X3,X4,X5,X6",
+        {{BoardChannelTypes::EEG, CHANNELS (9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 7, 8)},
+         {BoardChannelTypes::EOG, CHANNELS (5, 6)},
+         {BoardChannelTypes::OTHER, CHANNELS (25, 26)}}},
+    {(int)BoardIds::GALEA_BOARD_V4, (int)BrainFlowPresets::AUXILIARY_PRESET, "GaleaV4Auxiliary", 50, 0, 17, 18, 19, 5, NULL,
+        {{BoardChannelTypes::EDA, CHANNELS (1)},
+         {BoardChannelTypes::PPG, CHANNELS (2, 3)},
+         {BoardChannelTypes::ACCEL, CHANNELS (6, 7, 8)},
+         {BoardChannelTypes::GYRO, CHANNELS (9, 10, 11)},
+         {BoardChannelTypes::OTHER, CHANNELS (15, 16)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (4)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (12, 13, 14)}}},
+    {(int)BoardIds::GALEA_SERIAL_BOARD_V4, (int)BrainFlowPresets::DEFAULT_PRESET, "GaleaSerial", 250, 0, 27, 28, 29, -1, "F1,C3,F2,Cz,C4,Pz,P4,O2,P3,O1,X1,X2,X3,X4,X5,X6",
+        {{BoardChannelTypes::EEG, CHANNELS (9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 7, 8)},
+         {BoardChannelTypes::EOG, CHANNELS (5, 6)},
+         {BoardChannelTypes::OTHER, CHANNELS (25, 26)}}},
+    {(int)BoardIds::GALEA_SERIAL_BOARD_V4, (int)BrainFlowPresets::AUXILIARY_PRESET, "GaleaSerialAuxiliary", 50, 0, 17, 18, 19, 5, NULL,
+        {{BoardChannelTypes::EDA, CHANNELS (1)},
+         {BoardChannelTypes::PPG, CHANNELS (2, 3)},
+         {BoardChannelTypes::ACCEL, CHANNELS (6, 7, 8)},
+         {BoardChannelTypes::GYRO, CHANNELS (9, 10, 11)},
+         {BoardChannelTypes::OTHER, CHANNELS (15, 16)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (4)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (12, 13, 14)}}},
+    {(int)BoardIds::NTL_WIFI_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "NtlWifi", 250, 0, 23, 24, 25, 22, "Fp1,Fp2,C3,C4,P7,P8,O1,O2",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ACCEL, CHANNELS (9, 10, 11)},
+         {BoardChannelTypes::ANALOG, CHANNELS (19, 20, 21)},
+         {BoardChannelTypes::OTHER, CHANNELS (12, 13, 14, 15, 16, 17, 18)}}},
+    {(int)BoardIds::ANT_NEURO_EE_511_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AntNeuroEE511", 4096, 0, 30, 31, 32, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24)},
+         {BoardChannelTypes::EMG, CHANNELS (25, 26, 27, 28)},
+         {BoardChannelTypes::OTHER, CHANNELS (29)}}},
+    {(int)BoardIds::FREEEEG128_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "FreeEEG128", 256, 0, 129, 130, 131, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128)}}},
+    {(int)BoardIds::AAVAA_V3_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "AAVAA V3", 50, 0, 15, 16, 17, 12, "L1,L2,L3,L4,R1,R2,R3,R4",
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EOG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ROTATION, CHANNELS (9, 10, 11)},
+         {BoardChannelTypes::OTHER, CHANNELS (13, 14)}}},
+    {(int)BoardIds::EXPLORE_PLUS_8_CHAN_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "ExplorePlus8Channels", 250, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8)},
+         {BoardChannelTypes::OTHER, CHANNELS (9)}}}, // data status
+    {(int)BoardIds::EXPLORE_PLUS_8_CHAN_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "ExplorePlus8Channels", 20, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (7, 8, 9)}}},
+    {(int)BoardIds::EXPLORE_PLUS_8_CHAN_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "ExplorePlus8Channels", 1, 0, 4, 5, 6, 2, NULL,
+        {{BoardChannelTypes::OTHER, CHANNELS (3)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (1)}}},
+    {(int)BoardIds::EXPLORE_PLUS_32_CHAN_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, "ExplorePlus32Channels", 250, 0, 34, 35, 36, -1, NULL,
+        {{BoardChannelTypes::EEG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::EMG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::ECG, CHANNELS (1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32)},
+         {BoardChannelTypes::OTHER, CHANNELS (33)}}}, // data status
+    {(int)BoardIds::EXPLORE_PLUS_32_CHAN_BOARD, (int)BrainFlowPresets::AUXILIARY_PRESET, "ExplorePlus32Channels", 20, 0, 10, 11, 12, -1, NULL,
+        {{BoardChannelTypes::ACCEL, CHANNELS (1, 2, 3)},
+         {BoardChannelTypes::GYRO, CHANNELS (4, 5, 6)},
+         {BoardChannelTypes::MAGNETOMETER, CHANNELS (7, 8, 9)}}},
+    {(int)BoardIds::EXPLORE_PLUS_32_CHAN_BOARD, (int)BrainFlowPresets::ANCILLARY_PRESET, "ExplorePlus32Channels", 1, 0, 4, 5, 6, 2, NULL,
+        {{BoardChannelTypes::OTHER, CHANNELS (3)},
+         {BoardChannelTypes::TEMPERATURE, CHANNELS (1)}}},
+};
+
+// clang-format on
+
+static const int num_board_presets = (int)(sizeof (board_presets) / sizeof (board_presets[0]));
+
+static const char *channel_type_names[BOARD_CHANNEL_TYPES] = {"eeg", "emg", "ecg", "eog", "eda",
+    "ppg", "accel", "rotation", "analog", "gyro", "other", "temperature", "resistance",
+    "magnetometer"};
+
+// maps board id and preset to position in board_presets
+struct BoardPresetsIndex
+{
+    int min_board_id;
+    std::vector<int> positions; // 3 presets per board id, -1 if there is no such preset
+
+    BoardPresetsIndex ()
+    {
+        min_board_id = board_presets[0].board_id;
+        int max_board_id = board_presets[0].board_id;
+        for (int i = 0; i < num_board_presets; i++)
+        {
+            min_board_id = std::min (min_board_id, board_presets[i].board_id);
+            max_board_id = std::max (max_board_id, board_presets[i].board_id);
+        }
+        positions.resize ((max_board_id - min_board_id + 1) * 3, -1);
+        for (int i = 0; i < num_board_presets; i++)
+        {
+            positions[(board_presets[i].board_id - min_board_id) * 3 + board_presets[i].preset] = i;
+        }
+    }
+};
+
+const BoardPresetDescr *get_board_preset_descr (int board_id, int preset)
+{
+    // only index is built at runtime, it is a few hundred bytes
+    static const BoardPresetsIndex index;
+    if ((preset < 0) || (preset > 2) || (board_id < index.min_board_id))
+    {
+        return NULL;
+    }
+    size_t position = (size_t)((board_id - index.min_board_id) * 3 + preset);
+    if ((position >= index.positions.size ()) || (index.positions[position] < 0))
+    {
+        return NULL;
+    }
+    return &board_presets[index.positions[position]];
+}
+
+const BoardChannels *get_board_channels (const BoardPresetDescr *descr, BoardChannelTypes type)
+{
+    for (int i = 0; (i < BOARD_CHANNEL_TYPES) && (descr->channels[i].values != NULL); i++)
     {
-        {"name", "ExplorePlus32Channels"},
-        {"sampling_rate", 1},
-        {"timestamp_channel", 4},
-        {"marker_channel", 5},
-        {"package_num_channel", 0},
-        {"num_rows", 6},
-        {"temperature_channels", {1}},
-        {"battery_channel", 2},
-        {"other_channels", {3}}
-    };
+        if (descr->channels[i].type == type)
+        {
+            return &descr->channels[i];
+        }
+    }
+    return NULL;
 }
 
-BrainFlowBoards boards_struct;
+const char *get_board_channel_type_name (BoardChannelTypes type)
+{
+    return channel_type_names[(int)type];
+}
+
+json get_board_preset_json (const BoardPresetDescr *descr)
+{
+    json result = json::object ();
+    result["name"] = descr->name;
+    const char *int_names[6] = {"sampling_rate", "package_num_channel", "timestamp_channel",
+        "marker_channel", "num_rows", "battery_channel"};
+    int int_values[6] = {descr->sampling_rate, descr->package_num_channel,
+        descr->timestamp_channel, descr->marker_channel, descr->num_rows, descr->battery_channel};
+    for (int i = 0; i < 6; i++)
+    {
+        if (int_values[i] >= 0)
+        {
+            result[int_names[i]] = int_values[i];
+        }
+    }
+    if (descr->eeg_names != NULL)
+    {
+        result["eeg_names"] = descr->eeg_names;
+    }
+    for (int i = 0; (i < BOARD_CHANNEL_TYPES) && (descr->channels[i].values != NULL); i++)
+    {
+        const BoardChannels &channels = descr->channels[i];
+        std::string key = std::string (get_board_channel_type_name (channels.type)) + "_channels";
+        result[key] = std::vector<int> (channels.values, channels.values + channels.len);
+    }
+    return result;
+}
+
+json get_board_json (int board_id)
+{
+    json result;
+    const char *preset_names[3] = {"default", "auxiliary", "ancillary"};
+    for (int preset = 0; preset < 3; preset++)
+    {
+        const BoardPresetDescr *descr = get_board_preset_descr (board_id, preset);
+        if (descr != NULL)
+        {
+            result[preset_names[preset]] = get_board_preset_json (descr);
+        }
+    }
+    return result;
+}
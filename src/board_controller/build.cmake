@@ -25,12 +25,19 @@ endif (CMAKE_SIZEOF_VOID_P EQUAL 8)
 SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/spsc_data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/stream_frame.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/shared_memory_ring.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_format.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_compression.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_segments.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/os_serial_ioctl.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/serial.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/libftdi_serial.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_client_tcp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_client_udp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/datagram_batch.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_server_tcp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_server_udp.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/multicast_client.cpp
@@ -55,13 +62,19 @@ SET (BOARD_CONTROLLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/brainflow_boards.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/streaming_board.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/shared_memory_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/synthetic_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/dyn_lib_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/bt_lib_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/playback_file_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/file_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/binary_file_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/segmented_file_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/multicast_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/shared_memory_streamer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/plotjuggler_udp_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/callback_streamer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/streamer_pool.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/gtec/unicorn_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/neuromd/neuromd_board.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/neuromd/brainbit.cpp
@@ -231,6 +244,10 @@ endif (ANDROID)
 if (UNIX AND NOT ANDROID)
     target_link_libraries (${BOARD_CONTROLLER_NAME} PRIVATE pthread dl)
 endif (UNIX AND NOT ANDROID)
+# shm_open is in librt for glibc older than 2.34
+if (UNIX AND NOT ANDROID AND NOT APPLE)
+    target_link_libraries (${BOARD_CONTROLLER_NAME} PRIVATE rt)
+endif (UNIX AND NOT ANDROID AND NOT APPLE)
 if (ANDROID)
     find_library (log-lib log)
     target_link_libraries (${BOARD_CONTROLLER_NAME} PRIVATE log)
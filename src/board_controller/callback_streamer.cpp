@@ -0,0 +1,101 @@
+#include <algorithm>
+
+#include "board.h"
+#include "brainflow_constants.h"
+#include "callback_streamer.h"
+
+
+CallbackStreamer::CallbackStreamer (brainflow_data_callback callback, void *user_data,
+    int batch_size, int preset, int data_len)
+    : Streamer (data_len, "callback", "", "")
+{
+    this->callback = callback;
+    this->user_data = user_data;
+    this->batch_size = batch_size;
+    this->preset = preset;
+    is_streaming = false;
+    db = NULL;
+}
+
+CallbackStreamer::~CallbackStreamer ()
+{
+    if ((streaming_thread.joinable ()) && (is_streaming))
+    {
+        {
+            std::lock_guard<std::mutex> lock (wait_mutex);
+            is_streaming = false;
+        }
+        wait_cv.notify_one ();
+        streaming_thread.join ();
+    }
+    if (db != NULL)
+    {
+        delete db;
+        db = NULL;
+    }
+}
+
+int CallbackStreamer::init_streamer ()
+{
+    if ((is_streaming) || (db != NULL))
+    {
+        Board::get_board_logger ()->error ("callback streamer is running");
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+
+    // keep several batches to survive short delays in user callback
+    db = new SPSCDataBuffer (len, (size_t)std::max (batch_size * 10, 1000));
+    if (!db->is_ready ())
+    {
+        Board::get_board_logger ()->error ("unable to prepare buffer for callback");
+        delete db;
+        db = NULL;
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+
+    is_streaming = true;
+    streaming_thread = std::thread ([this] { this->thread_worker (); });
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void CallbackStreamer::stream_data (double *data)
+{
+    stream_packages (data, 1);
+}
+
+void CallbackStreamer::stream_packages (double *data, int count)
+{
+    db->add_data (data, (size_t)count);
+    if (db->get_data_count () >= (size_t)batch_size)
+    {
+        std::lock_guard<std::mutex> lock (wait_mutex);
+        wait_cv.notify_one ();
+    }
+}
+
+void CallbackStreamer::thread_worker ()
+{
+    double *batch = new double[batch_size * len];
+    while (is_streaming)
+    {
+        {
+            std::unique_lock<std::mutex> lock (wait_mutex);
+            wait_cv.wait (lock,
+                [this] {
+                    return (!is_streaming) || (db->get_data_count () >= (size_t)batch_size);
+                });
+        }
+        while (db->get_data_count () >= (size_t)batch_size)
+        {
+            int count = (int)db->get_data_by_channels (batch_size, batch);
+            callback (batch, len, count, preset, user_data);
+        }
+    }
+    // deliver the rest as a last incomplete batch
+    int count = (int)db->get_data_by_channels (batch_size, batch);
+    if (count > 0)
+    {
+        callback (batch, len, count, preset, user_data);
+    }
+    delete[] batch;
+}
@@ -180,7 +180,10 @@ int Emotibit::release_session ()
 void Emotibit::read_thread ()
 {
     constexpr int max_size = 32768;
-    char message[max_size];
+    // all datagrams which are already in socket buffer are received per wakeup
+    DatagramBatch batch (DATAGRAM_BATCH_DEFAULT_SIZE, max_size);
+    int num_datagrams = 0;
+    int datagram = 0;
 
     // emotibit sends multiple data points per transaction and for example accelerometer x and y
     // data are in different transactions, we have to align them and use max_datapoints_in_package
@@ -215,10 +218,24 @@ void Emotibit::read_thread ()
 
     while (keep_alive)
     {
-        int bytes_recv = data_socket->recv (message, max_size);
+        if (datagram == num_datagrams)
+        {
+            datagram = 0;
+            num_datagrams = data_socket->recv_batch (batch);
+            if (num_datagrams < 1)
+            {
+                num_datagrams = 0;
+                safe_logger (spdlog::level::trace, "no data received");
+                continue;
+            }
+        }
+        int bytes_recv = batch.get_size (datagram);
+        // datagrams from one batch are processed later than received, use their arrival time
+        double arrival_time = batch.get_arrival_time (datagram);
+        char *message = batch.get_datagram (datagram);
+        datagram++;
         if (bytes_recv < 1)
         {
-            safe_logger (spdlog::level::trace, "no data received");
             continue;
         }
         std::string message_received = std::string (message, bytes_recv);
@@ -277,7 +294,7 @@ void Emotibit::read_thread ()
                     {
                         default_packages[i]
                                         [board_descr["default"]["timestamp_channel"].get<int> ()] =
-                                            get_timestamp ();
+                                            arrival_time;
                         default_packages[i][board_descr["default"]["package_num_channel"]
                                                 .get<int> ()] = package_num;
                         try
@@ -319,7 +336,7 @@ void Emotibit::read_thread ()
                          i++)
                     {
                         aux_packages[i][board_descr["auxiliary"]["timestamp_channel"].get<int> ()] =
-                            get_timestamp ();
+                            arrival_time;
                         aux_packages[i]
                                     [board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
                                         package_num;
@@ -397,7 +414,7 @@ void Emotibit::read_thread ()
                     for (int i = 0; i < (int)payload.size (); i++)
                     {
                         anc_packages[i][board_descr["ancillary"]["timestamp_channel"].get<int> ()] =
-                            get_timestamp ();
+                            arrival_time;
                         anc_packages[i]
                                     [board_descr["ancillary"]["package_num_channel"].get<int> ()] =
                                         package_num;
@@ -683,6 +700,12 @@ int Emotibit::create_data_connection ()
         if (data_socket->bind () == ((int)SocketClientUDPReturnCodes::STATUS_OK))
         {
             safe_logger (spdlog::level::info, "use port {} for data", data_port);
+            if (data_socket->enable_kernel_timestamps () !=
+                (int)SocketClientUDPReturnCodes::STATUS_OK)
+            {
+                safe_logger (
+                    spdlog::level::debug, "kernel timestamps are not supported, use recv time");
+            }
             res = (int)BrainFlowExitCodes::STATUS_OK;
             break;
         }
@@ -28,6 +28,8 @@ FreeEEG::FreeEEG (int board_id, struct BrainFlowInputParams params) : Board (boa
     {
         min_package_size = 1 + 128 * 3;
     }
+    eeg_scale = FreeEEG::ads_vref / float ((pow (2, 23) - 1)) / FreeEEG::ads_gain * 1000000.;
+    set_raw_scales ("eeg_channels", (double)eeg_scale);
 }
 
 FreeEEG::~FreeEEG ()
@@ -133,13 +135,13 @@ void FreeEEG::read_thread ()
     int res;
     constexpr int max_size = 1000; // random value bigger than package size which is unknown
     unsigned char b[max_size] = {0};
-    float eeg_scale = FreeEEG::ads_vref / float ((pow (2, 23) - 1)) / FreeEEG::ads_gain * 1000000.;
     int num_rows = board_descr["default"]["num_rows"];
-    double *package = new double[num_rows];
-    for (int i = 0; i < num_rows; i++)
+    double *packages = new double[num_rows * FreeEEG::packages_per_push];
+    for (int i = 0; i < num_rows * FreeEEG::packages_per_push; i++)
     {
-        package[i] = 0.0;
+        packages[i] = 0.0;
     }
+    int num_packages = 0;
     bool first_package_received = false;
 
     std::vector<int> eeg_channels = board_descr["default"]["eeg_channels"];
@@ -168,13 +170,19 @@ void FreeEEG::read_thread ()
                 first_package_received = true;
                 continue;
             }
+            double *package = packages + num_packages * num_rows;
             package[board_descr["default"]["package_num_channel"].get<int> ()] = (double)b[0];
             for (unsigned int i = 0; i < eeg_channels.size (); i++)
             {
                 package[eeg_channels[i]] = (double)eeg_scale * cast_24bit_to_int32 (b + 1 + 3 * i);
             }
             package[board_descr["default"]["timestamp_channel"].get<int> ()] = get_timestamp ();
-            push_package (package);
+            num_packages++;
+            if (num_packages == FreeEEG::packages_per_push)
+            {
+                push_packages (packages, num_packages);
+                num_packages = 0;
+            }
         }
         else
         {
@@ -182,7 +190,11 @@ void FreeEEG::read_thread ()
                 spdlog::level::trace, "stopped with pos: {}, keep_alive: {}", pos, keep_alive);
         }
     }
-    delete[] package;
+    if (num_packages > 0)
+    {
+        push_packages (packages, num_packages);
+    }
+    delete[] packages;
 }
 
 int FreeEEG::open_port ()
@@ -19,6 +19,7 @@ protected:
     // dont know exact package size and it can be changed with new firmware versions, its >=
     // min_package_size and we can check start\stop bytes, and it depends on exact board
     int min_package_size;
+    float eeg_scale; // microvolts per adc count
 
     int open_port ();
     int set_port_settings ();
@@ -38,4 +39,7 @@ public:
     static constexpr int end_byte = 0xC0;
     static constexpr double ads_gain = 8.0;
     static constexpr double ads_vref = 2.5;
+    // serial port reads byte by byte, batch a few packages to not lock board for each of them,
+    // adds less than 10ms of latency at 512Hz
+    static constexpr int packages_per_push = 4;
 };
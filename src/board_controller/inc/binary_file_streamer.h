@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "bfrec_compression.h"
+#include "bfrec_format.h"
+#include "file_streamer.h"
+#include "streamer.h"
+
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+// pending data is written when it reaches the size or when the oldest sample waits for the interval
+#define BFREC_WRITE_BUFFER_SIZE (64 * 1024)
+#define BFREC_FLUSH_INTERVAL_MS 1000
+
+
+// writes packages in bfrec format, see bfrec_format.h. Values are copied into write buffer as is
+// and written by large fwrite calls, there is no text formatting and no precision loss.
+// In compressed mode samples are collected into blocks of up to BFREC_BLOCK_SAMPLES and each
+// block is compressed losslessly, see bfrec_compression.h
+class BinaryFileStreamer : public Streamer
+{
+
+public:
+    BinaryFileStreamer (const char *file, const char *file_mode, int data_len, int board_id,
+        int preset, json preset_descr, bool compressed = false);
+    ~BinaryFileStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_packages (double *data, int count);
+
+private:
+    char file[BRAINFLOW_FILE_NAME_LIMIT];
+    char file_mode[BRAINFLOW_FILE_NAME_LIMIT];
+    FILE *fp;
+    BFRecHeader header;
+    std::vector<char> write_buffer;
+    size_t buffered_bytes;
+    std::chrono::steady_clock::time_point pending_since;
+    bool write_failed; // to log failed writes once until the next successful one
+    // compressed mode only
+    std::vector<double> block;
+    int block_samples;
+
+    int open_for_append ();
+    void flush_buffer ();
+    void flush_block ();
+    void flush_pending ();
+    void check_write (bool res, size_t bytes);
+};
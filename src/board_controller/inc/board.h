@@ -1,10 +1,17 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <condition_variable>
 #include <deque>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "board_controller.h"
 #include "brainflow_boards.h"
@@ -12,21 +19,149 @@
 #include "brainflow_input_params.h"
 #include "data_buffer.h"
 #include "spinlock.h"
+#include "spsc_data_buffer.h"
 #include "streamer.h"
 
 #include "spdlog/spdlog.h"
 
 #define MAX_CAPTURE_SAMPLES (86400 * 250) // should be enough for one day of capturing
 
+class StreamerPool;
+
+
+// consumers blocked in wait_for_board_data for a single preset
+struct DataWaiters
+{
+    std::multiset<int> thresholds; // guarded by Board::data_wait_mutex
+    std::atomic<int> min_threshold; // checked by push_package, 0 if nobody waits
+
+    DataWaiters () : min_threshold (0)
+    {
+    }
+};
+
+#define PUSH_LATENCY_BUCKETS 12      // from 1us to 1ms and the rest
+#define RATE_HISTORY_SIZE 10         // samples/s is computed over last 10 seconds
+#define MAX_GAP_PLACEHOLDERS 1000    // longer gaps are counted but not filled
+#define PACKAGE_NUM_MIN_WRAP_RANGE 8 // smaller drops of package num are late packages
+
+// counters of framed network transports, boards which receive frames with sequence numbers
+// report them via set_frame_metrics
+struct FrameMetrics
+{
+    uint64_t received;
+    uint64_t gaps;
+    uint64_t lost;
+    uint64_t out_of_order;
+    uint64_t invalid; // frames which can not be parsed
+    uint64_t restarts;
+    double delay_sum; // sum of receive time minus send time in seconds
+
+    FrameMetrics ()
+        : received (0)
+        , gaps (0)
+        , lost (0)
+        , out_of_order (0)
+        , invalid (0)
+        , restarts (0)
+        , delay_sum (0.0)
+    {
+    }
+};
+
+// instrumentation of a single preset, updated by push_packages under preset lock
+struct PresetMetrics
+{
+    uint64_t pushed;
+    size_t high_water_mark; // max number of packages in ring buffer
+    // bucket i counts pushes faster than 2^i us, the last one counts all other pushes
+    uint64_t push_latency[PUSH_LATENCY_BUCKETS];
+    // number of pushed packages once per second, used for samples/s over sliding window
+    double rate_times[RATE_HISTORY_SIZE];
+    uint64_t rate_pushed[RATE_HISTORY_SIZE];
+    int rate_entries;
+    int rate_next;
+    // package num tracking, enabled by BrainFlowInputParams::package_num_check
+    uint64_t package_gaps;
+    uint64_t lost_packages; // sum of gap lengths
+    uint64_t wraparounds;
+    uint64_t duplicates;   // repeated package nums and packages older than the last one
+    uint64_t placeholders; // NaN packages inserted instead of lost ones
+    double last_package_num; // -1 before the first package
+    double min_package_num;
+    double max_package_num;
+    double last_timestamp;
+    FrameMetrics frames;
+
+    PresetMetrics ()
+    {
+        reset ();
+    }
+
+    void reset ()
+    {
+        pushed = 0;
+        high_water_mark = 0;
+        for (int i = 0; i < PUSH_LATENCY_BUCKETS; i++)
+        {
+            push_latency[i] = 0;
+        }
+        rate_entries = 0;
+        rate_next = 0;
+        package_gaps = 0;
+        lost_packages = 0;
+        wraparounds = 0;
+        duplicates = 0;
+        placeholders = 0;
+        last_package_num = -1.0;
+        min_package_num = 0.0;
+        max_package_num = 0.0;
+        last_timestamp = 0.0;
+        frames = FrameMetrics ();
+    }
+};
+
+// named non destructive consumer of a single preset, position is a package number in data buffer
+struct ReaderCursor
+{
+    uint64_t position;
+    uint64_t overflow; // packages which were overwritten before this reader got them
+
+    ReaderCursor () : position (0), overflow (0)
+    {
+    }
+};
+
+// typed copy of a preset from board_descr, hot paths use it instead of json lookups
+struct PresetDescr
+{
+    std::string name;
+    int num_rows;
+    int timestamp_channel;   // -1 if there is no such field in preset
+    int marker_channel;      // -1 if there is no such field in preset
+    int package_num_channel; // -1 if there is no such field in preset
+    std::map<std::string, std::vector<int>> channels; // all *_channels arrays by json key
+
+    PresetDescr ()
+        : num_rows (0), timestamp_channel (-1), marker_channel (-1), package_num_channel (-1)
+    {
+    }
+};
 
 class Board
 {
 public:
-    static std::shared_ptr<spdlog::logger> board_logger;
     static JNIEnv *java_jnienv; // nullptr unless on java
     static int set_log_level (int log_level);
     static int set_log_file (const char *log_file);
 
+    // logger can be replaced by set_log_file while other sessions log, so each caller works with
+    // its own copy and keeps the old logger alive
+    static std::shared_ptr<spdlog::logger> get_board_logger ()
+    {
+        return std::atomic_load (&board_logger);
+    }
+
     virtual ~Board ()
     {
         skip_logs = true; // also should be set in inherited class destructor because it will be
@@ -37,16 +172,22 @@ public:
     Board (int board_id, struct BrainFlowInputParams params)
     {
         skip_logs = false;
+        streamer_pool = NULL;
         this->board_id = board_id;
         this->params = params;
-        try
+        // create all entries here, push_package reads these maps without locks
+        int presets[3] = {(int)BrainFlowPresets::DEFAULT_PRESET,
+            (int)BrainFlowPresets::AUXILIARY_PRESET, (int)BrainFlowPresets::ANCILLARY_PRESET};
+        for (int preset : presets)
         {
-            board_descr = boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)];
-        }
-        catch (json::exception &e)
-        {
-            safe_logger (spdlog::level::err, e.what ());
+            data_waiters[preset];
+            preset_locks[preset];
+            preset_metrics[preset];
+            gap_buffers[preset];
+            streamers[preset];
         }
+        board_descr = get_board_json (board_id);
+        parse_presets ();
     }
     virtual int prepare_session () = 0;
     virtual int start_stream (int buffer_size, const char *streamer_params) = 0;
@@ -65,12 +206,32 @@ public:
         int num_samples, int preset, double *data_buf, int *returned_samples);
     int get_board_data_count (int preset, int *result);
     int get_board_data (int data_count, int preset, double *data_buf);
+    // blocks until ring buffer has at least min_samples or timeout expires
+    int wait_for_board_data (int preset, int min_samples, int timeout_ms, int *result);
     int insert_marker (double value, int preset);
+    // each reader gets every package pushed after registration exactly once, independent from
+    // get_board_data and other readers
+    int register_reader (const char *reader_name, int preset);
+    int unregister_reader (const char *reader_name, int preset);
+    int read_since_cursor (const char *reader_name, int max_samples, int preset, double *data_buf,
+        int *returned_samples);
+    // lag is number of packages available for this reader, overflow is number of lost packages
+    int get_reader_stats (const char *reader_name, int preset, int *lag, int *overflow);
+    // json with counters of a preset: pushed and overwritten samples, ring buffer high water mark,
+    // streamer queues, push latency histogram and samples/s
+    int get_board_metrics (int preset, std::string &metrics);
     int add_streamer (const char *streamer_params, int preset);
     int delete_streamer (const char *streamer_params, int preset);
+    int register_data_callback (
+        brainflow_data_callback callback, void *user_data, int batch_size, int preset);
+    // callback streamers are only removed here, caller deletes them without any locks because
+    // their destructor waits for user callback and user callback may call board api
+    int detach_data_callback (int preset, Streamer **streamer);
+    std::vector<Streamer *> detach_data_callbacks ();
 
-    // Board::board_logger should not be called from destructors, to ensure that there are safe log
-    // methods Board::board_logger still available but should be used only outside destructors
+    // Board::get_board_logger should not be called from destructors, to ensure that there are safe
+    // log methods Board::get_board_logger still available but should be used only outside
+    // destructors
     template <typename Arg1, typename... Args>
     // clang-format off
     void safe_logger (
@@ -79,7 +240,7 @@ public:
     {
         if (!skip_logs)
         {
-            Board::board_logger->log (log_level, fmt, arg1, args...);
+            Board::get_board_logger ()->log (log_level, fmt, arg1, args...);
         }
     }
 
@@ -88,7 +249,7 @@ public:
     {
         if (!skip_logs)
         {
-            Board::board_logger->log (log_level, msg);
+            Board::get_board_logger ()->log (log_level, msg);
         }
     }
 
@@ -98,24 +259,61 @@ public:
     }
 
 protected:
-    std::map<int, DataBuffer *> dbs;
+    // only one thread pushes packages(under lock) and board controller serializes consumers
+    std::map<int, BaseDataBuffer *> dbs;
+    // guarded by preset_locks, push pins streamers to use them after unlock
     std::map<int, std::vector<Streamer *>> streamers;
+    StreamerPool *streamer_pool; // delivers data to all streamers except callbacks
     bool skip_logs;
     int board_id;
     struct BrainFlowInputParams params;
     json board_descr;
-    SpinLock lock;
+    std::map<int, PresetDescr> preset_descrs; // filled by parse_presets, read without locks
+    // value of one adc count per preset and channel, boards which push scaled integers fill it
+    // before start_stream to allow RAW_INT32 storage
+    std::map<int, std::map<int, double>> raw_scales;
+    // each preset has its own lock for markers, streamers and pushes, presets never contend
+    std::map<int, CountingSpinLock> preset_locks;
+    std::map<int, PresetMetrics> preset_metrics; // guarded by preset_locks
+    std::map<int, std::vector<double>> gap_buffers; // packages with placeholders, preset_locks
     std::map<int, std::deque<double>> marker_queues;
+    // guarded by board controller like other consumer methods
+    std::map<int, std::map<std::string, ReaderCursor>> readers;
+    // dbs can be modified only with data_wait_mutex held, waiters read it under this lock
+    std::mutex data_wait_mutex;
+    std::condition_variable data_wait_cv;
+    std::map<int, DataWaiters> data_waiters;
 
     int prepare_for_acquisition (int buffer_size, const char *streamer_params);
     void free_packages ();
+    // streamer must be removed from streamers already, waits for pushes which still use it
+    void wait_for_unpin (Streamer *streamer);
+    void free_data_buffers ();
+    void notify_data_waiters (int preset);
+    // returns number of packages in result, it is gap_buffer if placeholders were inserted
+    int check_package_nums (const PresetDescr &descr, PresetMetrics &metrics,
+        std::vector<double> &gap_buffer, double *packages, int count, double **result);
+    void update_push_metrics (PresetMetrics &metrics, int count,
+        std::chrono::steady_clock::time_point push_start,
+        std::chrono::steady_clock::time_point push_end);
     void push_package (double *package, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
-    std::string preset_to_string (int preset);
+    void set_frame_metrics (const FrameMetrics &frames, int preset);
+    // packages are sample major, the whole batch is added under one lock
+    void push_packages (
+        double *packages, int count, int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
+    // should be called each time board_descr is changed, no json lookups after that
+    void parse_presets ();
+    const char *preset_to_string (int preset);
+    std::vector<ChannelStorage> get_channel_storage (int preset);
+    // marks all channels from *_channels field as scale * integer
+    void set_raw_scales (const std::string &channels, double scale,
+        int preset = (int)BrainFlowPresets::DEFAULT_PRESET);
     int preset_to_int (std::string preset);
+    int find_reader (const char *reader_name, int preset, ReaderCursor **reader);
     int parse_streamer_params (const char *streamer_params, std::string &streamer_type,
         std::string &streamer_dest, std::string &streamer_mods);
 
 private:
-    // reshapes data from DataBuffer format where all channels are mixed to linear buffer
-    void reshape_data (int data_count, int preset, const double *buf, double *output_buf);
+    // replaced only with std::atomic_store, use get_board_logger to read it
+    static std::shared_ptr<spdlog::logger> board_logger;
 };
@@ -4,10 +4,59 @@
 
 using json = nlohmann::json;
 
-struct BrainFlowBoards
+#define BOARD_CHANNEL_TYPES 14
+
+
+// json key of each type is "<name>_channels", see get_board_channel_type_name
+enum class BoardChannelTypes : int
+{
+    EEG = 0,
+    EMG = 1,
+    ECG = 2,
+    EOG = 3,
+    EDA = 4,
+    PPG = 5,
+    ACCEL = 6,
+    ROTATION = 7,
+    ANALOG = 8,
+    GYRO = 9,
+    OTHER = 10,
+    TEMPERATURE = 11,
+    RESISTANCE = 12,
+    MAGNETOMETER = 13
+};
+
+// list of channels of a single type, values is NULL for unused entries
+struct BoardChannels
+{
+    BoardChannelTypes type;
+    const int *values;
+    int len;
+};
+
+// description of a single preset, table of them is static data so nothing is built on library
+// load. Integer fields are -1 and strings are NULL if they are not set for this preset
+struct BoardPresetDescr
 {
-    json brainflow_boards_json;
-    BrainFlowBoards ();
+    int board_id;
+    int preset;
+    const char *name;
+    int sampling_rate;
+    int package_num_channel;
+    int timestamp_channel;
+    int marker_channel;
+    int num_rows;
+    int battery_channel;
+    const char *eeg_names;
+    BoardChannels channels[BOARD_CHANNEL_TYPES];
 };
 
-extern BrainFlowBoards boards_struct;
+// NULL if there is no such board or preset
+const BoardPresetDescr *get_board_preset_descr (int board_id, int preset);
+// NULL if preset does not have channels of this type
+const BoardChannels *get_board_channels (const BoardPresetDescr *descr, BoardChannelTypes type);
+const char *get_board_channel_type_name (BoardChannelTypes type);
+// json is built on demand, it has the same format as board descriptions had before
+json get_board_preset_json (const BoardPresetDescr *descr);
+// all presets of a board by preset name, null json if there is no such board
+json get_board_json (int board_id);
@@ -24,6 +24,8 @@ struct BrainFlowInputParams
     std::string file_aux;
     std::string file_anc;
     int master_board;
+    int buffer_storage; // BufferStorageTypes, doesnt identify a session so not used in operators
+    int package_num_check; // PackageNumCheckTypes, not used in operators as well
 
     BrainFlowInputParams ()
     {
@@ -43,6 +45,8 @@ struct BrainFlowInputParams
         file_aux = "";
         file_anc = "";
         master_board = (int)BoardIds::NO_BOARD;
+        buffer_storage = (int)BufferStorageTypes::FLOAT64;
+        package_num_check = (int)PackageNumCheckTypes::OFF;
     }
 
     // default copy constructor and assignment operator are ok, need less operator to use in map
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "board_controller.h"
+#include "spsc_data_buffer.h"
+#include "streamer.h"
+
+// ring of callback streamer keeps 10 batches
+#define CALLBACK_STREAMER_MAX_BATCH_SIZE 10000
+
+
+// calls user callback from its own thread with channel major batches of batch_size packages, so
+// slow callbacks dont block read thread
+class CallbackStreamer : public Streamer
+{
+
+public:
+    CallbackStreamer (brainflow_data_callback callback, void *user_data, int batch_size,
+        int preset, int data_len);
+    ~CallbackStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_packages (double *data, int count);
+
+private:
+    brainflow_data_callback callback;
+    void *user_data;
+    int batch_size;
+    int preset;
+    SPSCDataBuffer *db;
+    volatile bool is_streaming;
+    std::thread streaming_thread;
+    std::mutex wait_mutex;
+    std::condition_variable wait_cv;
+
+    void thread_worker ();
+};
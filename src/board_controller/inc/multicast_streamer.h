@@ -1,29 +1,41 @@
 #pragma once
 
-#include <thread>
+#include <stdint.h>
+#include <vector>
 
-#include "data_buffer.h"
 #include "multicast_server.h"
+#include "stream_frame.h"
 #include "streamer.h"
 
+#define MULTICAST_STREAMER_MAX_FRAMES 16
 
+
+// sends framed transactions, see stream_frame.h, runs in streamer pool workers. Number of packages
+// in frame covers BRAINFLOW_STREAM_LATENCY_MS of data at board sampling rate and frame fits into
+// BRAINFLOW_STREAM_MTU, BRAINFLOW_BATCH_SIZE limits it further if set. Frames created from one
+// call of stream_packages are sent by single batch send
 class MultiCastStreamer : public Streamer
 {
 
 public:
-    MultiCastStreamer (const char *ip, int port, int data_len);
+    MultiCastStreamer (const char *ip, int port, int data_len, int preset, int sampling_rate);
     ~MultiCastStreamer ();
 
     int init_streamer ();
     void stream_data (double *data);
+    void stream_packages (double *data, int count);
 
 private:
     char ip[128];
     int port;
     MultiCastServer *server;
-    DataBuffer *db;
-    volatile bool is_streaming;
-    std::thread streaming_thread;
-
-    void thread_worker ();
+    double *transaction;
+    int transaction_packages; // size of transaction
+    int num_packages;         // packages already copied to transaction
+    StreamFrameHeader frame_header;
+    std::vector<char> frame;
+    DatagramBatch *frames;
+
+    void send_transaction ();
+    void send_frames ();
 };
@@ -17,12 +17,14 @@ private:
     volatile bool loopback;
     volatile bool use_new_timestamps;
     std::vector<double> pos_percentage;
+    SpinLock lock; // guards pos_percentage
     std::vector<std::thread> streaming_threads;
     bool initialized;
-    std::vector<std::vector<long int>> file_offsets;
+    std::vector<std::vector<long int>> file_offsets; // text files only
+    std::vector<long> file_num_samples;             // binary files only, they are seeked by sample
 
     void read_thread (int preset, std::string filename);
-    int get_file_offsets (std::string filename, std::vector<long int> &offsets);
+    int get_file_offsets (std::string filename, std::vector<long int> &offsets, long &num_samples);
 
 public:
     PlaybackFileBoard (struct BrainFlowInputParams params);
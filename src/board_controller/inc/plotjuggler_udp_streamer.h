@@ -1,8 +1,8 @@
 #pragma once
 
-#include <thread>
+#include <string>
+#include <vector>
 
-#include "data_buffer.h"
 #include "socket_client_udp.h"
 #include "streamer.h"
 
@@ -11,6 +11,7 @@
 using json = nlohmann::json;
 
 
+// sends json object per package, runs in streamer pool workers
 class PlotJugglerUDPStreamer : public Streamer
 {
 
@@ -25,11 +26,16 @@ private:
     char ip[128];
     int port;
     SocketClientUDP *socket;
-    DataBuffer *db;
-    volatile bool is_streaming;
-    std::thread streaming_thread;
-    json preset_descr;
-
-    void thread_worker ();
+    // where to put each channel in output json, prepared once from preset description
+    struct PlotJugglerField
+    {
+        std::string prefix;
+        std::string channel_name; // empty for single channel fields like battery
+        int index;
+    };
+    std::string name;
+    std::vector<PlotJugglerField> fields;
+
+    void parse_preset (json preset_descr);
     std::string remove_substr (std::string str, std::string substr);
 };
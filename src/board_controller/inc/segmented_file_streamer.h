@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "bfrec_compression.h"
+#include "bfrec_segments.h"
+#include "binary_file_streamer.h"
+#include "file_streamer.h"
+#include "streamer.h"
+
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+#define SEGMENTED_FILE_DEFAULT_SIZE_MB 100
+#define SEGMENTED_FILE_DEFAULT_DURATION 3600
+
+
+// writes compressed bfrec segments and sidecar time index, see bfrec_segments.h. Segment is
+// closed when it reaches max size or when timestamps in it cover max duration, checks are done
+// after each block. Incomplete block is written after BFREC_FLUSH_INTERVAL_MS, so slow presets
+// dont keep data only in memory. Existing recording with the same prefix is continued from the
+// next segment
+class SegmentedFileStreamer : public Streamer
+{
+
+public:
+    // mods: "size_mb=N,duration=N", duration is in seconds, 0 disables the limit
+    SegmentedFileStreamer (
+        const char *prefix, const char *mods, int data_len, int board_id, int preset, json descr);
+    ~SegmentedFileStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_packages (double *data, int count);
+
+private:
+    std::string prefix;
+    int64_t max_size;
+    double max_duration;
+    int timestamp_channel;
+    BFRecHeader header;
+    FILE *index_fp;
+    FILE *segment_fp;
+    int segment;
+    int64_t segment_size;
+    double segment_start;
+    std::vector<double> block;
+    int block_samples;
+    std::chrono::steady_clock::time_point pending_since;
+    bool write_failed; // to log failed writes once until the next successful one
+    std::vector<char> write_buffer;
+
+    int parse_mods ();
+    int open_index ();
+    int open_segment ();
+    void close_segment ();
+    void flush_block ();
+    void flush_pending ();
+    void check_write (bool res, int num_samples);
+};
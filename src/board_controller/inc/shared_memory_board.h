@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "board_controller.h"
+#include "shared_memory_ring.h"
+
+#define SHARED_MEMORY_BOARD_MAX_SAMPLES 4096
+#define SHARED_MEMORY_BOARD_POLL_US 200
+
+
+// reads packages from shared memory rings created by "shm" streamer of another session on the same
+// host, ring names are taken from file, file_aux and file_anc fields. There is no cross process
+// wakeup, read thread polls ring and checks if writer was restarted about once per second
+class SharedMemoryBoard : public Board
+{
+
+private:
+    volatile bool keep_alive;
+    bool initialized;
+    std::vector<std::thread> streaming_threads;
+    std::vector<SharedMemoryRing *> rings;
+    std::vector<std::string> names;
+    std::vector<int> presets;
+
+    void read_thread (int num);
+    int open_ring (int num);
+
+public:
+    SharedMemoryBoard (struct BrainFlowInputParams params);
+    ~SharedMemoryBoard ();
+
+    int prepare_session ();
+    int start_stream (int buffer_size, const char *streamer_params);
+    int stop_stream ();
+    int release_session ();
+    int config_board (std::string config, std::string &response);
+};
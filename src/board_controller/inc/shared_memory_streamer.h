@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+#include "shared_memory_ring.h"
+#include "streamer.h"
+
+#define SHARED_MEMORY_STREAMER_DEFAULT_DURATION 60
+#define SHARED_MEMORY_STREAMER_MIN_SAMPLES 1024
+
+
+// writes packages to shared memory ring, see shared_memory_ring.h, readers on the same host get
+// them with SharedMemoryBoard without any copy through sockets. Ring is recreated if streamer with
+// the same name is added again
+class SharedMemoryStreamer : public Streamer
+{
+
+public:
+    // mods: "seconds=N,samples=N", ring holds N seconds of data at sampling rate or N samples,
+    // samples wins if both are set
+    SharedMemoryStreamer (const char *name, const char *mods, int data_len, int board_id,
+        int preset, int sampling_rate);
+    ~SharedMemoryStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_packages (double *data, int count);
+
+private:
+    std::string name;
+    int board_id;
+    int preset;
+    int sampling_rate;
+    int capacity;
+    SharedMemoryRing ring;
+
+    int parse_mods ();
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 
 class Streamer
@@ -11,6 +12,7 @@ public:
         streamer_type = type;
         streamer_dest = dest;
         streamer_mods = mods;
+        pins = 0;
     }
 
     virtual ~Streamer ()
@@ -20,14 +22,46 @@ public:
     virtual int init_streamer () = 0;
     virtual void stream_data (double *data) = 0;
 
+    // data is sample major, streamers which can handle a batch at once should override it
+    virtual void stream_packages (double *data, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            stream_data (data + i * len);
+        }
+    }
+
+    int get_len ()
+    {
+        return len;
+    }
+
     virtual bool check_equals (std::string type, std::string dest, std::string mods)
     {
         return ((streamer_type == type) && (streamer_dest == dest) && (streamer_mods == mods));
     }
 
+    // board pins streamers to push packages outside of preset lock, streamer removed from board
+    // can be deleted only when it is not pinned anymore
+    void pin ()
+    {
+        pins++;
+    }
+
+    void unpin ()
+    {
+        pins--;
+    }
+
+    bool is_pinned ()
+    {
+        return (pins > 0);
+    }
+
 protected:
     std::string streamer_type;
     std::string streamer_dest;
     std::string streamer_mods;
     int len;
+    std::atomic<int> pins;
 };
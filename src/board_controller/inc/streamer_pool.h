@@ -0,0 +1,95 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "streamer.h"
+
+
+class StreamerPool;
+
+// what happens if streamer queue is full
+enum class StreamerOverflowPolicy : int
+{
+    DROP = 0,  // new packages are dropped, read thread never waits
+    BLOCK = 1, // read thread waits until pool worker frees space
+};
+
+// lag metrics of a single streamer, updated by pool workers
+struct StreamerStats
+{
+    size_t queue_depth;     // packages waiting for delivery right now
+    size_t max_queue_depth; // since streamer creation
+    uint64_t dropped;       // packages dropped because queue was full
+    double last_lag;        // seconds between enqueue of the oldest package and end of delivery
+    double max_lag;
+
+    StreamerStats ()
+        : queue_depth (0), max_queue_depth (0), dropped (0), last_lag (0.0), max_lag (0.0)
+    {
+    }
+};
+
+// wraps streamer and moves its work to StreamerPool, push only copies packages into bounded queue.
+// Only one pool worker delivers packages of a streamer at a time, so order is preserved
+class AsyncStreamer : public Streamer
+{
+
+public:
+    // takes ownership of streamer
+    AsyncStreamer (Streamer *streamer, StreamerPool *pool, size_t max_packages,
+        StreamerOverflowPolicy policy);
+    ~AsyncStreamer ();
+
+    int init_streamer ();
+    void stream_data (double *data);
+    void stream_packages (double *data, int count);
+    bool check_equals (std::string type, std::string dest, std::string mods);
+
+    StreamerStats get_stats ();
+    // called by pool workers only
+    void deliver ();
+
+private:
+    Streamer *streamer;
+    StreamerPool *pool;
+    StreamerOverflowPolicy policy;
+    size_t max_packages;
+    double *queue;
+    double *batch;
+    size_t first;
+    size_t count;
+    double oldest_timestamp;
+    bool scheduled; // true from enqueue till worker finds queue empty
+    bool drop_reported;
+    StreamerStats stats;
+    std::mutex m;
+    std::condition_variable state_changed;
+};
+
+// worker threads which deliver packages for all async streamers of a board, workers sleep on
+// condition variable until something is scheduled
+class StreamerPool
+{
+
+public:
+    StreamerPool (int num_threads);
+    // delivers everything already scheduled before return
+    ~StreamerPool ();
+
+    void schedule (AsyncStreamer *streamer);
+
+private:
+    std::mutex m;
+    std::condition_variable cv;
+    std::deque<AsyncStreamer *> ready;
+    bool keep_alive;
+    std::vector<std::thread> workers;
+
+    void thread_worker ();
+};
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstdlib>
 #include <string.h>
 #include <string>
@@ -7,42 +8,70 @@
 #include "brainflow_env_vars.h"
 #include "file_streamer.h"
 #include "multicast_streamer.h"
+#include "timestamp.h"
 
 
-MultiCastStreamer::MultiCastStreamer (const char *ip, int port, int data_len)
+MultiCastStreamer::MultiCastStreamer (
+    const char *ip, int port, int data_len, int preset, int sampling_rate)
     : Streamer (data_len, "streaming_board", ip, std::to_string (port))
 {
     strcpy (this->ip, ip);
     this->port = port;
     server = NULL;
-    is_streaming = false;
-    db = NULL;
+    transaction = NULL;
+    frames = NULL;
+    num_packages = 0;
+    std::string encoding = get_brainflow_stream_encoding ();
+    if (encoding == "f32")
+    {
+        frame_header.encoding = StreamFrameEncodings::FLOAT32;
+    }
+    else if (encoding == "int24")
+    {
+        frame_header.encoding = StreamFrameEncodings::INT24;
+    }
+    frame_header.num_rows = data_len;
+    frame_header.preset = preset;
+    int max_packages = stream_frame_max_samples (frame_header.encoding, data_len,
+        get_brainflow_stream_mtu () - STREAM_FRAME_IP_UDP_OVERHEAD);
+    transaction_packages = sampling_rate * get_brainflow_stream_latency_ms () / 1000;
+    int batch_size = get_brainflow_batch_size (0);
+    if (batch_size > 0)
+    {
+        transaction_packages = batch_size;
+    }
+    transaction_packages = std::max (1, std::min (transaction_packages, max_packages));
 }
 
 MultiCastStreamer::~MultiCastStreamer ()
 {
-    if ((streaming_thread.joinable ()) && (is_streaming))
+    if ((server != NULL) && (num_packages > 0))
     {
-        is_streaming = false;
-        streaming_thread.join ();
+        send_transaction ();
+        send_frames ();
     }
     if (server != NULL)
     {
         delete server;
         server = NULL;
     }
-    if (db != NULL)
+    if (frames != NULL)
+    {
+        delete frames;
+        frames = NULL;
+    }
+    if (transaction != NULL)
     {
-        delete db;
-        db = NULL;
+        delete[] transaction;
+        transaction = NULL;
     }
 }
 
 int MultiCastStreamer::init_streamer ()
 {
-    if ((is_streaming) || (server != NULL) || (db != NULL))
+    if ((server != NULL) || (transaction != NULL))
     {
-        Board::board_logger->error ("multicast streamer is running");
+        Board::get_board_logger ()->error ("multicast streamer is running");
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 
@@ -52,55 +81,61 @@ int MultiCastStreamer::init_streamer ()
     {
         delete server;
         server = NULL;
-        Board::board_logger->error ("failed to init server multicast socket {}", res);
+        Board::get_board_logger ()->error ("failed to init server multicast socket {}", res);
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 
-    db = new DataBuffer (len, 1000);
-    if (!db->is_ready ())
+    transaction = new double[transaction_packages * len];
+    for (int i = 0; i < transaction_packages * len; i++)
     {
-        Board::board_logger->error ("unable to prepare buffer for multicast");
-        delete db;
-        db = NULL;
-        delete server;
-        server = NULL;
-        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+        transaction[i] = 0.0;
     }
-
-    is_streaming = true;
-    streaming_thread = std::thread ([this] { this->thread_worker (); });
+    num_packages = 0;
+    frames = new DatagramBatch (MULTICAST_STREAMER_MAX_FRAMES,
+        (int)stream_frame_size (frame_header.encoding, len, transaction_packages));
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void MultiCastStreamer::stream_data (double *data)
 {
-    db->add_data (data);
+    stream_packages (data, 1);
 }
 
-void MultiCastStreamer::thread_worker ()
+void MultiCastStreamer::stream_packages (double *data, int count)
 {
-    int num_packages = get_brainflow_batch_size ();
-    int transaction_len = num_packages * len;
-    double *transaction = new double[transaction_len];
-    for (int i = 0; i < transaction_len; i++)
+    while (count > 0)
     {
-        transaction[i] = 0.0;
-    }
-    while (is_streaming)
-    {
-        if (db->get_data_count () >= (size_t)num_packages)
-        {
-            db->get_data (num_packages, transaction);
-            server->send (transaction, sizeof (double) * transaction_len);
-        }
-        else
+        int packages_to_copy = std::min (count, transaction_packages - num_packages);
+        memcpy (transaction + num_packages * len, data, sizeof (double) * len * packages_to_copy);
+        num_packages += packages_to_copy;
+        data += packages_to_copy * len;
+        count -= packages_to_copy;
+        if (num_packages == transaction_packages)
         {
-#ifdef _WIN32
-            Sleep (1);
-#else
-            usleep (100);
-#endif
+            send_transaction ();
         }
     }
-    delete[] transaction;
+    send_frames ();
+}
+
+void MultiCastStreamer::send_transaction ()
+{
+    frame_header.num_samples = num_packages;
+    frame_header.send_timestamp = get_timestamp ();
+    stream_frame_encode (frame_header, transaction, frame);
+    if (frames->get_count () == frames->get_max_datagrams ())
+    {
+        send_frames ();
+    }
+    frames->add (frame.data (), (int)frame.size ());
+    frame_header.sequence++;
+    num_packages = 0;
+}
+
+void MultiCastStreamer::send_frames ()
+{
+    if (frames->get_count () > 0)
+    {
+        server->send_batch (*frames);
+    }
 }
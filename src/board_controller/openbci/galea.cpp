@@ -31,6 +31,11 @@ Galea::Galea (struct BrainFlowInputParams params) : Board ((int)BoardIds::GALEA_
     initialized = false;
     state = (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR;
     half_rtt = 0.0;
+    // step for the max gain 24, values for other gains are integer multiples of it
+    double exg_step = 4.5 / float ((pow (2, 23) - 1)) / 24.0 * 1000000.;
+    set_raw_scales ("emg_channels", exg_step);
+    set_raw_scales ("eog_channels", exg_step);
+    set_raw_scales ("eeg_channels", exg_step);
 }
 
 Galea::~Galea ()
@@ -71,6 +76,11 @@ int Galea::prepare_session ()
 
     safe_logger (spdlog::level::trace, "timeout for socket is {}", socket_timeout);
     socket->set_timeout (socket_timeout);
+    // packages are timestamped by kernel on arrival, so read thread jitter doesnt affect them
+    if (socket->enable_kernel_timestamps () != (int)SocketClientUDPReturnCodes::STATUS_OK)
+    {
+        safe_logger (spdlog::level::debug, "kernel timestamps are not supported, use recv time");
+    }
     // force default settings for device
     std::string tmp;
     std::string default_settings = "o"; // use demo mode with agnd
@@ -340,39 +350,48 @@ int Galea::release_session ()
 void Galea::read_thread ()
 {
     int res;
-    unsigned char b[Galea::max_transaction_size];
+    // all datagrams which are already in socket buffer are received per wakeup
+    DatagramBatch batch (DATAGRAM_BATCH_DEFAULT_SIZE, Galea::max_transaction_size);
+    int num_datagrams = 0;
+    int datagram = 0;
     DataBuffer time_buffer (1, 11);
     double latest_times[10];
-    for (int i = 0; i < Galea::max_transaction_size; i++)
-    {
-        b[i] = 0;
-    }
 
     int num_exg_rows = board_descr["default"]["num_rows"];
     int num_aux_rows = board_descr["auxiliary"]["num_rows"];
-    double *exg_package = new double[num_exg_rows];
-    double *aux_package = new double[num_aux_rows];
-    for (int i = 0; i < num_exg_rows; i++)
+    // all packages from one transaction are pushed at once
+    double *exg_packages = new double[num_exg_rows * Galea::max_num_packages];
+    double *aux_packages = new double[num_aux_rows * Galea::max_num_packages];
+    for (int i = 0; i < num_exg_rows * Galea::max_num_packages; i++)
     {
-        exg_package[i] = 0.0;
+        exg_packages[i] = 0.0;
     }
-    for (int i = 0; i < num_aux_rows; i++)
+    for (int i = 0; i < num_aux_rows * Galea::max_num_packages; i++)
     {
-        aux_package[i] = 0.0;
+        aux_packages[i] = 0.0;
     }
 
     while (keep_alive)
     {
-        res = socket->recv (b, Galea::max_transaction_size);
-        if (res == -1)
+        if (datagram == num_datagrams)
         {
+            datagram = 0;
+            num_datagrams = socket->recv_batch (batch);
+            if (num_datagrams == -1)
+            {
+                num_datagrams = 0;
 #ifdef _WIN32
-            safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
+                safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
 #else
-            safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
+                safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
 #endif
-            continue;
+                continue;
+            }
         }
+        unsigned char *b = (unsigned char *)batch.get_datagram (datagram);
+        res = batch.get_size (datagram);
+        double arrival_time = batch.get_arrival_time (datagram);
+        datagram++;
         if (res % Galea::package_size != 0)
         {
             if (res > 0)
@@ -389,7 +408,7 @@ void Galea::read_thread ()
             int offset_last_package = Galea::package_size * (num_packages - 1);
             // calc delta between PC timestamp and device timestamp in last 10 packages,
             // use this delta later on to assign timestamps
-            double pc_timestamp = get_timestamp ();
+            double pc_timestamp = arrival_time;
             double timestamp_last_package = 0.0;
             memcpy (&timestamp_last_package, b + 64 + offset_last_package, 8);
             timestamp_last_package /= 1000; // from ms to seconds
@@ -416,9 +435,11 @@ void Galea::read_thread ()
                 safe_logger (spdlog::level::debug, "start streaming");
             }
 
+            int num_aux_packages = 0;
             for (int cur_package = 0; cur_package < num_packages; cur_package++)
             {
                 int offset = cur_package * package_size;
+                double *exg_package = exg_packages + cur_package * num_exg_rows;
                 // exg (default preset)
                 exg_package[board_descr["default"]["package_num_channel"].get<int> ()] =
                     (double)b[0 + offset];
@@ -438,11 +459,12 @@ void Galea::read_thread ()
                 exg_package[board_descr["default"]["other_channels"][0].get<int> ()] = pc_timestamp;
                 exg_package[board_descr["default"]["other_channels"][1].get<int> ()] =
                     timestamp_device;
-                push_package (exg_package);
 
                 // aux, 5 times smaller sampling rate
                 if (((int)b[0 + offset]) % 5 == 0)
                 {
+                    double *aux_package = aux_packages + num_aux_packages * num_aux_rows;
+                    num_aux_packages++;
                     aux_package[board_descr["auxiliary"]["package_num_channel"].get<int> ()] =
                         (double)b[0 + offset];
                     uint16_t temperature = 0;
@@ -473,14 +495,18 @@ void Galea::read_thread ()
                         pc_timestamp;
                     aux_package[board_descr["auxiliary"]["other_channels"][1].get<int> ()] =
                         timestamp_device;
-
-                    push_package (aux_package, (int)BrainFlowPresets::AUXILIARY_PRESET);
                 }
             }
+            push_packages (exg_packages, num_packages);
+            if (num_aux_packages > 0)
+            {
+                push_packages (
+                    aux_packages, num_aux_packages, (int)BrainFlowPresets::AUXILIARY_PRESET);
+            }
         }
     }
-    delete[] exg_package;
-    delete[] aux_package;
+    delete[] exg_packages;
+    delete[] aux_packages;
 }
 
 int Galea::calc_time (std::string &resp)
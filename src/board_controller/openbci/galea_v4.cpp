@@ -72,6 +72,11 @@ int GaleaV4::prepare_session ()
 
     safe_logger (spdlog::level::trace, "timeout for socket is {}", socket_timeout);
     socket->set_timeout (socket_timeout);
+    // packages are timestamped by kernel on arrival, so read thread jitter doesnt affect them
+    if (socket->enable_kernel_timestamps () != (int)SocketClientUDPReturnCodes::STATUS_OK)
+    {
+        safe_logger (spdlog::level::debug, "kernel timestamps are not supported, use recv time");
+    }
     // force default settings for device
     std::string tmp;
     std::string default_settings = "d"; // use default mode
@@ -358,13 +363,12 @@ int GaleaV4::release_session ()
 void GaleaV4::read_thread ()
 {
     int res;
-    unsigned char b[GaleaV4::max_transaction_size];
+    // all datagrams which are already in socket buffer are received per wakeup
+    DatagramBatch batch (DATAGRAM_BATCH_DEFAULT_SIZE, GaleaV4::max_transaction_size);
+    int num_datagrams = 0;
+    int datagram = 0;
     DataBuffer time_buffer (1, 11);
     double latest_times[10];
-    for (int i = 0; i < GaleaV4::max_transaction_size; i++)
-    {
-        b[i] = 0;
-    }
 
     int num_exg_rows = board_descr["default"]["num_rows"];
     int num_aux_rows = board_descr["auxiliary"]["num_rows"];
@@ -381,16 +385,25 @@ void GaleaV4::read_thread ()
 
     while (keep_alive)
     {
-        res = socket->recv (b, GaleaV4::max_transaction_size);
-        if (res == -1)
+        if (datagram == num_datagrams)
         {
+            datagram = 0;
+            num_datagrams = socket->recv_batch (batch);
+            if (num_datagrams == -1)
+            {
+                num_datagrams = 0;
 #ifdef _WIN32
-            safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
+                safe_logger (spdlog::level::err, "WSAGetLastError is {}", WSAGetLastError ());
 #else
-            safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
+                safe_logger (spdlog::level::err, "errno {} message {}", errno, strerror (errno));
 #endif
-            continue;
+                continue;
+            }
         }
+        unsigned char *b = (unsigned char *)batch.get_datagram (datagram);
+        res = batch.get_size (datagram);
+        double arrival_time = batch.get_arrival_time (datagram);
+        datagram++;
         if (res % GaleaV4::package_size != 0)
         {
             if (res > 0)
@@ -407,7 +420,7 @@ void GaleaV4::read_thread ()
             int offset_last_package = GaleaV4::package_size * (num_packages - 1);
             // calc delta between PC timestamp and device timestamp in last 10 packages,
             // use this delta later on to assign timestamps
-            double pc_timestamp = get_timestamp ();
+            double pc_timestamp = arrival_time;
             double timestamp_last_package = 0.0;
             memcpy (&timestamp_last_package, b + 88 + offset_last_package, 8);
             timestamp_last_package /= 1000; // from ms to seconds
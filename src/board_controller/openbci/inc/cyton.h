@@ -17,6 +17,9 @@ public:
     Cyton (struct BrainFlowInputParams params)
         : OpenBCISerialBoard (params, (int)BoardIds::CYTON_BOARD)
     {
+        // step for the max gain 24, values for other gains are integer multiples of it
+        set_raw_scales ("eeg_channels", 4.5 / float ((pow (2, 23) - 1)) / 24.0 * 1000000.);
+        set_raw_scales ("accel_channels", 0.002 / (pow (2, 4)));
     }
 
     int config_board (std::string config, std::string &response);
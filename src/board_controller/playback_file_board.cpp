@@ -11,6 +11,7 @@
 #include <unistd.h>
 #endif
 
+#include "bfrec_format.h"
 #include "playback_file_board.h"
 #include "timestamp.h"
 
@@ -58,7 +59,8 @@ int PlaybackFileBoard::prepare_session ()
     try
     {
         board_id = params.master_board;
-        board_descr = boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)];
+        board_descr = get_board_json (board_id);
+        parse_presets ();
     }
     catch (json::exception &e)
     {
@@ -77,7 +79,8 @@ int PlaybackFileBoard::prepare_session ()
     if (!params.file.empty ())
     {
         std::vector<long int> offsets;
-        int res = get_file_offsets (params.file, offsets);
+        long num_samples = 0;
+        int res = get_file_offsets (params.file, offsets, num_samples);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
             return res;
@@ -85,12 +88,14 @@ int PlaybackFileBoard::prepare_session ()
         else
         {
             file_offsets.push_back (offsets);
+            file_num_samples.push_back (num_samples);
         }
     }
     if (!params.file_aux.empty ())
     {
         std::vector<long int> offsets;
-        int res = get_file_offsets (params.file_aux, offsets);
+        long num_samples = 0;
+        int res = get_file_offsets (params.file_aux, offsets, num_samples);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
             return res;
@@ -98,12 +103,14 @@ int PlaybackFileBoard::prepare_session ()
         else
         {
             file_offsets.push_back (offsets);
+            file_num_samples.push_back (num_samples);
         }
     }
     if (!params.file_anc.empty ())
     {
         std::vector<long int> offsets;
-        int res = get_file_offsets (params.file_anc, offsets);
+        long num_samples = 0;
+        int res = get_file_offsets (params.file_anc, offsets, num_samples);
         if (res != (int)BrainFlowExitCodes::STATUS_OK)
         {
             return res;
@@ -111,6 +118,7 @@ int PlaybackFileBoard::prepare_session ()
         else
         {
             file_offsets.push_back (offsets);
+            file_num_samples.push_back (num_samples);
         }
     }
 
@@ -180,6 +188,7 @@ int PlaybackFileBoard::release_session ()
         initialized = false;
     }
     file_offsets.clear ();
+    file_num_samples.clear ();
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
@@ -202,6 +211,23 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
 
     json board_preset = board_descr[preset_str];
     int num_rows = board_preset["num_rows"];
+    // binary recordings are read by BFRecReader, it seeks by sample index
+    BFRecReader bfrec_reader;
+    bool is_bfrec = bfrec_check_magic (fp);
+    if (is_bfrec)
+    {
+        fclose (fp);
+        fp = NULL;
+        if ((bfrec_reader.open (file.c_str ()) != (int)BrainFlowExitCodes::STATUS_OK) ||
+            (bfrec_reader.get_header ().num_rows != num_rows))
+        {
+            safe_logger (spdlog::level::err,
+                "invalid binary file header, check provided board id. Rows in file {}, expected "
+                "{}",
+                bfrec_reader.get_header ().num_rows, num_rows);
+            return;
+        }
+    }
     double *package = new double[num_rows];
     for (int i = 0; i < num_rows; i++)
     {
@@ -222,10 +248,19 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         double cur_index = pos_percentage[preset];
         if ((int)cur_index >= 0)
         {
-            int new_pos = (int)(cur_index * (file_offsets[preset].size () / 100.0));
+            long new_pos = 0;
             try
             {
-                fseek (fp, file_offsets[preset][new_pos], SEEK_SET);
+                if (is_bfrec)
+                {
+                    new_pos = (long)(cur_index * file_num_samples[preset] / 100.0);
+                    bfrec_reader.seek (new_pos);
+                }
+                else
+                {
+                    new_pos = (long)(cur_index * (file_offsets[preset].size () / 100.0));
+                    fseek (fp, file_offsets[preset][new_pos], SEEK_SET);
+                }
                 safe_logger (spdlog::level::trace, "set position in a file to {}", new_pos);
             }
             catch (...)
@@ -237,14 +272,29 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
             pos_percentage[preset] = -1;
         }
         lock.unlock ();
-        char *res = fgets (buf, sizeof (buf), fp);
-        if ((loopback) && (res == NULL))
+        bool has_package = false;
+        if (is_bfrec)
+        {
+            has_package = (bfrec_reader.read (1, package) == 1);
+        }
+        else
+        {
+            has_package = (fgets (buf, sizeof (buf), fp) != NULL);
+        }
+        if ((loopback) && (!has_package))
         {
-            fseek (fp, 0, SEEK_SET); // go to beginning'
+            if (is_bfrec)
+            {
+                bfrec_reader.seek (0);
+            }
+            else
+            {
+                fseek (fp, 0, SEEK_SET); // go to beginning'
+            }
             last_timestamp = -1.0;
             continue;
         }
-        if ((!loopback) && (res == NULL))
+        if ((!loopback) && (!has_package))
         {
             if (!reached_end)
             {
@@ -263,39 +313,43 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
 #endif
             continue;
         }
-        // res not NULL
-        std::string tsv_string (buf);
-        std::stringstream ss (tsv_string);
-        std::vector<std::string> splitted;
-        std::string tmp;
-        char sep = '\t';
-        if (tsv_string.find ('\t') == std::string::npos)
-        {
-            sep = ',';
-        }
-        while (std::getline (ss, tmp, sep))
+        if (!is_bfrec)
         {
-            if (tmp != "\n")
+            std::string tsv_string (buf);
+            std::stringstream ss (tsv_string);
+            std::vector<std::string> splitted;
+            std::string tmp;
+            char sep = '\t';
+            if (tsv_string.find ('\t') == std::string::npos)
             {
-                splitted.push_back (tmp);
+                sep = ',';
             }
-        }
-        if (splitted.size () != num_rows)
-        {
-            safe_logger (spdlog::level::err,
-                "invalid string in file, check provided board id. String size {}, expected size {}",
-                splitted.size (), num_rows);
-            continue;
-        }
-        for (int i = 0; i < num_rows; i++)
-        {
-            try
+            while (std::getline (ss, tmp, sep))
             {
-                package[i] = std::stod (splitted[i]);
+                if (tmp != "\n")
+                {
+                    splitted.push_back (tmp);
+                }
             }
-            catch (...)
+            if (splitted.size () != num_rows)
+            {
+                safe_logger (spdlog::level::err,
+                    "invalid string in file, check provided board id. String size {}, expected "
+                    "size {}",
+                    splitted.size (), num_rows);
+                continue;
+            }
+            for (int i = 0; i < num_rows; i++)
             {
-                safe_logger (spdlog::level::err, "failed to parse value: {}", splitted[i].c_str ());
+                try
+                {
+                    package[i] = std::stod (splitted[i]);
+                }
+                catch (...)
+                {
+                    safe_logger (
+                        spdlog::level::err, "failed to parse value: {}", splitted[i].c_str ());
+                }
             }
         }
         if (last_timestamp > 0)
@@ -323,7 +377,10 @@ void PlaybackFileBoard::read_thread (int preset, std::string file)
         }
         push_package (package, preset);
     }
-    fclose (fp);
+    if (fp != NULL)
+    {
+        fclose (fp);
+    }
     delete[] package;
 }
 
@@ -378,9 +435,11 @@ int PlaybackFileBoard::config_board (std::string config, std::string &response)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
-int PlaybackFileBoard::get_file_offsets (std::string filename, std::vector<long int> &offsets)
+int PlaybackFileBoard::get_file_offsets (
+    std::string filename, std::vector<long int> &offsets, long &num_samples)
 {
     offsets.clear ();
+    num_samples = 0;
 
     FILE *fp = fopen (filename.c_str (), "rb");
     if (fp == NULL)
@@ -389,6 +448,23 @@ int PlaybackFileBoard::get_file_offsets (std::string filename, std::vector<long
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
 
+    if (bfrec_check_magic (fp))
+    {
+        // reader seeks by sample, so only number of samples is needed
+        fclose (fp);
+        BFRecReader reader;
+        if (reader.open (filename.c_str ()) == (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            num_samples = reader.get_num_samples ();
+        }
+        if (num_samples == 0)
+        {
+            safe_logger (spdlog::level::err, "empty or invalid binary file: {}", filename);
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+
     char buf[MAX_LINE_LENGTH];
     long int bytes_read = 0;
     while (true)
@@ -14,36 +14,24 @@ PlotJugglerUDPStreamer::PlotJugglerUDPStreamer (const char *ip, int port, json p
 {
     strcpy (this->ip, ip);
     this->port = port;
-    this->preset_descr = preset_descr;
+    parse_preset (preset_descr);
     socket = NULL;
-    is_streaming = false;
-    db = NULL;
 }
 
 PlotJugglerUDPStreamer::~PlotJugglerUDPStreamer ()
 {
-    if ((streaming_thread.joinable ()) && (is_streaming))
-    {
-        is_streaming = false;
-        streaming_thread.join ();
-    }
     if (socket != NULL)
     {
         delete socket;
         socket = NULL;
     }
-    if (db != NULL)
-    {
-        delete db;
-        db = NULL;
-    }
 }
 
 int PlotJugglerUDPStreamer::init_streamer ()
 {
-    if ((is_streaming) || (socket != NULL) || (db != NULL))
+    if (socket != NULL)
     {
-        Board::board_logger->error ("plotjuggler streamer is running");
+        Board::get_board_logger ()->error ("plotjuggler streamer is running");
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
 
@@ -53,111 +41,92 @@ int PlotJugglerUDPStreamer::init_streamer ()
     {
         delete socket;
         socket = NULL;
-        Board::board_logger->error ("failed to init udp socket {}", res);
+        Board::get_board_logger ()->error ("failed to init udp socket {}", res);
         return (int)BrainFlowExitCodes::GENERAL_ERROR;
     }
-
-    db = new DataBuffer (len, 1000);
-    if (!db->is_ready ())
-    {
-        Board::board_logger->error ("unable to prepare buffer for streaming");
-        delete db;
-        db = NULL;
-        delete socket;
-        socket = NULL;
-        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
-    }
-
-    is_streaming = true;
-    streaming_thread = std::thread ([this] { this->thread_worker (); });
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
 void PlotJugglerUDPStreamer::stream_data (double *data)
 {
-    db->add_data (data);
+    json j;
+    j[name] = json::object ();
+    for (const PlotJugglerField &field : fields)
+    {
+        if (field.channel_name.empty ())
+        {
+            j[name][field.prefix] = data[field.index];
+        }
+        else
+        {
+            j[name][field.prefix][field.channel_name] = data[field.index];
+        }
+    }
+    std::string s = j.dump ();
+    socket->send (s.c_str (), (int)s.size ());
 }
 
-void PlotJugglerUDPStreamer::thread_worker ()
+void PlotJugglerUDPStreamer::parse_preset (json preset_descr)
 {
-    double *transaction = new double[len];
-    for (int i = 0; i < len; i++)
+    name = preset_descr.value ("name", std::string (""));
+    std::vector<std::string> eeg_names;
+    try
+    {
+        std::string eeg_names_str = preset_descr["eeg_names"];
+        std::stringstream ss (eeg_names_str);
+        while (ss.good ())
+        {
+            std::string substr;
+            std::getline (ss, substr, ',');
+            eeg_names.push_back (substr);
+        }
+    }
+    catch (...)
     {
-        transaction[i] = 0.0;
     }
-    std::string name = preset_descr["name"];
-    while (is_streaming)
+
+    for (auto &el : preset_descr.items ())
     {
-        if (db->get_data_count () >= 1)
+        std::string key = el.key ();
+        try
         {
-            db->get_data (1, transaction);
-            json j;
-            j[name] = json::object ();
-            for (auto &el : preset_descr.items ())
+            if (key.find ("_channels") != std::string::npos)
             {
-                std::string key = el.key ();
-                if (key.find ("_channels") != std::string::npos)
+                std::string prefix = remove_substr (key, "_channels");
+                std::vector<int> values = el.value ();
+                for (int i = 0; i < (int)values.size (); i++)
                 {
-                    std::string prefix = remove_substr (key, "_channels");
-                    j[name][prefix] = json::object ();
-                    std::vector<int> values = el.value ();
-                    for (int i = 0; i < (int)values.size (); i++)
+                    std::string channel_name = "channel " + std::to_string (i);
+                    if ((key == "accel_channels") && (i == 0))
+                        channel_name = "accel X";
+                    if ((key == "accel_channels") && (i == 1))
+                        channel_name = "accel Y";
+                    if ((key == "accel_channels") && (i == 2))
+                        channel_name = "accel Z";
+                    if ((key == "eeg_channels") && (i < (int)eeg_names.size ()))
                     {
-                        std::string channel_name = "channel " + std::to_string (i);
-                        if ((key == "accel_channels") && (i == 0))
-                            channel_name = "accel X";
-                        if ((key == "accel_channels") && (i == 1))
-                            channel_name = "accel Y";
-                        if ((key == "accel_channels") && (i == 2))
-                            channel_name = "accel Z";
-                        if (key == "eeg_channels")
-                        {
-                            try
-                            {
-                                std::string eeg_names = preset_descr["eeg_names"];
-                                std::vector<std::string> names_vec;
-                                std::stringstream ss (eeg_names);
-                                while (ss.good ())
-                                {
-                                    std::string substr;
-                                    std::getline (ss, substr, ',');
-                                    names_vec.push_back (substr);
-                                }
-                                channel_name = names_vec[i];
-                            }
-                            catch (...)
-                            {
-                            }
-                        }
-                        if ((values[i] >= 0) && (values[i] <= len))
-                        {
-                            j[name][prefix][channel_name] = transaction[values[i]];
-                        }
+                        channel_name = eeg_names[i];
                     }
-                }
-                else if (key.find ("_channel") != std::string::npos)
-                {
-                    int pos = el.value ();
-                    std::string prefix = remove_substr (key, "_channel");
-                    if ((pos >= 0) && (pos < len))
+                    if ((values[i] >= 0) && (values[i] < len))
                     {
-                        j[name][prefix] = transaction[pos];
+                        fields.push_back ({prefix, channel_name, values[i]});
                     }
                 }
             }
-            std::string s = j.dump ();
-            socket->send (s.c_str (), (int)s.size ());
+            else if (key.find ("_channel") != std::string::npos)
+            {
+                int pos = el.value ();
+                std::string prefix = remove_substr (key, "_channel");
+                if ((pos >= 0) && (pos < len))
+                {
+                    fields.push_back ({prefix, "", pos});
+                }
+            }
         }
-        else
+        catch (...)
         {
-#ifdef _WIN32
-            Sleep (1);
-#else
-            usleep (10);
-#endif
         }
     }
-    delete[] transaction;
 }
 
 std::string PlotJugglerUDPStreamer::remove_substr (std::string str, std::string substr)
@@ -0,0 +1,281 @@
+#include <algorithm>
+#include <sstream>
+#include <string.h>
+
+#include "board.h"
+#include "brainflow_constants.h"
+#include "segmented_file_streamer.h"
+
+
+SegmentedFileStreamer::SegmentedFileStreamer (
+    const char *prefix, const char *mods, int data_len, int board_id, int preset, json descr)
+    : Streamer (data_len, "segmented_file", prefix, mods)
+{
+    this->prefix = prefix;
+    max_size = (int64_t)SEGMENTED_FILE_DEFAULT_SIZE_MB * 1024 * 1024;
+    max_duration = SEGMENTED_FILE_DEFAULT_DURATION;
+    timestamp_channel = descr.value ("timestamp_channel", -1);
+    header.board_id = board_id;
+    header.preset = preset;
+    header.num_rows = len;
+    header.descr = descr.dump ();
+    header.compressed = true;
+    index_fp = NULL;
+    segment_fp = NULL;
+    segment = 0;
+    segment_size = 0;
+    segment_start = 0.0;
+    block_samples = 0;
+    write_failed = false;
+}
+
+SegmentedFileStreamer::~SegmentedFileStreamer ()
+{
+    flush_block ();
+    close_segment ();
+    if (index_fp != NULL)
+    {
+        fclose (index_fp);
+        index_fp = NULL;
+    }
+}
+
+int SegmentedFileStreamer::parse_mods ()
+{
+    std::stringstream ss (streamer_mods);
+    std::string mod;
+    while (std::getline (ss, mod, ','))
+    {
+        size_t idx = mod.find ('=');
+        if (idx == std::string::npos)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        std::string key = mod.substr (0, idx);
+        double value = 0.0;
+        try
+        {
+            value = std::stod (mod.substr (idx + 1));
+        }
+        catch (const std::exception &e)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        if (value < 0)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        if (key == "size_mb")
+        {
+            max_size = (int64_t)(value * 1024 * 1024);
+        }
+        else if (key == "duration")
+        {
+            max_duration = value;
+        }
+        else
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SegmentedFileStreamer::init_streamer ()
+{
+    // index is searched by time, so timestamps are required
+    if ((len <= 0) || (timestamp_channel < 0) || (timestamp_channel >= len) || (prefix.empty ()))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int res = parse_mods ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    block.resize ((size_t)BFREC_BLOCK_SAMPLES * len);
+    return open_index ();
+}
+
+int SegmentedFileStreamer::open_index ()
+{
+    std::string index_file = bfrec_index_file_name (prefix);
+    index_fp = fopen (index_file.c_str (), "r+b");
+    if (index_fp == NULL)
+    {
+        index_fp = fopen (index_file.c_str (), "wb");
+        if (index_fp == NULL)
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        setvbuf (index_fp, NULL, _IONBF, 0);
+        return bfrec_write_index_header (index_fp, len, timestamp_channel);
+    }
+    setvbuf (index_fp, NULL, _IONBF, 0);
+    int num_rows = 0;
+    int existing_timestamp_channel = -1;
+    int res = bfrec_read_index_header (index_fp, &num_rows, &existing_timestamp_channel);
+    if ((res != (int)BrainFlowExitCodes::STATUS_OK) || (num_rows != len) ||
+        (existing_timestamp_channel != timestamp_channel))
+    {
+        fclose (index_fp);
+        index_fp = NULL;
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    long num_entries = bfrec_get_num_index_entries (index_fp);
+    BFRecIndexEntry last_entry;
+    if ((num_entries > 0) && (bfrec_read_index_entry (index_fp, num_entries - 1, last_entry) ==
+                                 (int)BrainFlowExitCodes::STATUS_OK))
+    {
+        segment = last_entry.segment;
+    }
+    // incomplete entry at the end is overwritten
+    bfrec_seek (index_fp,
+        BFREC_INDEX_HEADER_SIZE + (int64_t)num_entries * BFREC_INDEX_ENTRY_SIZE, SEEK_SET);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SegmentedFileStreamer::open_segment ()
+{
+    // dont overwrite segments which were created but not indexed
+    std::string file_name;
+    FILE *existing = NULL;
+    do
+    {
+        if (existing != NULL)
+        {
+            fclose (existing);
+        }
+        segment++;
+        file_name = bfrec_segment_file_name (prefix, segment);
+        existing = fopen (file_name.c_str (), "rb");
+    } while (existing != NULL);
+    segment_fp = fopen (file_name.c_str (), "wb");
+    if (segment_fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    setvbuf (segment_fp, NULL, _IONBF, 0); // blocks are written by single fwrite
+    int res = bfrec_write_header (segment_fp, header);
+    segment_size = header.header_size;
+    return res;
+}
+
+void SegmentedFileStreamer::close_segment ()
+{
+    if (segment_fp != NULL)
+    {
+        fclose (segment_fp);
+        segment_fp = NULL;
+    }
+}
+
+void SegmentedFileStreamer::stream_data (double *data)
+{
+    stream_packages (data, 1);
+}
+
+void SegmentedFileStreamer::stream_packages (double *data, int count)
+{
+    if (block_samples == 0)
+    {
+        pending_since = std::chrono::steady_clock::now ();
+    }
+    int done = 0;
+    while (done < count)
+    {
+        int num_samples = std::min (count - done, BFREC_BLOCK_SAMPLES - block_samples);
+        memcpy (block.data () + (size_t)block_samples * len, data + (size_t)done * len,
+            sizeof (double) * num_samples * len);
+        block_samples += num_samples;
+        done += num_samples;
+        if (block_samples == BFREC_BLOCK_SAMPLES)
+        {
+            flush_block ();
+        }
+    }
+    flush_pending ();
+}
+
+void SegmentedFileStreamer::flush_pending ()
+{
+    if (block_samples == 0)
+    {
+        return;
+    }
+    // slow presets fill a block for minutes, write and index what they have
+    auto now = std::chrono::steady_clock::now ();
+    if (std::chrono::duration_cast<std::chrono::milliseconds> (now - pending_since).count () >=
+        BFREC_FLUSH_INTERVAL_MS)
+    {
+        flush_block ();
+    }
+}
+
+void SegmentedFileStreamer::flush_block ()
+{
+    if ((block_samples == 0) || (index_fp == NULL))
+    {
+        return;
+    }
+    BFRecIndexEntry entry;
+    entry.first_timestamp = block[timestamp_channel];
+    entry.last_timestamp = block[timestamp_channel];
+    for (int i = 1; i < block_samples; i++)
+    {
+        double timestamp = block[(size_t)i * len + timestamp_channel];
+        entry.first_timestamp = std::min (entry.first_timestamp, timestamp);
+        entry.last_timestamp = std::max (entry.last_timestamp, timestamp);
+    }
+    entry.num_samples = block_samples;
+    block_samples = 0;
+    if (segment_fp == NULL)
+    {
+        if (open_segment () != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            check_write (false, entry.num_samples);
+            close_segment ();
+            return;
+        }
+        segment_start = entry.first_timestamp;
+    }
+    entry.segment = segment;
+    entry.offset = segment_size;
+    if (bfrec_write_block (segment_fp, block.data (), entry.num_samples, len, write_buffer) !=
+        (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        check_write (false, entry.num_samples);
+        close_segment (); // next block starts new segment
+        return;
+    }
+    segment_size += (int64_t)write_buffer.size ();
+    // block is on disk before it is indexed
+    int res = bfrec_write_index_entry (index_fp, entry);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        // next entry should not start in the middle of incomplete one
+        long num_entries = bfrec_get_num_index_entries (index_fp);
+        bfrec_seek (index_fp,
+            BFREC_INDEX_HEADER_SIZE + (int64_t)num_entries * BFREC_INDEX_ENTRY_SIZE, SEEK_SET);
+    }
+    check_write (res == (int)BrainFlowExitCodes::STATUS_OK, entry.num_samples);
+    if (((max_size > 0) && (segment_size >= max_size)) ||
+        ((max_duration > 0) && (entry.last_timestamp - segment_start >= max_duration)))
+    {
+        close_segment ();
+    }
+}
+
+void SegmentedFileStreamer::check_write (bool res, int num_samples)
+{
+    if ((!res) && (!write_failed))
+    {
+        Board::get_board_logger ()->error (
+            "failed to write {} samples to {}, data is lost", num_samples, prefix);
+    }
+    else if ((res) && (write_failed))
+    {
+        Board::get_board_logger ()->info ("writes to {} are restored", prefix);
+    }
+    write_failed = !res;
+}
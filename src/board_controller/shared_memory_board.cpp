@@ -0,0 +1,237 @@
+#include <chrono>
+
+#include "board_info_getter.h"
+#include "shared_memory_board.h"
+#include "timestamp.h"
+
+
+SharedMemoryBoard::SharedMemoryBoard (struct BrainFlowInputParams params)
+    : Board ((int)BoardIds::SHARED_MEMORY_BOARD,
+          params) // its a hack - set board_id for shared memory board here temporary and override
+                  // it with master board id in prepare_session, board_id is protected and there is
+                  // no api to get it so its ok
+{
+    keep_alive = false;
+    initialized = false;
+}
+
+SharedMemoryBoard::~SharedMemoryBoard ()
+{
+    skip_logs = true;
+    release_session ();
+}
+
+int SharedMemoryBoard::prepare_session ()
+{
+    if (initialized)
+    {
+        safe_logger (spdlog::level::info, "Session is already prepared");
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    if (params.master_board == (int)BoardIds::NO_BOARD)
+    {
+        safe_logger (spdlog::level::err, "Master board id is not provided");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    try
+    {
+        board_id = params.master_board;
+        board_descr = get_board_json (board_id);
+        parse_presets ();
+    }
+    catch (json::exception &e)
+    {
+        safe_logger (spdlog::level::err, "Invalid json for master board");
+        safe_logger (spdlog::level::err, e.what ());
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    catch (const std::exception &e)
+    {
+        safe_logger (spdlog::level::err,
+            "Write board id for the board which streams data to other_info field");
+        safe_logger (spdlog::level::err, e.what ());
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    if (!params.file.empty ())
+    {
+        names.push_back (params.file);
+        presets.push_back ((int)BrainFlowPresets::DEFAULT_PRESET);
+    }
+    if (!params.file_aux.empty ())
+    {
+        names.push_back (params.file_aux);
+        presets.push_back ((int)BrainFlowPresets::AUXILIARY_PRESET);
+    }
+    if (!params.file_anc.empty ())
+    {
+        names.push_back (params.file_anc);
+        presets.push_back ((int)BrainFlowPresets::ANCILLARY_PRESET);
+    }
+    if (names.empty ())
+    {
+        safe_logger (spdlog::level::err, "No shared memory names specified");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+
+    int res = (int)BrainFlowExitCodes::STATUS_OK;
+    for (int i = 0; (i < (int)names.size ()) && (res == (int)BrainFlowExitCodes::STATUS_OK); i++)
+    {
+        rings.push_back (new SharedMemoryRing ());
+        res = open_ring (i);
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        for (auto ring : rings)
+        {
+            delete ring;
+        }
+        rings.clear ();
+        names.clear ();
+        presets.clear ();
+        return res;
+    }
+    initialized = true;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SharedMemoryBoard::open_ring (int num)
+{
+    SharedMemoryRing *ring = rings[num];
+    int res = ring->open (names[num].c_str ());
+    if (res == (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR)
+    {
+        safe_logger (spdlog::level::err, "invalid shared memory name {}", names[num].c_str ());
+        return res;
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        safe_logger (spdlog::level::err, "unable to open shared memory {}, is shm streamer added?",
+            names[num].c_str ());
+        return (int)BrainFlowExitCodes::BOARD_NOT_READY_ERROR;
+    }
+    std::string preset_str = preset_to_string (presets[num]);
+    int num_rows = board_descr[preset_str].value ("num_rows", 0);
+    if ((ring->get_num_rows () != num_rows) || (ring->get_board_id () != board_id) ||
+        (ring->get_preset () != presets[num]))
+    {
+        safe_logger (spdlog::level::err,
+            "shared memory {} has data of board {} preset {} with {} rows, expected board {} "
+            "preset {} with {} rows",
+            names[num].c_str (), ring->get_board_id (), ring->get_preset (),
+            ring->get_num_rows (), board_id, presets[num], num_rows);
+        ring->close ();
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SharedMemoryBoard::config_board (std::string config, std::string &response)
+{
+    // dont allow readers to change config for master board
+    return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+}
+
+int SharedMemoryBoard::start_stream (int buffer_size, const char *streamer_params)
+{
+    if (keep_alive)
+    {
+        safe_logger (spdlog::level::err, "Streaming thread already running");
+        return (int)BrainFlowExitCodes::STREAM_ALREADY_RUN_ERROR;
+    }
+    int res = prepare_for_acquisition (buffer_size, streamer_params);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+
+    keep_alive = true;
+    for (int i = 0; i < (int)rings.size (); i++)
+    {
+        streaming_threads.push_back (std::thread ([this, i] { this->read_thread (i); }));
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SharedMemoryBoard::stop_stream ()
+{
+    if (keep_alive)
+    {
+        keep_alive = false;
+        for (std::thread &streaming_thread : streaming_threads)
+        {
+            streaming_thread.join ();
+        }
+        streaming_threads.clear ();
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    else
+    {
+        return (int)BrainFlowExitCodes::STREAM_THREAD_IS_NOT_RUNNING;
+    }
+}
+
+int SharedMemoryBoard::release_session ()
+{
+    if (initialized)
+    {
+        if (keep_alive)
+        {
+            stop_stream ();
+        }
+        free_packages ();
+        initialized = false;
+        for (auto ring : rings)
+        {
+            delete ring;
+        }
+        rings.clear ();
+        names.clear ();
+        presets.clear ();
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void SharedMemoryBoard::read_thread (int num)
+{
+    SharedMemoryRing *ring = rings[num];
+    int preset = presets[num];
+    // ring is reopened only if it has the same number of rows
+    std::vector<double> samples ((size_t)SHARED_MEMORY_BOARD_MAX_SAMPLES * ring->get_num_rows ());
+    uint64_t lost = 0;
+    uint64_t reported_lost = 0;
+    double last_check = get_timestamp ();
+
+    while (keep_alive)
+    {
+        int count = ring->read (samples.data (), SHARED_MEMORY_BOARD_MAX_SAMPLES, &lost);
+        if (lost != reported_lost)
+        {
+            safe_logger (spdlog::level::warn, "{} samples from {} were overwritten before read",
+                lost - reported_lost, names[num].c_str ());
+            reported_lost = lost;
+        }
+        if (count > 0)
+        {
+            push_packages (samples.data (), count, preset);
+            continue;
+        }
+        std::this_thread::sleep_for (std::chrono::microseconds (SHARED_MEMORY_BOARD_POLL_US));
+        double now = get_timestamp ();
+        if (now - last_check < 1.0)
+        {
+            continue;
+        }
+        last_check = now;
+        if (ring->is_replaced ())
+        {
+            safe_logger (spdlog::level::info, "shared memory {} was recreated, reopening",
+                names[num].c_str ());
+            if (open_ring (num) != (int)BrainFlowExitCodes::STATUS_OK)
+            {
+                safe_logger (spdlog::level::warn, "unable to reopen {}, will retry",
+                    names[num].c_str ());
+            }
+        }
+    }
+}
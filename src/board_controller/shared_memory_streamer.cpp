@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <sstream>
+
+#include "brainflow_constants.h"
+#include "shared_memory_streamer.h"
+
+
+SharedMemoryStreamer::SharedMemoryStreamer (
+    const char *name, const char *mods, int data_len, int board_id, int preset, int sampling_rate)
+    : Streamer (data_len, "shm", name, mods)
+{
+    this->name = name;
+    this->board_id = board_id;
+    this->preset = preset;
+    this->sampling_rate = sampling_rate;
+    capacity = 0;
+}
+
+SharedMemoryStreamer::~SharedMemoryStreamer ()
+{
+    ring.close ();
+}
+
+int SharedMemoryStreamer::parse_mods ()
+{
+    double seconds = SHARED_MEMORY_STREAMER_DEFAULT_DURATION;
+    double samples = 0.0;
+    std::stringstream ss (streamer_mods);
+    std::string mod;
+    while (std::getline (ss, mod, ','))
+    {
+        size_t idx = mod.find ('=');
+        if (idx == std::string::npos)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        std::string key = mod.substr (0, idx);
+        double value = 0.0;
+        try
+        {
+            value = std::stod (mod.substr (idx + 1));
+        }
+        catch (const std::exception &e)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        if ((value <= 0) || (value > 1e8))
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        if (key == "seconds")
+        {
+            seconds = value;
+        }
+        else if (key == "samples")
+        {
+            samples = value;
+        }
+        else
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    if (samples > 0)
+    {
+        capacity = (int)samples;
+    }
+    else
+    {
+        capacity = std::max ((int)(seconds * sampling_rate), SHARED_MEMORY_STREAMER_MIN_SAMPLES);
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SharedMemoryStreamer::init_streamer ()
+{
+    if ((len <= 0) || (name.empty ()))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int res = parse_mods ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return ring.create (name.c_str (), len, capacity, board_id, preset);
+}
+
+void SharedMemoryStreamer::stream_data (double *data)
+{
+    ring.write (data, 1);
+}
+
+void SharedMemoryStreamer::stream_packages (double *data, int count)
+{
+    ring.write (data, count);
+}
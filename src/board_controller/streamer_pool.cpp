@@ -0,0 +1,221 @@
+#include <new>
+#include <string.h>
+
+#include "board.h"
+#include "brainflow_constants.h"
+#include "streamer_pool.h"
+#include "timestamp.h"
+
+
+AsyncStreamer::AsyncStreamer (
+    Streamer *streamer, StreamerPool *pool, size_t max_packages, StreamerOverflowPolicy policy)
+    : Streamer (streamer->get_len (), "async", "", "")
+{
+    this->streamer = streamer;
+    this->pool = pool;
+    this->max_packages = max_packages;
+    this->policy = policy;
+    queue = NULL;
+    batch = NULL;
+    first = 0;
+    count = 0;
+    oldest_timestamp = 0.0;
+    scheduled = false;
+    drop_reported = false;
+}
+
+AsyncStreamer::~AsyncStreamer ()
+{
+    // nobody pushes anymore, wait for worker to deliver the rest
+    {
+        std::unique_lock<std::mutex> lock (m);
+        state_changed.wait (lock, [this] { return !scheduled; });
+    }
+    if (stats.dropped > 0)
+    {
+        Board::get_board_logger ()->warn (
+            "streamer dropped {} packages, max lag {} sec", stats.dropped, stats.max_lag);
+    }
+    delete streamer;
+    delete[] queue;
+    delete[] batch;
+}
+
+int AsyncStreamer::init_streamer ()
+{
+    if ((queue != NULL) || (max_packages == 0))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    int res = streamer->init_streamer ();
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    try
+    {
+        queue = new double[max_packages * len];
+        batch = new double[max_packages * len];
+    }
+    catch (const std::bad_alloc &)
+    {
+        Board::get_board_logger ()->error ("unable to prepare streamer queue");
+        delete[] queue;
+        queue = NULL;
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+bool AsyncStreamer::check_equals (std::string type, std::string dest, std::string mods)
+{
+    return streamer->check_equals (type, dest, mods);
+}
+
+void AsyncStreamer::stream_data (double *data)
+{
+    stream_packages (data, 1);
+}
+
+void AsyncStreamer::stream_packages (double *data, int num_packages)
+{
+    std::unique_lock<std::mutex> lock (m);
+    for (int i = 0; i < num_packages; i++)
+    {
+        if (count == max_packages)
+        {
+            if (policy == StreamerOverflowPolicy::DROP)
+            {
+                stats.dropped += num_packages - i;
+                if (!drop_reported)
+                {
+                    Board::get_board_logger ()->warn (
+                        "streamer queue is full, packages are dropped");
+                    drop_reported = true;
+                }
+                break;
+            }
+            // worker may not know about this queue yet if batch is bigger than the queue
+            if (!scheduled)
+            {
+                scheduled = true;
+                pool->schedule (this);
+            }
+            state_changed.wait (lock, [this] { return count < max_packages; });
+        }
+        if (count == 0)
+        {
+            oldest_timestamp = get_timestamp ();
+        }
+        size_t pos = (first + count) % max_packages;
+        memcpy (queue + pos * len, data + i * len, sizeof (double) * len);
+        count++;
+    }
+    if (count > stats.max_queue_depth)
+    {
+        stats.max_queue_depth = count;
+    }
+    // pool lock is always taken after this one, workers release pool lock before deliver
+    if ((!scheduled) && (count > 0))
+    {
+        scheduled = true;
+        pool->schedule (this);
+    }
+}
+
+void AsyncStreamer::deliver ()
+{
+    while (true)
+    {
+        size_t num_packages = 0;
+        double enqueue_timestamp = 0.0;
+        {
+            std::lock_guard<std::mutex> lock (m);
+            if (count == 0)
+            {
+                scheduled = false;
+                state_changed.notify_all ();
+                return;
+            }
+            // copy everything out to release queue quickly
+            size_t first_half = max_packages - first;
+            if (first_half > count)
+            {
+                first_half = count;
+            }
+            memcpy (batch, queue + first * len, sizeof (double) * len * first_half);
+            memcpy (batch + first_half * len, queue, sizeof (double) * len * (count - first_half));
+            num_packages = count;
+            enqueue_timestamp = oldest_timestamp;
+            first = (first + count) % max_packages;
+            count = 0;
+            state_changed.notify_all ();
+        }
+        streamer->stream_packages (batch, (int)num_packages);
+        double lag = get_timestamp () - enqueue_timestamp;
+        std::lock_guard<std::mutex> lock (m);
+        stats.last_lag = lag;
+        if (lag > stats.max_lag)
+        {
+            stats.max_lag = lag;
+        }
+    }
+}
+
+StreamerStats AsyncStreamer::get_stats ()
+{
+    std::lock_guard<std::mutex> lock (m);
+    StreamerStats res = stats;
+    res.queue_depth = count;
+    return res;
+}
+
+StreamerPool::StreamerPool (int num_threads)
+{
+    keep_alive = true;
+    for (int i = 0; i < num_threads; i++)
+    {
+        workers.push_back (std::thread ([this] { this->thread_worker (); }));
+    }
+}
+
+StreamerPool::~StreamerPool ()
+{
+    {
+        std::lock_guard<std::mutex> lock (m);
+        keep_alive = false;
+    }
+    cv.notify_all ();
+    for (auto &worker : workers)
+    {
+        worker.join ();
+    }
+}
+
+void StreamerPool::schedule (AsyncStreamer *streamer)
+{
+    {
+        std::lock_guard<std::mutex> lock (m);
+        ready.push_back (streamer);
+    }
+    cv.notify_one ();
+}
+
+void StreamerPool::thread_worker ()
+{
+    while (true)
+    {
+        AsyncStreamer *streamer = NULL;
+        {
+            std::unique_lock<std::mutex> lock (m);
+            cv.wait (lock, [this] { return (!ready.empty ()) || (!keep_alive); });
+            if (ready.empty ())
+            {
+                return;
+            }
+            streamer = ready.front ();
+            ready.pop_front ();
+        }
+        streamer->deliver ();
+    }
+}
@@ -2,7 +2,7 @@
 #include <string.h>
 
 #include "board_info_getter.h"
-#include "brainflow_env_vars.h"
+#include "stream_frame.h"
 #include "streaming_board.h"
 
 #ifndef _WIN32
@@ -41,7 +41,8 @@ int StreamingBoard::prepare_session ()
     try
     {
         board_id = params.master_board;
-        board_descr = boards_struct.brainflow_boards_json["boards"][std::to_string (board_id)];
+        board_descr = get_board_json (board_id);
+        parse_presets ();
     }
     catch (json::exception &e)
     {
@@ -111,6 +112,11 @@ int StreamingBoard::prepare_session ()
             res = (int)BrainFlowExitCodes::GENERAL_ERROR;
             break;
         }
+        // frame delay is measured from kernel arrival time
+        if (client->enable_kernel_timestamps () != (int)MultiCastReturnCodes::STATUS_OK)
+        {
+            safe_logger (spdlog::level::debug, "kernel timestamps are not supported");
+        }
     }
 
     if (res != (int)BrainFlowExitCodes::STATUS_OK)
@@ -202,31 +208,85 @@ void StreamingBoard::read_thread (int num)
 
     json board_preset = board_descr[preset_str];
     int num_rows = board_preset["num_rows"];
-    int num_packages = get_brainflow_batch_size ();
-    int transaction_len = num_rows * num_packages;
-    int bytes_per_recv = sizeof (double) * transaction_len;
-    double *transaction = new double[transaction_len];
-    for (int i = 0; i < num_rows; i++)
-    {
-        transaction[i] = 0.0;
-    }
+    int preset = presets[num];
+    // frames are up to max udp payload, so batch has less slots than for board packages
+    DatagramBatch batch (16, STREAM_FRAME_MAX_SIZE);
+    int num_datagrams = 0;
+    int datagram_num = 0;
+    std::vector<double> transaction;
+    StreamFrameSequence sequence;
+    FrameMetrics frames;
+    int legacy_bytes = (int)sizeof (double) * num_rows;
 
     while (keep_alive)
     {
-        int res = clients[num]->recv (transaction, bytes_per_recv);
-        if (res != bytes_per_recv)
+        // all datagrams which are already in socket buffer are received per wakeup
+        if (datagram_num == num_datagrams)
+        {
+            datagram_num = 0;
+            num_datagrams = clients[num]->recv_batch (batch);
+            if (num_datagrams <= 0)
+            {
+                safe_logger (
+                    spdlog::level::trace, "unable to read datagrams, res {}", num_datagrams);
+                num_datagrams = 0;
+                continue;
+            }
+        }
+        const char *datagram = batch.get_datagram (datagram_num);
+        int res = batch.get_size (datagram_num);
+        double arrival_time = batch.get_arrival_time (datagram_num);
+        datagram_num++;
+        if (res <= 0)
+        {
+            continue;
+        }
+        StreamFrameHeader header;
+        if (stream_frame_decode_header (datagram, (size_t)res, header) !=
+            (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            // senders before framed format send raw doubles without header
+            if ((res % legacy_bytes == 0) && (memcmp (datagram, STREAM_FRAME_MAGIC, 4) != 0))
+            {
+                transaction.resize (res / sizeof (double));
+                memcpy (transaction.data (), datagram, res);
+                push_packages (transaction.data (), res / legacy_bytes, preset);
+                continue;
+            }
+            frames.invalid++;
+            set_frame_metrics (frames, preset);
+            safe_logger (spdlog::level::trace, "invalid frame of {} bytes", res);
+            continue;
+        }
+        if ((header.num_rows != num_rows) || (header.preset != preset))
+        {
+            frames.invalid++;
+            set_frame_metrics (frames, preset);
+            safe_logger (spdlog::level::trace,
+                "frame for preset {} with {} rows, expected preset {} with {} rows", header.preset,
+                header.num_rows, preset, num_rows);
+            continue;
+        }
+        bool in_order = sequence.check (header.sequence);
+        frames.received = sequence.received;
+        frames.gaps = sequence.gaps;
+        frames.lost = sequence.lost;
+        frames.out_of_order = sequence.out_of_order;
+        frames.restarts = sequence.restarts;
+        frames.delay_sum += arrival_time - header.send_timestamp;
+        set_frame_metrics (frames, preset);
+        // late frames are dropped, data in buffer should be ordered by time
+        if (!in_order)
         {
-            safe_logger (
-                spdlog::level::trace, "unable to read {} bytes, read {}", bytes_per_recv, res);
-            log_socket_error (-1);
             continue;
         }
-        for (int i = 0; i < num_packages; i++)
+        transaction.resize ((size_t)header.num_samples * num_rows);
+        if (stream_frame_decode (datagram, (size_t)res, header, transaction.data ()) ==
+            (int)BrainFlowExitCodes::STATUS_OK)
         {
-            push_package (transaction + i * num_rows, presets[num]);
+            push_packages (transaction.data (), header.num_samples, preset);
         }
     }
-    delete[] transaction;
 }
 
 void StreamingBoard::log_socket_error (int error_code)
@@ -29,6 +29,9 @@ endif (CMAKE_SIZEOF_VOID_P EQUAL 8)
 SET (DATA_HANDLER_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/data_handler.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/data_handler/fastica.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_format.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_compression.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_segments.cpp
 )
 
 add_library (
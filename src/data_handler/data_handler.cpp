@@ -10,6 +10,8 @@
 #include <thread>
 #include <vector>
 
+#include "bfrec_format.h"
+#include "bfrec_segments.h"
 #include "brainflow_constants.h"
 #include "brainflow_version.h"
 #include "common_data_handler_helpers.h"
@@ -976,6 +978,43 @@ int get_nearest_power_of_two (int value, int *output)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+static int read_bfrec_file (BFRecReader &reader, double *data, int *num_rows, int *num_cols,
+    int num_elements)
+{
+    const BFRecHeader &header = reader.get_header ();
+    long num_samples =
+        std::min (reader.get_num_samples (), (long)(num_elements / header.num_rows));
+    if (num_samples <= 0)
+    {
+        data_logger->error ("no complete samples in binary file");
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    // samples are stored sample major, output is channel major
+    const long chunk_samples = 4096;
+    std::vector<double> samples (header.num_rows * chunk_samples);
+    long done = 0;
+    while (done < num_samples)
+    {
+        long count = std::min (num_samples - done, chunk_samples);
+        if (reader.read (count, samples.data ()) != count)
+        {
+            data_logger->error ("failed to read binary file");
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        for (long i = 0; i < count; i++)
+        {
+            for (int j = 0; j < header.num_rows; j++)
+            {
+                data[j * num_samples + done + i] = samples[i * header.num_rows + j];
+            }
+        }
+        done += count;
+    }
+    *num_rows = header.num_rows;
+    *num_cols = (int)num_samples;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int write_file (
     const double *data, int num_rows, int num_cols, const char *file_name, const char *file_mode)
 {
@@ -1015,8 +1054,12 @@ int read_file (double *data, int *num_rows, int *num_cols, const char *file_name
         data_logger->error ("Nummber or elements must be greater than 0.");
         return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
     }
-    FILE *fp;
-    fp = fopen (file_name, "r");
+    BFRecReader reader;
+    if (reader.open (file_name) == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return read_bfrec_file (reader, data, num_rows, num_cols, num_elements);
+    }
+    FILE *fp = fopen (file_name, "r");
     if (fp == NULL)
     {
         data_logger->error ("Couldn't read file {}", file_name);
@@ -1118,10 +1161,90 @@ int calc_stddev (double *data, int start_pos, int end_pos, double *output)
     return (int)BrainFlowExitCodes::STATUS_OK;
 }
 
+int read_file_range (double *data, int *num_rows, int *num_cols, const char *prefix,
+    double start_time, double end_time, int num_elements)
+{
+    if ((data == NULL) || (num_rows == NULL) || (num_cols == NULL) || (prefix == NULL) ||
+        (num_elements <= 0) || (start_time > end_time))
+    {
+        data_logger->error ("Invalid arguments for read_file_range.");
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    BFRecRangeReader reader;
+    int res = reader.open (prefix);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Couldn't open index for {}", prefix);
+        return res;
+    }
+    std::vector<double> samples;
+    res = reader.read_range (start_time, end_time, samples);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("failed to read segmented recording {}", prefix);
+        return res;
+    }
+    int rows = reader.get_num_rows ();
+    long num_samples = (long)samples.size () / rows;
+    if (num_samples == 0)
+    {
+        data_logger->error ("no samples in range from {} to {}", start_time, end_time);
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    if (num_samples * rows > num_elements)
+    {
+        data_logger->error ("buffer is too small, required {} elements", num_samples * rows);
+        return (int)BrainFlowExitCodes::INVALID_BUFFER_SIZE_ERROR;
+    }
+    for (long i = 0; i < num_samples; i++)
+    {
+        for (int j = 0; j < rows; j++)
+        {
+            data[j * num_samples + i] = samples[i * rows + j];
+        }
+    }
+    *num_rows = rows;
+    *num_cols = (int)num_samples;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int get_num_elements_in_file_range (
+    const char *prefix, double start_time, double end_time, int *num_elements)
+{
+    if ((prefix == NULL) || (num_elements == NULL) || (start_time > end_time))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    BFRecRangeReader reader;
+    int res = reader.open (prefix);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        data_logger->error ("Couldn't open index for {}", prefix);
+        return res;
+    }
+    *num_elements = (int)reader.get_max_samples (start_time, end_time) * reader.get_num_rows ();
+    if (*num_elements == 0)
+    {
+        data_logger->error ("no samples in range from {} to {}", start_time, end_time);
+        return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
 int get_num_elements_in_file (const char *file_name, int *num_elements)
 {
-    FILE *fp;
-    fp = fopen (file_name, "r");
+    BFRecReader reader;
+    if (reader.open (file_name) == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        *num_elements = (int)reader.get_num_samples () * reader.get_header ().num_rows;
+        if (*num_elements == 0)
+        {
+            data_logger->error ("Empty file {}", file_name);
+            return (int)BrainFlowExitCodes::EMPTY_BUFFER_ERROR;
+        }
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    FILE *fp = fopen (file_name, "r");
     if (fp == NULL)
     {
         data_logger->error ("Couldn't read file {}", file_name);
@@ -83,6 +83,10 @@ extern "C"
     SHARED_EXPORT int CALLING_CONVENTION get_num_elements_in_file (
         const char *file_name, int *num_elements); // its an internal method for bindings its not
                                                    // available via high level api
+    SHARED_EXPORT int CALLING_CONVENTION read_file_range (double *data, int *num_rows,
+        int *num_cols, const char *prefix, double start_time, double end_time, int num_elements);
+    SHARED_EXPORT int CALLING_CONVENTION get_num_elements_in_file_range (const char *prefix,
+        double start_time, double end_time, int *num_elements); // upper bound, internal method
 
     // platform types and methods
     SHARED_EXPORT int CALLING_CONVENTION get_version_data_handler (
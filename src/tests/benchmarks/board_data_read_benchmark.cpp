@@ -0,0 +1,117 @@
+// microbenchmark for the read path of get_board_data and get_current_board_data: compares old
+// approach(temporary buffer, copy, transpose to caller's buffer) with fused copy and transpose
+// directly to caller's buffer, reports throughput and heap allocations per call
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "spsc_data_buffer.h"
+
+
+static std::atomic<size_t> num_allocations (0);
+
+void *operator new (size_t size)
+{
+    num_allocations++;
+    void *ptr = malloc (size);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc ();
+    }
+    return ptr;
+}
+
+void operator delete (void *ptr) noexcept
+{
+    free (ptr);
+}
+
+void *operator new[] (size_t size)
+{
+    return operator new (size);
+}
+
+void operator delete[] (void *ptr) noexcept
+{
+    operator delete (ptr);
+}
+
+// the way Board read data before
+static size_t read_with_temporary_buffer (
+    BaseDataBuffer *buffer, int num_rows, size_t num_samples, double *output_buf)
+{
+    double *buf = new double[num_samples * num_rows];
+    size_t count = buffer->get_current_data (num_samples, buf);
+    for (size_t i = 0; i < count; i++)
+    {
+        for (int j = 0; j < num_rows; j++)
+        {
+            output_buf[j * count + i] = buf[i * num_rows + j];
+        }
+    }
+    delete[] buf;
+    return count;
+}
+
+static void run_benchmark (const char *name, BaseDataBuffer *buffer, int num_rows,
+    size_t num_samples, bool fused, int num_calls)
+{
+    std::vector<double> output (num_samples * num_rows);
+    size_t allocations_before = num_allocations.load ();
+    size_t total = 0;
+    auto start = std::chrono::steady_clock::now ();
+    for (int i = 0; i < num_calls; i++)
+    {
+        if (fused)
+        {
+            total += buffer->get_current_data_by_channels (num_samples, output.data ());
+        }
+        else
+        {
+            total += read_with_temporary_buffer (buffer, num_rows, num_samples, output.data ());
+        }
+    }
+    auto stop = std::chrono::steady_clock::now ();
+    double seconds = std::chrono::duration<double> (stop - start).count ();
+    double bytes = (double)total * num_rows * sizeof (double);
+    printf ("%-22s %6d %8zu %12.1f %14.2f\n", name, num_rows, num_samples,
+        bytes / seconds / (1024.0 * 1024.0),
+        (double)(num_allocations.load () - allocations_before) / num_calls);
+}
+
+int main (int argc, char *argv[])
+{
+    const size_t buffer_size = 45000;
+    int num_rows_list[] = {8, 32, 64};
+    size_t num_samples_list[] = {250, 7500, 44000}; // ui frame, 30s window, whole buffer
+
+    printf ("%-22s %6s %8s %12s %14s\n", "method", "rows", "samples", "MB/s", "allocs/call");
+    for (int num_rows : num_rows_list)
+    {
+        std::vector<double> package (num_rows);
+        SPSCDataBuffer sample_major (num_rows, buffer_size);
+        SPSCDataBuffer channel_major (num_rows, buffer_size, DataBufferLayout::CHANNEL_MAJOR);
+        // make sure that data wraps around in the ring
+        for (size_t i = 0; i < buffer_size + buffer_size / 3; i++)
+        {
+            package[0] = (double)i;
+            sample_major.add_data (package.data ());
+            channel_major.add_data (package.data ());
+        }
+        for (size_t num_samples : num_samples_list)
+        {
+            int num_calls = (int)(20000000 / (num_samples * num_rows)) + 1;
+            run_benchmark (
+                "temp buffer+transpose", &sample_major, num_rows, num_samples, false, num_calls);
+            run_benchmark ("fused sample major", &sample_major, num_rows, num_samples, true,
+                num_calls);
+            run_benchmark ("fused channel major", &channel_major, num_rows, num_samples, true,
+                num_calls);
+        }
+    }
+    return 0;
+}
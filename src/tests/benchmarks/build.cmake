@@ -0,0 +1,56 @@
+# benchmarks are standalone executables, they are not registered in ctest
+
+add_executable (
+    data_buffer_benchmark
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/spsc_data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/benchmarks/data_buffer_benchmark.cpp
+)
+
+target_include_directories (
+    data_buffer_benchmark PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+)
+
+find_package (Threads REQUIRED)
+target_link_libraries (data_buffer_benchmark PRIVATE Threads::Threads)
+
+set_target_properties (data_buffer_benchmark
+    PROPERTIES
+    RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/benchmarks
+)
+
+add_executable (
+    board_data_read_benchmark
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/spsc_data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/benchmarks/board_data_read_benchmark.cpp
+)
+
+target_include_directories (
+    board_data_read_benchmark PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+)
+
+set_target_properties (board_data_read_benchmark
+    PROPERTIES
+    RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/benchmarks
+)
+
+add_executable (
+    multi_session_benchmark
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/benchmarks/multi_session_benchmark.cpp
+)
+
+target_include_directories (
+    multi_session_benchmark PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/inc
+)
+
+target_link_libraries (multi_session_benchmark PRIVATE ${BOARD_CONTROLLER_NAME} Threads::Threads)
+
+set_target_properties (multi_session_benchmark
+    PROPERTIES
+    RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}/build/benchmarks
+)
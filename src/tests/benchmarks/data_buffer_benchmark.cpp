@@ -0,0 +1,95 @@
+// contention benchmark for ring buffers used by Board: one thread pushes packages as fast as
+// possible, another thread polls buffer like UI or recorder does, compare throughput of producer
+// and time spent in add_data for SpinLock based DataBuffer and lock free SPSCDataBuffer
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "data_buffer.h"
+#include "spsc_data_buffer.h"
+
+
+struct BenchmarkResult
+{
+    double producer_ns_per_package;
+    double worst_add_us;
+    double consumer_ns_per_package;
+    size_t consumed;
+};
+
+static BenchmarkResult run_benchmark (
+    BaseDataBuffer *buffer, int num_rows, int num_packages, int read_batch)
+{
+    std::atomic<bool> done (false);
+    std::vector<double> package (num_rows, 0.0);
+    std::vector<double> output ((size_t)read_batch * num_rows);
+    BenchmarkResult result = {0.0, 0.0, 0.0, 0};
+    double consumer_ns = 0.0;
+
+    std::thread consumer ([&] () {
+        while (!done.load (std::memory_order_acquire))
+        {
+            auto start = std::chrono::steady_clock::now ();
+            buffer->get_data_count ();
+            size_t count = buffer->get_data (read_batch, output.data ());
+            auto stop = std::chrono::steady_clock::now ();
+            consumer_ns += std::chrono::duration<double, std::nano> (stop - start).count ();
+            result.consumed += count;
+        }
+    });
+
+    double worst_ns = 0.0;
+    auto start = std::chrono::steady_clock::now ();
+    for (int i = 0; i < num_packages; i++)
+    {
+        package[0] = (double)i;
+        auto add_start = std::chrono::steady_clock::now ();
+        buffer->add_data (package.data ());
+        auto add_stop = std::chrono::steady_clock::now ();
+        worst_ns = std::max (
+            worst_ns, std::chrono::duration<double, std::nano> (add_stop - add_start).count ());
+    }
+    auto stop = std::chrono::steady_clock::now ();
+    done.store (true, std::memory_order_release);
+    consumer.join ();
+
+    result.producer_ns_per_package =
+        std::chrono::duration<double, std::nano> (stop - start).count () / num_packages;
+    result.worst_add_us = worst_ns / 1000.0;
+    result.consumer_ns_per_package =
+        (result.consumed > 0) ? consumer_ns / (double)result.consumed : 0.0;
+    return result;
+}
+
+int main (int argc, char *argv[])
+{
+    const int num_packages = 2000000;
+    const int buffer_size = 45000;
+    int num_rows_list[] = {8, 32, 64};
+    int read_batch_list[] = {16, 256};
+
+    printf ("%-14s %8s %8s %14s %14s %14s %10s\n", "buffer", "rows", "batch", "push ns/pkg",
+        "worst push us", "read ns/pkg", "read pkgs");
+    for (int num_rows : num_rows_list)
+    {
+        for (int read_batch : read_batch_list)
+        {
+            DataBuffer spinlock_buffer (num_rows, buffer_size);
+            SPSCDataBuffer spsc_buffer (num_rows, buffer_size);
+            BaseDataBuffer *buffers[] = {&spinlock_buffer, &spsc_buffer};
+            const char *names[] = {"spinlock", "spsc"};
+            for (int i = 0; i < 2; i++)
+            {
+                BenchmarkResult res = run_benchmark (buffers[i], num_rows, num_packages, read_batch);
+                printf ("%-14s %8d %8d %14.1f %14.1f %14.1f %10zu\n", names[i], num_rows,
+                    read_batch, res.producer_ns_per_package, res.worst_add_us,
+                    res.consumer_ns_per_package, res.consumed);
+            }
+        }
+    }
+    return 0;
+}
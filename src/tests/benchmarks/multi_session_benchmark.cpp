@@ -0,0 +1,111 @@
+// throughput of board controller calls from several threads, each thread works with its own
+// synthetic board session: reads latest data, inserts markers and checks ringbuffer size.
+// sessions do not share locks so total throughput should grow with number of sessions
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board_controller.h"
+#include "brainflow_constants.h"
+
+
+static std::string get_input_params (int session_num)
+{
+    // sessions are distinguished by input params, synthetic board ignores other_info
+    return "{\"serial_port\":\"\",\"ip_protocol\":0,\"ip_port\":0,\"ip_port_aux\":0,"
+           "\"ip_port_anc\":0,\"other_info\":\"session_" +
+        std::to_string (session_num) +
+        "\",\"mac_address\":\"\",\"ip_address\":\"\",\"ip_address_aux\":\"\","
+        "\"ip_address_anc\":\"\",\"timeout\":0,\"serial_number\":\"\",\"file\":\"\","
+        "\"file_aux\":\"\",\"file_anc\":\"\",\"master_board\":-100}";
+}
+
+static void worker (int session_handle, int num_samples, std::atomic<bool> *stop,
+    std::atomic<long long> *num_calls)
+{
+    int num_rows = 0;
+    get_num_rows ((int)BoardIds::SYNTHETIC_BOARD, (int)BrainFlowPresets::DEFAULT_PRESET, &num_rows);
+    std::vector<double> buf (num_samples * num_rows);
+    long long calls = 0;
+    while (!stop->load ())
+    {
+        int returned_samples = 0;
+        int count = 0;
+        get_current_board_data_by_handle (num_samples, (int)BrainFlowPresets::DEFAULT_PRESET,
+            buf.data (), &returned_samples, session_handle);
+        insert_marker_by_handle (1.0, (int)BrainFlowPresets::DEFAULT_PRESET, session_handle);
+        get_board_data_count_by_handle (
+            (int)BrainFlowPresets::DEFAULT_PRESET, &count, session_handle);
+        calls += 3;
+    }
+    num_calls->fetch_add (calls);
+}
+
+static void run_benchmark (int num_sessions, int num_samples, int duration_ms)
+{
+    std::vector<int> handles;
+    for (int i = 0; i < num_sessions; i++)
+    {
+        int handle = -1;
+        std::string params = get_input_params (i);
+        if ((prepare_session_with_handle ((int)BoardIds::SYNTHETIC_BOARD, params.c_str (),
+                 &handle) != (int)BrainFlowExitCodes::STATUS_OK) ||
+            (start_stream_by_handle (45000, "", handle) != (int)BrainFlowExitCodes::STATUS_OK))
+        {
+            printf ("failed to start session %d\n", i);
+            release_all_sessions ();
+            return;
+        }
+        handles.push_back (handle);
+    }
+    // let ringbuffers fill up
+    std::this_thread::sleep_for (std::chrono::milliseconds (1500));
+
+    std::atomic<bool> stop (false);
+    std::atomic<long long> num_calls (0);
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now ();
+    for (int handle : handles)
+    {
+        threads.push_back (std::thread (worker, handle, num_samples, &stop, &num_calls));
+    }
+    std::this_thread::sleep_for (std::chrono::milliseconds (duration_ms));
+    stop = true;
+    for (std::thread &thread : threads)
+    {
+        thread.join ();
+    }
+    auto stop_time = std::chrono::steady_clock::now ();
+    double seconds = std::chrono::duration<double> (stop_time - start).count ();
+
+    for (int handle : handles)
+    {
+        stop_stream_by_handle (handle);
+        release_session_by_handle (handle);
+    }
+    printf ("%8d %8d %14.0f %14.0f\n", num_sessions, num_samples,
+        (double)num_calls.load () / seconds, (double)num_calls.load () / seconds / num_sessions);
+}
+
+int main (int argc, char *argv[])
+{
+    set_log_level_board_controller (6); // off
+    int num_sessions_list[] = {1, 2, 4, 8};
+    int num_samples_list[] = {250, 7500}; // ui frame, 30s window
+    int hw_threads = (int)std::thread::hardware_concurrency ();
+
+    printf ("hardware threads: %d\n", hw_threads);
+    printf ("%8s %8s %14s %14s\n", "sessions", "samples", "calls/s", "calls/s/session");
+    for (int num_samples : num_samples_list)
+    {
+        for (int num_sessions : num_sessions_list)
+        {
+            run_benchmark (num_sessions, num_samples, 2000);
+        }
+    }
+    return 0;
+}
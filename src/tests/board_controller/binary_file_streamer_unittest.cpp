@@ -0,0 +1,116 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bfrec_format.h"
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+static long get_num_recorded (const char *file_name)
+{
+    BFRecReader reader;
+    if (reader.open (file_name) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return -1;
+    }
+    return reader.get_num_samples ();
+}
+
+static void check_flush_by_time (const char *streamer_type, const char *file_name)
+{
+    std::string params = make_test_params (streamer_type);
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    int handle = -1;
+    ASSERT_EQ (prepare_session_with_handle ((int)BoardIds::SYNTHETIC_BOARD, params.c_str (),
+                   &handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    std::string streamer = std::string (streamer_type) + "://" + file_name + ":w";
+    ASSERT_EQ (start_stream_by_handle (45000, streamer.c_str (), handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // synthetic board at 250 Hz needs much longer to fill buffer or block
+    std::this_thread::sleep_for (std::chrono::milliseconds (1500));
+    long num_recorded = get_num_recorded (file_name);
+    EXPECT_GT (num_recorded, 0);
+    EXPECT_LT (num_recorded, 512);
+    ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int count = 0;
+    get_board_data_count_by_handle (preset, &count, handle);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    // the rest is written on release
+    EXPECT_EQ (get_num_recorded (file_name), count);
+    remove (file_name);
+}
+
+TEST (BinaryFileStreamerTest, Stream_SlowBoard_FlushByTime)
+{
+    check_flush_by_time ("binary_file", "binary_file_streamer_flush.bfrec");
+}
+
+TEST (BinaryFileStreamerTest, Stream_SlowBoardCompressed_FlushPartialBlockByTime)
+{
+    check_flush_by_time ("compressed_file", "compressed_file_streamer_flush.bfrec");
+}
+
+TEST (BinaryFileStreamerTest, Playback_SetIndexPercentage_SeekBySample)
+{
+    const char *file_name = "binary_file_playback_seek.bfrec";
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    int num_rows = 0;
+    int timestamp_channel = 0;
+    get_num_rows (board_id, preset, &num_rows);
+    get_timestamp_channel (board_id, preset, &timestamp_channel);
+    // channel 1 holds sample index
+    BFRecHeader header;
+    header.board_id = board_id;
+    header.num_rows = num_rows;
+    FILE *fp = fopen (file_name, "wb");
+    ASSERT_TRUE (fp != NULL);
+    ASSERT_EQ (bfrec_write_header (fp, header), (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> sample (num_rows, 0.0);
+    std::vector<char> bytes (sizeof (double) * num_rows);
+    for (int i = 0; i < 1000; i++)
+    {
+        sample[1] = (double)i;
+        sample[timestamp_channel] = 1000.0 + i * 0.004;
+        bfrec_encode (sample.data (), num_rows, bytes.data ());
+        fwrite (bytes.data (), 1, bytes.size (), fp);
+    }
+    fclose (fp);
+
+    std::string params = make_test_params ("binary_file_seek", file_name, board_id);
+    int handle = -1;
+    ASSERT_EQ (prepare_session_with_handle (
+                   (int)BoardIds::PLAYBACK_FILE_BOARD, params.c_str (), &handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    char response[1024];
+    int response_len = 0;
+    config_board_by_handle ("old_timestamps", response, &response_len, handle);
+    ASSERT_EQ (config_board_by_handle ("set_index_percentage:50", response, &response_len, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int count = 0;
+    for (int i = 0; (i < 100) && (count < 1); i++)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (10));
+        get_board_data_count_by_handle (preset, &count, handle);
+    }
+    ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    get_board_data_count_by_handle (preset, &count, handle);
+    ASSERT_GT (count, 0);
+    std::vector<double> data ((size_t)count * num_rows);
+    ASSERT_EQ (get_board_data_by_handle (count, preset, data.data (), handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // data is channel major
+    EXPECT_EQ (data[(size_t)count * 1], 500.0);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    remove (file_name);
+}
@@ -0,0 +1,241 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <stdio.h>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+
+#include "json.hpp"
+
+using json = nlohmann::json;
+using namespace testing;
+
+
+static json get_metrics (int handle)
+{
+    char metrics[16000];
+    int len = 0;
+    int res = get_board_metrics_by_handle (
+        (int)BrainFlowPresets::DEFAULT_PRESET, metrics, &len, handle);
+    EXPECT_EQ (res, (int)BrainFlowExitCodes::STATUS_OK);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return json::object ();
+    }
+    return json::parse (std::string (metrics, len));
+}
+
+// playback of synthetic board packages with given package nums and timestamps
+class PackageNumPlayback
+{
+public:
+    int num_rows;
+    int package_num_channel;
+    int timestamp_channel;
+    std::vector<double> data; // channel major like get_board_data returns
+    int count;
+    json metrics;
+
+    PackageNumPlayback () : num_rows (0), package_num_channel (0), timestamp_channel (0), count (0)
+    {
+        int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+        int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+        get_num_rows (board_id, preset, &num_rows);
+        get_package_num_channel (board_id, preset, &package_num_channel);
+        get_timestamp_channel (board_id, preset, &timestamp_channel);
+    }
+
+    void play (const char *name, const std::vector<double> &package_nums,
+        const std::vector<double> &timestamps, int package_num_check, int expected_count)
+    {
+        std::string file_name = std::string (name) + ".csv";
+        FILE *fp = fopen (file_name.c_str (), "w");
+        ASSERT_TRUE (fp != NULL);
+        for (size_t i = 0; i < package_nums.size (); i++)
+        {
+            for (int j = 0; j < num_rows; j++)
+            {
+                double value = 1.0;
+                if (j == package_num_channel)
+                {
+                    value = package_nums[i];
+                }
+                else if (j == timestamp_channel)
+                {
+                    value = timestamps[i];
+                }
+                fprintf (fp, "%.17g%c", value, (j == num_rows - 1) ? '\n' : '\t');
+            }
+        }
+        fclose (fp);
+
+        std::string params = make_test_params (name, file_name.c_str (),
+            (int)BoardIds::SYNTHETIC_BOARD, (int)BufferStorageTypes::FLOAT64, package_num_check);
+        int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+        int handle = -1;
+        ASSERT_EQ (prepare_session_with_handle (
+                       (int)BoardIds::PLAYBACK_FILE_BOARD, params.c_str (), &handle),
+            (int)BrainFlowExitCodes::STATUS_OK);
+        char response[1024];
+        int response_len = 0;
+        config_board_by_handle ("old_timestamps", response, &response_len, handle);
+        ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+        for (int i = 0; (i < 200) && (count < expected_count); i++)
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (10));
+            get_board_data_count_by_handle (preset, &count, handle);
+        }
+        // make sure that nothing else arrives
+        std::this_thread::sleep_for (std::chrono::milliseconds (50));
+        ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+        get_board_data_count_by_handle (preset, &count, handle);
+        metrics = get_metrics (handle);
+        data.resize ((size_t)count * num_rows);
+        EXPECT_EQ (get_board_data_by_handle (count, preset, data.data (), handle),
+            (int)BrainFlowExitCodes::STATUS_OK);
+        EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+        remove (file_name.c_str ());
+    }
+
+    double get (int channel, int sample)
+    {
+        return data[(size_t)channel * count + sample];
+    }
+};
+
+static std::vector<double> make_timestamps (size_t count)
+{
+    std::vector<double> timestamps;
+    for (size_t i = 0; i < count; i++)
+    {
+        timestamps.push_back (1700000000.0 + i * 0.001);
+    }
+    return timestamps;
+}
+
+TEST (BoardMetricsTest, PackageNums_Gaps_CountLostPackages)
+{
+    std::vector<double> package_nums {0, 1, 2, 5, 6, 10, 11};
+    PackageNumPlayback playback;
+    playback.play ("metrics_gaps", package_nums, make_timestamps (package_nums.size ()),
+        (int)PackageNumCheckTypes::COUNT_GAPS, 7);
+    EXPECT_EQ (playback.count, 7);
+    EXPECT_EQ (playback.metrics["package_gaps"].get<int> (), 2);
+    EXPECT_EQ (playback.metrics["packages_lost"].get<int> (), 5);
+    EXPECT_EQ (playback.metrics["package_wraparounds"].get<int> (), 0);
+    EXPECT_EQ (playback.metrics["package_duplicates"].get<int> (), 0);
+    EXPECT_EQ (playback.metrics["placeholders_inserted"].get<int> (), 0);
+}
+
+TEST (BoardMetricsTest, PackageNums_CounterWrap_CountWrapAndLostAfterWrap)
+{
+    std::vector<double> package_nums;
+    for (int i = 250; i < 256; i++)
+    {
+        package_nums.push_back (i); // counter starts in the middle of the range
+    }
+    for (int i = 0; i < 256; i++)
+    {
+        package_nums.push_back (i);
+    }
+    package_nums.push_back (2); // packages 0 and 1 are lost in second wrap
+    package_nums.push_back (3);
+    PackageNumPlayback playback;
+    playback.play ("metrics_wrap", package_nums, make_timestamps (package_nums.size ()),
+        (int)PackageNumCheckTypes::COUNT_GAPS, (int)package_nums.size ());
+    EXPECT_EQ (playback.count, (int)package_nums.size ());
+    EXPECT_EQ (playback.metrics["package_wraparounds"].get<int> (), 2);
+    EXPECT_EQ (playback.metrics["package_gaps"].get<int> (), 1);
+    EXPECT_EQ (playback.metrics["packages_lost"].get<int> (), 2);
+    EXPECT_EQ (playback.metrics["package_duplicates"].get<int> (), 0);
+}
+
+TEST (BoardMetricsTest, PackageNums_ShortDrops_CountDuplicatesNotWraps)
+{
+    std::vector<double> package_nums {0, 1, 0, 2, 3, 2, 3, 4};
+    PackageNumPlayback playback;
+    playback.play ("metrics_duplicates", package_nums, make_timestamps (package_nums.size ()),
+        (int)PackageNumCheckTypes::COUNT_GAPS, 8);
+    EXPECT_EQ (playback.count, 8);
+    EXPECT_EQ (playback.metrics["package_duplicates"].get<int> (), 3);
+    EXPECT_EQ (playback.metrics["package_wraparounds"].get<int> (), 0);
+    EXPECT_EQ (playback.metrics["package_gaps"].get<int> (), 0);
+    EXPECT_EQ (playback.metrics["packages_lost"].get<int> (), 0);
+}
+
+TEST (BoardMetricsTest, PackageNums_FillGaps_InsertPlaceholdersWithInterpolatedTimestamps)
+{
+    std::vector<double> package_nums {0, 1, 4, 5};
+    std::vector<double> timestamps {1700000000.0, 1700000000.004, 1700000000.016, 1700000000.02};
+    PackageNumPlayback playback;
+    playback.play (
+        "metrics_fill", package_nums, timestamps, (int)PackageNumCheckTypes::FILL_GAPS, 6);
+    ASSERT_EQ (playback.count, 6);
+    EXPECT_EQ (playback.metrics["placeholders_inserted"].get<int> (), 2);
+    EXPECT_EQ (playback.metrics["packages_lost"].get<int> (), 2);
+    double expected_nums[6] = {0, 1, 2, 3, 4, 5};
+    double expected_timestamps[6] = {1700000000.0, 1700000000.004, 1700000000.008,
+        1700000000.012, 1700000000.016, 1700000000.02};
+    for (int i = 0; i < 6; i++)
+    {
+        EXPECT_EQ (playback.get (playback.package_num_channel, i), expected_nums[i]);
+        EXPECT_NEAR (playback.get (playback.timestamp_channel, i), expected_timestamps[i], 1e-6);
+    }
+    int data_channel = (playback.package_num_channel == 1) ? 2 : 1;
+    EXPECT_EQ (playback.get (data_channel, 1), 1.0);
+    EXPECT_TRUE (std::isnan (playback.get (data_channel, 2)));
+    EXPECT_TRUE (std::isnan (playback.get (data_channel, 3)));
+    EXPECT_EQ (playback.get (data_channel, 4), 1.0);
+}
+
+TEST (BoardMetricsTest, PackageNums_FillGapsTooLong_CountButDoNotFill)
+{
+    // gap is longer than MAX_GAP_PLACEHOLDERS
+    std::vector<double> package_nums {0, 1, 2000, 2001};
+    PackageNumPlayback playback;
+    playback.play ("metrics_long_gap", package_nums, make_timestamps (package_nums.size ()),
+        (int)PackageNumCheckTypes::FILL_GAPS, 4);
+    EXPECT_EQ (playback.count, 4);
+    EXPECT_EQ (playback.metrics["package_gaps"].get<int> (), 1);
+    EXPECT_EQ (playback.metrics["packages_lost"].get<int> (), 1998);
+    EXPECT_EQ (playback.metrics["placeholders_inserted"].get<int> (), 0);
+    EXPECT_EQ (playback.get (playback.package_num_channel, 2), 2000.0);
+}
+
+TEST (BoardMetricsTest, DeleteStreamer_WhileStreaming_StreamerRemovedAndContentionsReported)
+{
+    std::string params = make_test_params ("metrics_delete_streamer");
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    int handle = -1;
+    ASSERT_EQ (prepare_session_with_handle ((int)BoardIds::SYNTHETIC_BOARD, params.c_str (),
+                   &handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    const char *streamer = "file://metrics_delete_streamer.csv:w";
+    ASSERT_EQ (
+        add_streamer_by_handle (streamer, preset, handle), (int)BrainFlowExitCodes::STATUS_OK);
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    EXPECT_EQ (delete_streamer_by_handle (streamer, preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (delete_streamer_by_handle (streamer, preset, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+
+    json metrics = get_metrics (handle);
+    ASSERT_TRUE (metrics.contains ("preset_lock_contentions"));
+    EXPECT_GE (metrics["preset_lock_contentions"].get<long long> (), 0);
+    EXPECT_GT (metrics["samples_pushed"].get<long long> (), 0);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+
+    FILE *fp = fopen ("metrics_delete_streamer.csv", "r");
+    ASSERT_TRUE (fp != NULL);
+    fseek (fp, 0, SEEK_END);
+    EXPECT_GT (ftell (fp), 0);
+    fclose (fp);
+    remove ("metrics_delete_streamer.csv");
+}
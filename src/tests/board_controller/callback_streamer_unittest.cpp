@@ -0,0 +1,181 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+#include "callback_streamer.h"
+
+using namespace testing;
+
+
+struct CallbackRecord
+{
+    std::mutex lock;
+    std::vector<int> batch_sizes;
+    std::vector<double> package_nums;
+    int num_rows;
+    int package_num_channel;
+    int session_handle;
+    std::atomic<int> api_calls;
+
+    CallbackRecord () : num_rows (0), package_num_channel (0), session_handle (-1), api_calls (0)
+    {
+    }
+
+    int get_total ()
+    {
+        std::lock_guard<std::mutex> guard (lock);
+        int total = 0;
+        for (int batch_size : batch_sizes)
+        {
+            total += batch_size;
+        }
+        return total;
+    }
+};
+
+static void record_callback (
+    const double *data, int num_rows, int num_samples, int preset, void *user_data)
+{
+    CallbackRecord *record = (CallbackRecord *)user_data;
+    std::lock_guard<std::mutex> guard (record->lock);
+    record->num_rows = num_rows;
+    record->batch_sizes.push_back (num_samples);
+    for (int i = 0; i < num_samples; i++)
+    {
+        record->package_nums.push_back (data[record->package_num_channel * num_samples + i]);
+    }
+}
+
+// slow callback which calls api of its own session
+static void api_callback (
+    const double *data, int num_rows, int num_samples, int preset, void *user_data)
+{
+    CallbackRecord *record = (CallbackRecord *)user_data;
+    std::this_thread::sleep_for (std::chrono::milliseconds (20));
+    int count = 0;
+    get_board_data_count_by_handle (preset, &count, record->session_handle);
+    record->api_calls++;
+}
+
+static int prepare_synthetic (const char *other_info, CallbackRecord &record)
+{
+    std::string params = make_test_params (other_info);
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+    int session_handle = -1;
+    EXPECT_EQ (prepare_session_with_handle (board_id, params.c_str (), &session_handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    get_package_num_channel (
+        board_id, (int)BrainFlowPresets::DEFAULT_PRESET, &record.package_num_channel);
+    record.session_handle = session_handle;
+    return session_handle;
+}
+
+TEST (CallbackStreamerTest, Register_InvalidBatchSize_Fail)
+{
+    CallbackRecord record;
+    int handle = prepare_synthetic ("callback_invalid", record);
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    EXPECT_EQ (register_data_callback_by_handle (record_callback, &record, 0, preset, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (register_data_callback_by_handle (
+                   record_callback, &record, CALLBACK_STREAMER_MAX_BATCH_SIZE + 1, preset, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (unregister_data_callback_by_handle (preset, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (CallbackStreamerTest, Stream_FullBatches_DeliverAllPackagesInOrder)
+{
+    CallbackRecord record;
+    int handle = prepare_synthetic ("callback_batches", record);
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (register_data_callback_by_handle (record_callback, &record, 25, preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    for (int i = 0; (i < 100) && (record.get_total () < 100); i++)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (20));
+    }
+    ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (unregister_data_callback_by_handle (preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    int count = 0;
+    ASSERT_EQ (get_board_data_count_by_handle (preset, &count, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    int num_rows = 0;
+    get_num_rows ((int)BoardIds::SYNTHETIC_BOARD, preset, &num_rows);
+    EXPECT_EQ (record.num_rows, num_rows);
+    EXPECT_EQ (record.get_total (), count);
+    ASSERT_GE (record.batch_sizes.size (), 4u);
+    // only the last batch can be incomplete
+    for (size_t i = 0; i + 1 < record.batch_sizes.size (); i++)
+    {
+        EXPECT_EQ (record.batch_sizes[i], 25);
+    }
+    EXPECT_LE (record.batch_sizes.back (), 25);
+    for (size_t i = 1; i < record.package_nums.size (); i++)
+    {
+        EXPECT_EQ ((int)(record.package_nums[i] - record.package_nums[i - 1] + 256) % 256, 1);
+    }
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (CallbackStreamerTest, Unregister_IncompleteBatch_DeliverRestOnUnregister)
+{
+    CallbackRecord record;
+    int handle = prepare_synthetic ("callback_partial", record);
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (register_data_callback_by_handle (record_callback, &record, 5000, preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    std::this_thread::sleep_for (std::chrono::milliseconds (300));
+    ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (record.get_total (), 0);
+    ASSERT_EQ (unregister_data_callback_by_handle (preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+
+    int count = 0;
+    get_board_data_count_by_handle (preset, &count, handle);
+    ASSERT_GT (count, 0);
+    ASSERT_EQ (record.batch_sizes.size (), 1u);
+    EXPECT_EQ (record.batch_sizes[0], count);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (CallbackStreamerTest, Unregister_CallbackCallsApi_NoDeadlock)
+{
+    CallbackRecord record;
+    int handle = prepare_synthetic ("callback_api_unregister", record);
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (register_data_callback_by_handle (api_callback, &record, 1, preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    // callback is inside sleep or api call while streamer is removed
+    EXPECT_EQ (unregister_data_callback_by_handle (preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_GT (record.api_calls.load (), 0);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (CallbackStreamerTest, Release_CallbackCallsApi_NoDeadlock)
+{
+    CallbackRecord record;
+    int handle = prepare_synthetic ("callback_api_release", record);
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (register_data_callback_by_handle (api_callback, &record, 1, preset, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_GT (record.api_calls.load (), 0);
+}
@@ -0,0 +1,82 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+TEST (ChannelStorageTest, Float32Storage_GaleaTimestampsInOtherChannels_KeepExactValues)
+{
+    int board_id = (int)BoardIds::GALEA_BOARD;
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    int num_rows = 0;
+    int timestamp_channel = 0;
+    int num_other = 0;
+    int other_channels[32];
+    ASSERT_EQ (get_num_rows (board_id, preset, &num_rows), (int)BrainFlowExitCodes::STATUS_OK);
+    get_timestamp_channel (board_id, preset, &timestamp_channel);
+    ASSERT_EQ (get_other_channels (board_id, preset, other_channels, &num_other),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (num_other, 2);
+
+    // galea puts pc timestamp and device timestamp to other channels
+    const char *file_name = "channel_storage_galea.csv";
+    std::vector<std::vector<double>> rows;
+    FILE *fp = fopen (file_name, "w");
+    ASSERT_TRUE (fp != NULL);
+    for (int i = 0; i < 20; i++)
+    {
+        std::vector<double> row (num_rows, 0.0);
+        row[0] = i;
+        row[timestamp_channel] = 1700000000.0 + i * 0.004;
+        row[other_channels[0]] = 1700000000.123456 + i * 0.004001;
+        row[other_channels[1]] = 123456.789012 + i * 0.004;
+        for (int j = 0; j < num_rows; j++)
+        {
+            fprintf (fp, "%.17g%c", row[j], (j == num_rows - 1) ? '\n' : '\t');
+        }
+        rows.push_back (row);
+    }
+    fclose (fp);
+
+    std::string params = make_test_params (
+        "galea_float32", file_name, board_id, (int)BufferStorageTypes::FLOAT32);
+    int handle = -1;
+    ASSERT_EQ (prepare_session_with_handle ((int)BoardIds::PLAYBACK_FILE_BOARD, params.c_str (),
+                   &handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    char response[1024];
+    int response_len = 0;
+    config_board_by_handle ("old_timestamps", response, &response_len, handle);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int count = 0;
+    for (int i = 0; (i < 100) && (count < (int)rows.size ()); i++)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (20));
+        get_board_data_count_by_handle (preset, &count, handle);
+    }
+    ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (count, (int)rows.size ());
+
+    std::vector<double> data ((size_t)count * num_rows);
+    ASSERT_EQ (get_board_data_by_handle (count, preset, data.data (), handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    for (int i = 0; i < count; i++)
+    {
+        EXPECT_EQ (data[(size_t)timestamp_channel * count + i], rows[i][timestamp_channel]);
+        for (int j = 0; j < num_other; j++)
+        {
+            EXPECT_EQ (data[(size_t)other_channels[j] * count + i], rows[i][other_channels[j]]);
+        }
+    }
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    remove (file_name);
+}
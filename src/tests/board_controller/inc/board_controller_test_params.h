@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+
+#include "brainflow_constants.h"
+
+
+// input params json for board controller api, sessions are keyed by params so tests use different
+// other_info to get separate sessions
+inline std::string make_test_params (const char *other_info, const char *file = "",
+    int master_board = (int)BoardIds::NO_BOARD,
+    int buffer_storage = (int)BufferStorageTypes::FLOAT64,
+    int package_num_check = (int)PackageNumCheckTypes::OFF)
+{
+    return std::string ("{\"serial_port\":\"\",\"ip_protocol\":0,\"ip_port\":0,\"ip_port_aux\":0,"
+                        "\"ip_port_anc\":0,\"mac_address\":\"\",\"ip_address\":\"\","
+                        "\"ip_address_aux\":\"\",\"ip_address_anc\":\"\",\"timeout\":0,"
+                        "\"serial_number\":\"\",\"file_aux\":\"\",\"file_anc\":\"\","
+                        "\"other_info\":\"") +
+        other_info + "\",\"file\":\"" + file +
+        "\",\"master_board\":" + std::to_string (master_board) +
+        ",\"buffer_storage\":" + std::to_string (buffer_storage) +
+        ",\"package_num_check\":" + std::to_string (package_num_check) + "}";
+}
@@ -0,0 +1,65 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board_controller.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+static std::string read_file (const char *file)
+{
+    std::ifstream in (file);
+    std::stringstream content;
+    content << in.rdbuf ();
+    return content.str ();
+}
+
+TEST (LoggerTest, SetLogFile_OtherThreadsLog_NoCrashAndNewFileUsed)
+{
+    const char *files[] = {"logger_swap_0.log", "logger_swap_1.log"};
+    int board_id = (int)BoardIds::SYNTHETIC_BOARD;
+    std::atomic<bool> stop (false);
+    std::vector<std::thread> loggers;
+    std::remove (files[0]);
+    std::remove (files[1]);
+    for (int i = 0; i < 4; i++)
+    {
+        // unknown session is reported through board logger without logger_mutex
+        loggers.push_back (std::thread (
+            [&]
+            {
+                int count = 0;
+                while (!stop)
+                {
+                    get_board_data_count (
+                        (int)BrainFlowPresets::DEFAULT_PRESET, &count, board_id, "{}");
+                }
+            }));
+    }
+    for (int i = 0; i < 50; i++)
+    {
+        EXPECT_EQ (
+            set_log_file_board_controller (files[i % 2]), (int)BrainFlowExitCodes::STATUS_OK);
+    }
+    stop = true;
+    for (std::thread &logger : loggers)
+    {
+        logger.join ();
+    }
+
+    set_log_level_board_controller ((int)LogLevels::LEVEL_INFO);
+    char message[] = "logger swap done";
+    EXPECT_EQ (log_message_board_controller ((int)LogLevels::LEVEL_INFO, message),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_THAT (read_file (files[1]), HasSubstr (message));
+    std::remove (files[0]);
+    std::remove (files[1]);
+}
@@ -0,0 +1,95 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+#ifndef _WIN32
+static long long get_elapsed_ms (std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds> (
+        std::chrono::steady_clock::now () - start)
+        .count ();
+}
+
+TEST (StreamerPoolTest, BlockPolicy_SlowStreamer_ConsumersDoNotWait)
+{
+    const char *fifo = "slow_streamer.fifo";
+    unlink (fifo);
+    ASSERT_EQ (mkfifo (fifo, 0600), 0);
+    // nobody reads from fifo till the end, file streamer gets stuck once pipe is full
+    int reader = open (fifo, O_RDONLY | O_NONBLOCK);
+    ASSERT_GE (reader, 0);
+    setenv ("BRAINFLOW_STREAMER_POLICY", "block", 1);
+    setenv ("BRAINFLOW_STREAMER_QUEUE_SIZE", "10", 1);
+
+    std::string params = make_test_params ("slow_streamer");
+    int handle = -1;
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (prepare_session_with_handle (
+                   (int)BoardIds::SYNTHETIC_BOARD, params.c_str (), &handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (start_stream_by_handle (45000, "file://slow_streamer.fifo:w", handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // read thread waits for free space in streamer queue after that
+    std::this_thread::sleep_for (std::chrono::milliseconds (2000));
+
+    // consumers of the same preset should not wait for read thread
+    std::atomic<bool> done (false);
+    std::thread consumer (
+        [&]
+        {
+            int count = 0;
+            EXPECT_EQ (get_board_data_count_by_handle (preset, &count, handle),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            EXPECT_GT (count, 0);
+            EXPECT_EQ (insert_marker_by_handle (1.0, preset, handle),
+                (int)BrainFlowExitCodes::STATUS_OK);
+            done = true;
+        });
+    auto start = std::chrono::steady_clock::now ();
+    while ((!done) && (get_elapsed_ms (start) < 1000))
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+    EXPECT_TRUE (done.load ());
+
+    // drain fifo to let streamer and read thread finish
+    std::atomic<bool> stop (false);
+    std::thread drain (
+        [&]
+        {
+            char buf[4096];
+            while (!stop)
+            {
+                if (read (reader, buf, sizeof (buf)) <= 0)
+                {
+                    std::this_thread::sleep_for (std::chrono::milliseconds (1));
+                }
+            }
+        });
+    consumer.join ();
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    stop = true;
+    drain.join ();
+    close (reader);
+    unlink (fifo);
+    unsetenv ("BRAINFLOW_STREAMER_POLICY");
+    unsetenv ("BRAINFLOW_STREAMER_QUEUE_SIZE");
+}
+#endif
@@ -0,0 +1,102 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+static int prepare_synthetic (const char *other_info)
+{
+    std::string params = make_test_params (other_info);
+    int session_handle = -1;
+    EXPECT_EQ (prepare_session_with_handle (
+                   (int)BoardIds::SYNTHETIC_BOARD, params.c_str (), &session_handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    return session_handle;
+}
+
+static long long get_elapsed_ms (std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds> (
+        std::chrono::steady_clock::now () - start)
+        .count ();
+}
+
+TEST (WaitForBoardDataTest, Wait_InvalidArgsOrNoStream_Fail)
+{
+    int handle = prepare_synthetic ("wait_invalid");
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    int result = 0;
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 10, 100, &result, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 0, 100, &result, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 10, -1, &result, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 10, 100, NULL, handle),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 10, 100, &result, handle),
+        (int)BrainFlowExitCodes::BOARD_NOT_CREATED_ERROR);
+}
+
+TEST (WaitForBoardDataTest, Wait_NotEnoughData_ReturnTimeoutAndCurrentCount)
+{
+    int handle = prepare_synthetic ("wait_timeout");
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int result = -1;
+    auto start = std::chrono::steady_clock::now ();
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 40000, 200, &result, handle),
+        (int)BrainFlowExitCodes::SYNC_TIMEOUT_ERROR);
+    long long elapsed = get_elapsed_ms (start);
+    EXPECT_GE (elapsed, 200);
+    EXPECT_LT (elapsed, 2000);
+    EXPECT_GE (result, 0);
+    EXPECT_LT (result, 40000);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (WaitForBoardDataTest, Wait_DataArrives_WakeUpBeforeTimeout)
+{
+    int handle = prepare_synthetic ("wait_wake_up");
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int result = 0;
+    auto start = std::chrono::steady_clock::now ();
+    // synthetic board streams at 250 Hz, so 50 samples arrive in about 200 ms
+    EXPECT_EQ (wait_for_board_data_by_handle (preset, 50, 10000, &result, handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_LT (get_elapsed_ms (start), 5000);
+    EXPECT_GE (result, 50);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+}
+
+TEST (WaitForBoardDataTest, Wait_SessionReleasedDuringWait_WakeUpWithError)
+{
+    int handle = prepare_synthetic ("wait_release");
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    ASSERT_EQ (start_stream_by_handle (45000, "", handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int wait_res = 0;
+    long long elapsed = 0;
+    std::thread waiter (
+        [&]
+        {
+            int result = 0;
+            auto start = std::chrono::steady_clock::now ();
+            wait_res = wait_for_board_data_by_handle (preset, 40000, 10000, &result, handle);
+            elapsed = get_elapsed_ms (start);
+        });
+    std::this_thread::sleep_for (std::chrono::milliseconds (200));
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    waiter.join ();
+    EXPECT_EQ (wait_res, (int)BrainFlowExitCodes::BOARD_NOT_READY_ERROR);
+    EXPECT_LT (elapsed, 5000);
+}
@@ -29,10 +29,33 @@ enable_testing()
 
 SET (TESTS_SRC
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/bluetooth_functions.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/timestamp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/socket_client_udp.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/datagram_batch.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_format.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_compression.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bfrec_segments.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/spsc_data_buffer.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/stream_frame.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/shared_memory_ring.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/socket_bluetooth_test.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/bluetooth_functions_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/datagram_batch_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bfrec_format_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bfrec_compression_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bfrec_segments_unittest.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/data_buffer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/spsc_data_buffer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/stream_frame_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/shared_memory_ring_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/callback_streamer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/channel_storage_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/board_metrics_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/binary_file_streamer_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/wait_for_board_data_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/logger_unittest.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/streamer_pool_unittest.cpp
 )
 
 add_executable(
@@ -46,12 +69,20 @@ target_include_directories (
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/utils/bluetooth/inc
     ${CMAKE_CURRENT_SOURCE_DIR}/src/utils/bluetooth/macos_third_party
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/board_controller/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/tests/board_controller/inc
+    ${CMAKE_CURRENT_SOURCE_DIR}/third_party/json
 )
 
+# board controller tests use public api of the library with synthetic and playback boards
 target_link_libraries(
     ${TESTS_EXE_NAME} PRIVATE
     gmock_main
+    ${BOARD_CONTROLLER_NAME}
 )
+if (UNIX AND NOT ANDROID AND NOT APPLE)
+    target_link_libraries (${TESTS_EXE_NAME} PRIVATE rt)
+endif (UNIX AND NOT ANDROID AND NOT APPLE)
 
 set_target_properties (${TESTS_EXE_NAME}
     PROPERTIES
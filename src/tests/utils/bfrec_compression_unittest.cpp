@@ -0,0 +1,89 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <limits>
+#include <math.h>
+#include <random>
+#include <string.h>
+#include <vector>
+
+#include "bfrec_compression.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+static bool is_bitwise_equal (const std::vector<double> &a, const std::vector<double> &b)
+{
+    return (a.size () == b.size ()) &&
+        (memcmp (a.data (), b.data (), a.size () * sizeof (double)) == 0);
+}
+
+TEST (BFRecCompressionTest, Decompress_QuantizedChannels_ReturnExactValuesAndCompress)
+{
+    const int num_rows = 4;
+    const int num_samples = BFREC_BLOCK_SAMPLES;
+    // package num, adc codes scaled by gain, constant marker, timestamp
+    const double scale = 4.5 / 24.0 / (pow (2, 23) - 1) * 1000000.0;
+    std::vector<double> samples (num_rows * num_samples);
+    for (int i = 0; i < num_samples; i++)
+    {
+        samples[i * num_rows + 0] = (double)(i % 256);
+        samples[i * num_rows + 1] = scale * (int)(10000.0 * sin (i / 10.0));
+        samples[i * num_rows + 2] = 0.0;
+        samples[i * num_rows + 3] = 1700000000.123 + i * 0.004;
+    }
+    std::vector<char> bytes;
+    bfrec_compress_block (samples.data (), num_samples, num_rows, bytes);
+    std::vector<double> decoded (samples.size ());
+
+    ASSERT_EQ (bfrec_decompress_block (
+                   bytes.data (), bytes.size (), num_samples, num_rows, decoded.data ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_TRUE (is_bitwise_equal (samples, decoded));
+    EXPECT_LT (bytes.size (), samples.size () * sizeof (double) / 3);
+}
+
+TEST (BFRecCompressionTest, Decompress_RandomAndSpecialValues_ReturnExactValues)
+{
+    const int num_rows = 3;
+    const int num_samples = 100;
+    std::mt19937_64 gen (42);
+    std::uniform_real_distribution<double> dist (-1e6, 1e6);
+    std::vector<double> samples (num_rows * num_samples);
+    for (size_t i = 0; i < samples.size (); i++)
+    {
+        samples[i] = dist (gen);
+    }
+    samples[0] = std::numeric_limits<double>::quiet_NaN ();
+    samples[4] = -0.0;
+    samples[8] = std::numeric_limits<double>::infinity ();
+    std::vector<char> bytes;
+    bfrec_compress_block (samples.data (), num_samples, num_rows, bytes);
+    std::vector<double> decoded (samples.size ());
+
+    ASSERT_EQ (bfrec_decompress_block (
+                   bytes.data (), bytes.size (), num_samples, num_rows, decoded.data ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_TRUE (is_bitwise_equal (samples, decoded));
+    // raw fallback limits expansion to mode bytes
+    EXPECT_LE (bytes.size (), samples.size () * sizeof (double) + num_rows);
+}
+
+TEST (BFRecCompressionTest, Decompress_DataIsTruncated_ReturnError)
+{
+    const int num_rows = 2;
+    const int num_samples = 64;
+    std::vector<double> samples (num_rows * num_samples);
+    for (int i = 0; i < num_samples; i++)
+    {
+        samples[i * num_rows + 0] = i * 0.5;
+        samples[i * num_rows + 1] = 1.0 / (i + 1);
+    }
+    std::vector<char> bytes;
+    bfrec_compress_block (samples.data (), num_samples, num_rows, bytes);
+    std::vector<double> decoded (samples.size ());
+
+    EXPECT_NE (bfrec_decompress_block (
+                   bytes.data (), bytes.size () / 2, num_samples, num_rows, decoded.data ()),
+        (int)BrainFlowExitCodes::STATUS_OK);
+}
@@ -0,0 +1,123 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "bfrec_format.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+TEST (BFRecFormatTest, ReadHeader_HeaderWasWritten_ReturnSameFieldsAndAlignedOffset)
+{
+    FILE *fp = tmpfile ();
+    ASSERT_NE (fp, nullptr);
+    BFRecHeader header;
+    header.board_id = 1;
+    header.preset = 2;
+    header.num_rows = 5;
+    header.descr = "{\"eeg_channels\":[1,2,3]}";
+
+    ASSERT_EQ (bfrec_write_header (fp, header), (int)BrainFlowExitCodes::STATUS_OK);
+    fseek (fp, 0, SEEK_SET);
+    BFRecHeader read_header;
+    EXPECT_TRUE (bfrec_check_magic (fp));
+    EXPECT_EQ (ftell (fp), 0);
+    ASSERT_EQ (bfrec_read_header (fp, read_header), (int)BrainFlowExitCodes::STATUS_OK);
+
+    EXPECT_EQ (read_header.board_id, 1);
+    EXPECT_EQ (read_header.preset, 2);
+    EXPECT_EQ (read_header.num_rows, 5);
+    EXPECT_EQ (read_header.descr, header.descr);
+    EXPECT_EQ (read_header.header_size, header.header_size);
+    EXPECT_EQ (read_header.header_size % 8, 0);
+    EXPECT_EQ (bfrec_tell (fp), read_header.header_size);
+    fclose (fp);
+}
+
+TEST (BFRecFormatTest, GetNumSamples_LastSampleIsIncomplete_CountOnlyCompleteSamples)
+{
+    FILE *fp = tmpfile ();
+    ASSERT_NE (fp, nullptr);
+    BFRecHeader header;
+    header.num_rows = 3;
+    ASSERT_EQ (bfrec_write_header (fp, header), (int)BrainFlowExitCodes::STATUS_OK);
+    double values[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    char bytes[sizeof (values)];
+    bfrec_encode (values, 6, bytes);
+    fwrite (bytes, 1, sizeof (bytes), fp);
+    fwrite (bytes, 1, sizeof (double) * 2, fp); // part of the third sample
+
+    EXPECT_EQ (bfrec_get_num_samples (fp, header), 2);
+    fclose (fp);
+}
+
+TEST (BFRecFormatTest, Decode_ValuesWereEncoded_ReturnExactValues)
+{
+    double values[4] = {0.1, -123456.789012345, 1e-300, 42.0};
+    char bytes[sizeof (values)];
+    double decoded[4];
+
+    bfrec_encode (values, 4, bytes);
+    bfrec_decode (bytes, 4, decoded);
+
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (decoded[i], values[i]);
+    }
+    // little endian on disk, lowest byte of 42.0 is zero and highest is 0x40
+    EXPECT_EQ (bytes[3 * sizeof (double)], 0);
+    EXPECT_EQ (bytes[4 * sizeof (double) - 1], 0x40);
+}
+
+TEST (BFRecFormatTest, CheckMagic_TextFile_ReturnFalse)
+{
+    FILE *fp = tmpfile ();
+    ASSERT_NE (fp, nullptr);
+    fprintf (fp, "1.000000\t2.000000\n");
+    fseek (fp, 0, SEEK_SET);
+    BFRecHeader header;
+
+    EXPECT_FALSE (bfrec_check_magic (fp));
+    EXPECT_EQ (bfrec_read_header (fp, header), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    fclose (fp);
+}
+
+TEST (BFRecFormatTest, ReaderRead_CompressedFileHasIncompleteBlock_ReturnCompleteBlocksOnly)
+{
+    const char *file_name = "bfrec_reader_test.bfrec";
+    FILE *fp = fopen (file_name, "wb");
+    ASSERT_NE (fp, nullptr);
+    BFRecHeader header;
+    header.num_rows = 2;
+    header.compressed = true;
+    ASSERT_EQ (bfrec_write_header (fp, header), (int)BrainFlowExitCodes::STATUS_OK);
+    std::vector<double> samples (2 * 300);
+    for (size_t i = 0; i < samples.size (); i++)
+    {
+        samples[i] = (double)(i % 7) * 0.25;
+    }
+    std::vector<char> buffer;
+    ASSERT_EQ (bfrec_write_block (fp, samples.data (), 200, 2, buffer),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (bfrec_write_block (fp, samples.data () + 400, 100, 2, buffer),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    fwrite (buffer.data (), 1, buffer.size () / 2, fp); // writer was killed
+    fclose (fp);
+
+    BFRecReader reader;
+    ASSERT_EQ (reader.open (file_name), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_TRUE (reader.get_header ().compressed);
+    EXPECT_EQ (reader.get_num_samples (), 300);
+    // read across block boundary after seek
+    std::vector<double> decoded (2 * 300);
+    ASSERT_EQ (reader.seek (150), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.read (300, decoded.data ()), 150);
+    EXPECT_EQ (memcmp (decoded.data (), samples.data () + 300, 150 * 2 * sizeof (double)), 0);
+    EXPECT_EQ (reader.read (1, decoded.data ()), 0);
+    reader.close ();
+    remove (file_name);
+}
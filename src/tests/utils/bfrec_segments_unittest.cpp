@@ -0,0 +1,169 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bfrec_segments.h"
+#include "board_controller.h"
+#include "board_controller_test_params.h"
+#include "brainflow_constants.h"
+
+using namespace testing;
+
+
+// two columns: value and timestamp, 100 samples per block with timestamps 0.0, 0.1, ...
+// blocks 0-1 are in segment 1, block 2 is in segment 2
+static void write_recording (const std::string &prefix)
+{
+    FILE *index_fp = fopen (bfrec_index_file_name (prefix).c_str (), "wb");
+    ASSERT_NE (index_fp, nullptr);
+    ASSERT_EQ (bfrec_write_index_header (index_fp, 2, 1), (int)BrainFlowExitCodes::STATUS_OK);
+    BFRecHeader header;
+    header.num_rows = 2;
+    header.compressed = true;
+    std::vector<char> buffer;
+    FILE *segment_fp = NULL;
+    for (int block = 0; block < 3; block++)
+    {
+        int segment = (block < 2) ? 1 : 2;
+        if ((block == 0) || (block == 2))
+        {
+            if (segment_fp != NULL)
+            {
+                fclose (segment_fp);
+            }
+            segment_fp = fopen (bfrec_segment_file_name (prefix, segment).c_str (), "wb");
+            ASSERT_NE (segment_fp, nullptr);
+            bfrec_write_header (segment_fp, header);
+        }
+        std::vector<double> samples;
+        for (int i = block * 100; i < (block + 1) * 100; i++)
+        {
+            samples.push_back ((double)i);
+            samples.push_back (i * 0.1);
+        }
+        BFRecIndexEntry entry;
+        entry.first_timestamp = samples[1];
+        entry.last_timestamp = samples[samples.size () - 1];
+        entry.offset = bfrec_tell (segment_fp);
+        entry.segment = segment;
+        entry.num_samples = 100;
+        bfrec_write_block (segment_fp, samples.data (), 100, 2, buffer);
+        bfrec_write_index_entry (index_fp, entry);
+    }
+    fwrite ("partial", 1, 7, index_fp); // writer was killed
+    fclose (segment_fp);
+    fclose (index_fp);
+}
+
+static void remove_recording (const std::string &prefix)
+{
+    remove (bfrec_index_file_name (prefix).c_str ());
+    remove (bfrec_segment_file_name (prefix, 1).c_str ());
+    remove (bfrec_segment_file_name (prefix, 2).c_str ());
+}
+
+TEST (BFRecSegmentsTest, ReadRange_RangeCrossesSegments_ReturnSamplesInRange)
+{
+    std::string prefix = "bfrec_segments_test";
+    write_recording (prefix);
+    BFRecRangeReader reader;
+    ASSERT_EQ (reader.open (prefix.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_entries (), 3);
+
+    std::vector<double> samples;
+    ASSERT_EQ (reader.read_range (15.0, 25.0, samples), (int)BrainFlowExitCodes::STATUS_OK);
+    // only blocks 1 and 2 overlap the range
+    EXPECT_EQ (reader.get_max_samples (15.0, 25.0), 200);
+    ASSERT_GE (samples.size (), 4u);
+    EXPECT_LE (samples.size () / 2, 101u);
+    EXPECT_GE (samples.size () / 2, 99u);
+    EXPECT_GE (samples[1], 15.0);
+    EXPECT_LE (samples[samples.size () - 1], 25.0);
+    for (size_t i = 0; i < samples.size (); i += 2)
+    {
+        EXPECT_EQ (samples[i], (double)(int)(samples[i + 1] * 10.0 + 0.5));
+    }
+    reader.close ();
+    remove_recording (prefix);
+}
+
+TEST (BFRecSegmentsTest, ReadRange_RangeIsAfterRecording_ReturnNoSamples)
+{
+    std::string prefix = "bfrec_segments_test_empty";
+    write_recording (prefix);
+    BFRecRangeReader reader;
+    ASSERT_EQ (reader.open (prefix.c_str ()), (int)BrainFlowExitCodes::STATUS_OK);
+
+    std::vector<double> samples;
+    EXPECT_EQ (reader.read_range (100.0, 200.0, samples), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (samples.size (), 0u);
+    EXPECT_EQ (reader.get_max_samples (100.0, 200.0), 0);
+    reader.close ();
+    remove_recording (prefix);
+}
+
+TEST (BFRecSegmentsTest, IndexEntry_OffsetAbove4GB_ReadSameOffset)
+{
+    const char *file_name = "bfrec_segments_test_offset.bfidx";
+    FILE *fp = fopen (file_name, "w+b");
+    ASSERT_TRUE (fp != NULL);
+    ASSERT_EQ (bfrec_write_index_header (fp, 3, 2), (int)BrainFlowExitCodes::STATUS_OK);
+    BFRecIndexEntry entry;
+    entry.first_timestamp = 1.0;
+    entry.last_timestamp = 2.0;
+    entry.offset = (int64_t)5 * 1024 * 1024 * 1024 + 8;
+    entry.segment = 7;
+    entry.num_samples = 512;
+    ASSERT_EQ (bfrec_write_index_entry (fp, entry), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (bfrec_get_num_index_entries (fp), 1);
+
+    BFRecIndexEntry read_entry;
+    ASSERT_EQ (bfrec_read_index_entry (fp, 0, read_entry), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (read_entry.offset, entry.offset);
+    EXPECT_EQ (read_entry.segment, 7);
+    EXPECT_EQ (read_entry.num_samples, 512);
+    fclose (fp);
+    remove (file_name);
+}
+
+static long get_num_recorded (const std::string &prefix)
+{
+    BFRecRangeReader reader;
+    if (reader.open (prefix.c_str ()) != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return -1;
+    }
+    std::vector<double> samples;
+    reader.read_range (0.0, 1e12, samples);
+    return (long)(samples.size () / reader.get_num_rows ());
+}
+
+TEST (BFRecSegmentsTest, Stream_SlowBoard_FlushAndIndexByTime)
+{
+    std::string prefix = "bfrec_segments_test_flush";
+    std::string params = make_test_params ("segmented_file_flush");
+    int preset = (int)BrainFlowPresets::DEFAULT_PRESET;
+    int handle = -1;
+    ASSERT_EQ (prepare_session_with_handle ((int)BoardIds::SYNTHETIC_BOARD, params.c_str (),
+                   &handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    std::string streamer = "segmented_file://" + prefix + ":size_mb=100";
+    ASSERT_EQ (start_stream_by_handle (45000, streamer.c_str (), handle),
+        (int)BrainFlowExitCodes::STATUS_OK);
+    // synthetic board at 250 Hz needs much longer to fill a block
+    std::this_thread::sleep_for (std::chrono::milliseconds (1500));
+    long num_recorded = get_num_recorded (prefix);
+    EXPECT_GT (num_recorded, 0);
+    EXPECT_LT (num_recorded, 512);
+    ASSERT_EQ (stop_stream_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    int count = 0;
+    get_board_data_count_by_handle (preset, &count, handle);
+    EXPECT_EQ (release_session_by_handle (handle), (int)BrainFlowExitCodes::STATUS_OK);
+    // the rest is written on release
+    EXPECT_EQ (get_num_recorded (prefix), count);
+    remove_recording (prefix);
+}
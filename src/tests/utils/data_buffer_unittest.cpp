@@ -67,6 +67,37 @@ TEST (DataBufferTest, AddData_AddMoreDataThanBufferCapacity_OverwriteOldestData)
     }
 }
 
+TEST (DataBufferTest, AddDataBatch_BatchWrapsAround_OverwriteOldestData)
+{
+    DataBuffer buffer (2, 4);
+    double values[12];
+    for (int i = 0; i < 12; i++)
+    {
+        values[i] = (double)i;
+    }
+    double retrieved[8];
+
+    buffer.add_data (values, 3);
+    buffer.add_data (values + 6, 3);
+    auto result = buffer.get_data (4, retrieved);
+
+    EXPECT_EQ (result, 4);
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_EQ (retrieved[i], (double)(i + 4));
+    }
+
+    buffer.add_data (values, 6);
+    result = buffer.get_data (4, retrieved);
+
+    EXPECT_EQ (result, 4);
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_EQ (retrieved[i], (double)(i + 4));
+    }
+    EXPECT_EQ (buffer.get_data_count (), 0);
+}
+
 TEST (DataBufferTest, AddData_BufferIsNotReady_DoNothing)
 {
     DataBuffer buffer_zero (4, 0);
@@ -408,6 +439,112 @@ TEST (DataBufferTest, GetCurrentData_InvokedInMultipleThreads_DataReturnedWithou
     }
 }
 
+TEST (DataBufferTest, GetDataByChannels_DataWrapsAround_ReturnChannelMajorData)
+{
+    const int num_rows = 40;
+    const int num_packages = 70;
+    DataBuffer buffer (num_rows, 50);
+    double values[num_rows];
+    double retrieved[num_rows * 50];
+
+    for (int i = 0; i < num_packages; i++)
+    {
+        for (int j = 0; j < num_rows; j++)
+        {
+            values[j] = i * 1000.0 + j;
+        }
+        buffer.add_data (values);
+    }
+
+    auto result = buffer.get_current_data_by_channels (45, retrieved);
+    EXPECT_EQ (result, 45);
+    for (int j = 0; j < num_rows; j++)
+    {
+        for (int i = 0; i < 45; i++)
+        {
+            ASSERT_EQ (retrieved[j * 45 + i], (i + 25) * 1000.0 + j);
+        }
+    }
+
+    result = buffer.get_data_by_channels (50, retrieved);
+    EXPECT_EQ (result, 50);
+    for (int j = 0; j < num_rows; j++)
+    {
+        for (int i = 0; i < 50; i++)
+        {
+            ASSERT_EQ (retrieved[j * 50 + i], (i + 20) * 1000.0 + j);
+        }
+    }
+    EXPECT_EQ (buffer.get_data_count (), 0);
+}
+
+TEST (DataBufferTest, GetDataByChannelsSince_ReaderIsBehind_SkipLostData)
+{
+    DataBuffer buffer (2, 3);
+    double values[2];
+    double retrieved[6];
+    uint64_t position = 0;
+    uint64_t skipped = 0;
+
+    for (int i = 0; i < 5; i++)
+    {
+        values[0] = i;
+        values[1] = 10.0 + i;
+        buffer.add_data (values);
+    }
+
+    EXPECT_EQ (buffer.get_write_position (), 5);
+    EXPECT_EQ (buffer.get_overwritten_count (), 2);
+    EXPECT_EQ (buffer.get_data_count_since (position, &skipped), 3);
+    EXPECT_EQ (skipped, 2);
+    auto result = buffer.get_data_by_channels_since (&position, 2, retrieved, &skipped);
+    EXPECT_EQ (result, 2);
+    EXPECT_EQ (skipped, 2);
+    EXPECT_EQ (position, 4);
+    EXPECT_EQ (retrieved[0], 2.0);
+    EXPECT_EQ (retrieved[1], 3.0);
+    EXPECT_EQ (retrieved[2], 12.0);
+    EXPECT_EQ (retrieved[3], 13.0);
+    EXPECT_EQ (buffer.get_data_count (), 3);
+}
+
+TEST (DataBufferTest, GetDataByChannelsSince_DataRemovedByGetData_ReturnRemovedData)
+{
+    DataBuffer buffer (1, 4);
+    double values[6] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    double retrieved[4];
+    uint64_t position = 0;
+    uint64_t skipped = 0;
+
+    buffer.add_data (values, 3);
+    EXPECT_EQ (buffer.get_data (3, retrieved), 3);
+    EXPECT_EQ (buffer.get_data_count (), 0);
+    // cursors ignore get_data like in SPSCDataBuffer
+    EXPECT_EQ (buffer.get_data_count_since (position, &skipped), 3);
+    EXPECT_EQ (skipped, 0);
+    auto result = buffer.get_data_by_channels_since (&position, 4, retrieved, &skipped);
+    EXPECT_EQ (result, 3);
+    EXPECT_EQ (position, 3);
+    EXPECT_EQ (retrieved[0], 0.0);
+    EXPECT_EQ (retrieved[2], 2.0);
+
+    // batch larger than buffer, only the newest packages survive
+    buffer.add_data (values, 6);
+    EXPECT_EQ (buffer.get_write_position (), 9);
+    EXPECT_EQ (buffer.get_data_count_since (position, &skipped), 4);
+    EXPECT_EQ (skipped, 2);
+    result = buffer.get_data_by_channels_since (&position, 4, retrieved, &skipped);
+    EXPECT_EQ (result, 4);
+    EXPECT_EQ (position, 9);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (retrieved[i], values[i + 2]);
+    }
+    EXPECT_EQ (buffer.get_current_data (4, retrieved), 4);
+    EXPECT_EQ (retrieved[0], 2.0);
+    EXPECT_EQ (retrieved[3], 5.0);
+}
+
 TEST (DataBufferTest, IsReady_BufferCanFitInMemory_ReturnTrue)
 {
     DataBuffer buffer (4, 16);
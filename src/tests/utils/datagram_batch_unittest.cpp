@@ -0,0 +1,91 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <string.h>
+#include <thread>
+
+#include "datagram_batch.h"
+#include "socket_client_udp.h"
+#include "timestamp.h"
+
+using namespace testing;
+
+
+TEST (DatagramBatchTest, Add_AddMoreThanCapacity_RejectExtraDatagrams)
+{
+    DatagramBatch batch (2, 4);
+    char data[5] = {1, 2, 3, 4, 5};
+
+    EXPECT_FALSE (batch.add (data, 5));
+    EXPECT_TRUE (batch.add (data, 4));
+    EXPECT_TRUE (batch.add (data + 1, 2));
+    EXPECT_FALSE (batch.add (data, 1));
+
+    EXPECT_EQ (batch.get_count (), 2);
+    EXPECT_EQ (batch.get_size (0), 4);
+    EXPECT_EQ (batch.get_size (1), 2);
+    EXPECT_EQ (memcmp (batch.get_datagram (1), data + 1, 2), 0);
+    batch.clear ();
+    EXPECT_EQ (batch.get_count (), 0);
+}
+
+TEST (DatagramBatchTest, SendRecv_SendBatchOverLoopback_ReceiveAllDatagramsInOrder)
+{
+    int port = 17493;
+    SocketClientUDP receiver ("127.0.0.1", port);
+    SocketClientUDP sender ("127.0.0.1", port);
+    ASSERT_EQ (receiver.bind (), (int)SocketClientUDPReturnCodes::STATUS_OK);
+    ASSERT_EQ (receiver.set_timeout (1), (int)SocketClientUDPReturnCodes::STATUS_OK);
+    ASSERT_EQ (sender.connect (), (int)SocketClientUDPReturnCodes::STATUS_OK);
+
+    DatagramBatch out (8, 16);
+    for (int i = 0; i < 8; i++)
+    {
+        char data[16];
+        memset (data, i, sizeof (data));
+        out.add (data, i + 1);
+    }
+    EXPECT_EQ (sender.send_batch (out), 8);
+    EXPECT_EQ (out.get_count (), 0);
+
+    DatagramBatch in (4, 16);
+    int received = 0;
+    while (received < 8)
+    {
+        int res = receiver.recv_batch (in);
+        ASSERT_GT (res, 0);
+        ASSERT_LE (res, 4);
+        for (int i = 0; i < res; i++, received++)
+        {
+            EXPECT_EQ (in.get_size (i), received + 1);
+            EXPECT_EQ (in.get_datagram (i)[0], (char)received);
+        }
+    }
+    EXPECT_EQ (receiver.recv_batch (in), -1);
+}
+
+TEST (DatagramBatchTest, Recv_KernelTimestampsEnabled_ArrivalTimeIsNotDelayedByLateRecv)
+{
+    int port = 17494;
+    SocketClientUDP receiver ("127.0.0.1", port);
+    SocketClientUDP sender ("127.0.0.1", port);
+    ASSERT_EQ (receiver.bind (), (int)SocketClientUDPReturnCodes::STATUS_OK);
+    ASSERT_EQ (receiver.set_timeout (1), (int)SocketClientUDPReturnCodes::STATUS_OK);
+    ASSERT_EQ (sender.connect (), (int)SocketClientUDPReturnCodes::STATUS_OK);
+    if (receiver.enable_kernel_timestamps () != (int)SocketClientUDPReturnCodes::STATUS_OK)
+    {
+        GTEST_SKIP () << "kernel timestamps are not supported";
+    }
+    // linux enables timestamping of incoming packets asynchronously
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+
+    double send_time = get_timestamp ();
+    ASSERT_EQ (sender.send ("ping", 4), 4);
+    std::this_thread::sleep_for (std::chrono::milliseconds (200));
+    DatagramBatch in (4, 16);
+    ASSERT_EQ (receiver.recv_batch (in), 1);
+    double recv_time = get_timestamp ();
+
+    EXPECT_GE (in.get_arrival_time (0), send_time - 0.001);
+    EXPECT_LT (in.get_arrival_time (0), recv_time - 0.1);
+}
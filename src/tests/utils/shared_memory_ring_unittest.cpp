@@ -0,0 +1,95 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "shared_memory_ring.h"
+
+using namespace testing;
+
+
+static std::vector<double> make_samples (int first, int count, int num_rows)
+{
+    std::vector<double> samples ((size_t)count * num_rows);
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < num_rows; j++)
+        {
+            samples[(size_t)i * num_rows + j] = (first + i) * 10.0 + j;
+        }
+    }
+    return samples;
+}
+
+TEST (SharedMemoryRingTest, Open_NoWriter_Fail)
+{
+    SharedMemoryRing reader;
+    EXPECT_NE (reader.open ("bf_ut_missing"), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.open ("bad/name"), (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+}
+
+TEST (SharedMemoryRingTest, Read_WriteAcrossRingEnd_ReadSamplesInOrder)
+{
+    SharedMemoryRing writer;
+    SharedMemoryRing reader;
+    ASSERT_EQ (writer.create ("bf_ut_wrap", 3, 8, -1, 0), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (reader.open ("bf_ut_wrap"), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_rows (), 3);
+    EXPECT_EQ (reader.get_board_id (), -1);
+
+    std::vector<double> out (8 * 3);
+    uint64_t lost = 0;
+    EXPECT_EQ (reader.read (out.data (), 8, &lost), 0);
+    int next = 0;
+    for (int iter = 0; iter < 5; iter++)
+    {
+        std::vector<double> in = make_samples (next, 5, 3);
+        writer.write (in.data (), 5);
+        ASSERT_EQ (reader.read (out.data (), 3, &lost), 3);
+        ASSERT_EQ (reader.read (out.data () + 3 * 3, 8, &lost), 2);
+        for (size_t i = 0; i < in.size (); i++)
+        {
+            EXPECT_EQ (out[i], in[i]);
+        }
+        next += 5;
+    }
+    EXPECT_EQ (lost, 0);
+}
+
+TEST (SharedMemoryRingTest, Read_ReaderFallsBehind_CountLostSamples)
+{
+    SharedMemoryRing writer;
+    SharedMemoryRing reader;
+    ASSERT_EQ (writer.create ("bf_ut_lost", 2, 8, -1, 0), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (reader.open ("bf_ut_lost"), (int)BrainFlowExitCodes::STATUS_OK);
+
+    std::vector<double> in = make_samples (0, 20, 2);
+    writer.write (in.data (), 20);
+    std::vector<double> out (8 * 2);
+    uint64_t lost = 0;
+    ASSERT_EQ (reader.read (out.data (), 8, &lost), 8);
+    EXPECT_EQ (lost, 12);
+    EXPECT_EQ (out[0], 120.0);
+    EXPECT_EQ (out[15], 191.0);
+}
+
+TEST (SharedMemoryRingTest, IsReplaced_WriterRestarted_ReaderSeesNewSegment)
+{
+    SharedMemoryRing writer;
+    SharedMemoryRing reader;
+    ASSERT_EQ (writer.create ("bf_ut_restart", 2, 8, -1, 0), (int)BrainFlowExitCodes::STATUS_OK);
+    ASSERT_EQ (reader.open ("bf_ut_restart"), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_FALSE (reader.is_replaced ());
+
+    SharedMemoryRing new_writer;
+    ASSERT_EQ (
+        new_writer.create ("bf_ut_restart", 4, 8, -1, 0), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_TRUE (reader.is_replaced ());
+    ASSERT_EQ (reader.open ("bf_ut_restart"), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (reader.get_num_rows (), 4);
+    EXPECT_FALSE (reader.is_replaced ());
+    // old writer must not remove segment of the new one
+    writer.close ();
+    SharedMemoryRing other_reader;
+    EXPECT_EQ (other_reader.open ("bf_ut_restart"), (int)BrainFlowExitCodes::STATUS_OK);
+}
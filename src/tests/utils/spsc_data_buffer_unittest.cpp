@@ -0,0 +1,395 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <thread>
+
+#include "spsc_data_buffer.h"
+
+using namespace testing;
+
+
+TEST (SPSCDataBufferTest, AddData_AddLessDataThanBufferCapacity_StoreAllData)
+{
+    SPSCDataBuffer buffer (4, 2);
+    double values[4] = {1.0, 2.0, 3.0, 4.0};
+    double retrieved[4];
+
+    buffer.add_data (values);
+    buffer.get_current_data (1, retrieved);
+
+    EXPECT_EQ (buffer.get_data_count (), 1);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (retrieved[i], values[i]);
+    }
+}
+
+TEST (SPSCDataBufferTest, AddData_AddMoreDataThanBufferCapacity_OverwriteOldestData)
+{
+    SPSCDataBuffer buffer (4, 2);
+    double first_values[4] = {1.0, 2.0, 3.0, 4.0};
+    double second_values[4] = {5.0, 6.0, 7.0, 8.0};
+    double third_values[4] = {9.0, 10.0, 11.0, 12.0};
+    double retrieved[8];
+
+    buffer.add_data (first_values);
+    buffer.add_data (second_values);
+    buffer.add_data (third_values);
+
+    EXPECT_EQ (buffer.get_data_count (), 2);
+
+    auto result = buffer.get_data (2, retrieved);
+
+    EXPECT_EQ (result, 2);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (retrieved[i], second_values[i]);
+        EXPECT_EQ (retrieved[i + 4], third_values[i]);
+    }
+    EXPECT_EQ (buffer.get_data_count (), 0);
+}
+
+TEST (SPSCDataBufferTest, AddData_BufferIsNotReady_DoNothing)
+{
+    SPSCDataBuffer buffer_zero (4, 0);
+    double values[4] = {1.0, 2.0, 3.0, 4.0};
+    double retrieved[4] = {0.0, 0.0, 0.0, 0.0};
+
+    buffer_zero.add_data (values);
+
+    EXPECT_EQ (buffer_zero.get_data_count (), 0);
+    EXPECT_EQ (buffer_zero.get_current_data (1, retrieved), 0);
+    EXPECT_EQ (buffer_zero.get_data (1, retrieved), 0);
+}
+
+TEST (SPSCDataBufferTest, GetData_CalledMultipleTimes_ReturnEachValueSetOnceStartingWithOldest)
+{
+    SPSCDataBuffer buffer (4, 16);
+    double retrieved[4];
+
+    for (int i = 0; i < 10; i++)
+    {
+        double values[4] = {(double)i, (double)i, (double)i, (double)i};
+        buffer.add_data (values);
+        if (i % 2 == 1)
+        {
+            EXPECT_EQ (buffer.get_data (1, retrieved), 1);
+            EXPECT_EQ (retrieved[0], (double)((i - 1) / 2));
+        }
+    }
+}
+
+TEST (SPSCDataBufferTest, GetCurrentData_MaxCountLessThanAvailableCount_ReturnMostRecentValues)
+{
+    SPSCDataBuffer buffer (4, 4);
+    double retrieved[8];
+
+    for (int i = 0; i < 6; i++)
+    {
+        double values[4] = {(double)i, (double)i, (double)i, (double)i};
+        buffer.add_data (values);
+    }
+
+    auto result = buffer.get_current_data (2, retrieved);
+
+    EXPECT_EQ (result, 2);
+    EXPECT_EQ (retrieved[0], 4.0);
+    EXPECT_EQ (retrieved[4], 5.0);
+    EXPECT_EQ (buffer.get_data_count (), 4);
+}
+
+TEST (SPSCDataBufferTest, GetData_ProducerAndConsumerInDifferentThreads_DataIsOrderedAndNotMixed)
+{
+    const int num_packages = 200000;
+    SPSCDataBuffer buffer (4, 64);
+
+    std::thread producer ([&] () {
+        for (int i = 0; i < num_packages; i++)
+        {
+            double values[4] = {(double)i, (double)i, (double)i, (double)i};
+            buffer.add_data (values);
+        }
+    });
+
+    double retrieved[4 * 16];
+    double last = -1.0;
+    bool is_mixed = false;
+    bool is_ordered = true;
+    while (last < num_packages - 1)
+    {
+        size_t count = buffer.get_data (16, retrieved);
+        for (size_t i = 0; i < count; i++)
+        {
+            for (int j = 1; j < 4; j++)
+            {
+                if (retrieved[i * 4 + j] != retrieved[i * 4])
+                {
+                    is_mixed = true;
+                }
+            }
+            if (retrieved[i * 4] <= last)
+            {
+                is_ordered = false;
+            }
+            last = retrieved[i * 4];
+        }
+    }
+    producer.join ();
+
+    EXPECT_FALSE (is_mixed);
+    EXPECT_TRUE (is_ordered);
+}
+
+TEST (SPSCDataBufferTest, GetDataByChannels_SampleMajorLayout_ReturnChannelMajorData)
+{
+    SPSCDataBuffer buffer (3, 4);
+    double retrieved[9];
+
+    for (int i = 0; i < 5; i++)
+    {
+        double values[3] = {(double)i, 10.0 + i, 20.0 + i};
+        buffer.add_data (values);
+    }
+
+    auto result = buffer.get_data_by_channels (3, retrieved);
+
+    EXPECT_EQ (result, 3);
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ (retrieved[i], (double)(i + 1));
+        EXPECT_EQ (retrieved[3 + i], 10.0 + i + 1);
+        EXPECT_EQ (retrieved[6 + i], 20.0 + i + 1);
+    }
+    EXPECT_EQ (buffer.get_data_count (), 1);
+}
+
+TEST (SPSCDataBufferTest, GetDataByChannels_ChannelMajorLayoutWithWraparound_ReturnChannelMajorData)
+{
+    SPSCDataBuffer buffer (3, 4, DataBufferLayout::CHANNEL_MAJOR);
+    double retrieved[12];
+
+    for (int i = 0; i < 7; i++)
+    {
+        double values[3] = {(double)i, 10.0 + i, 20.0 + i};
+        buffer.add_data (values);
+    }
+
+    auto result = buffer.get_current_data_by_channels (4, retrieved);
+
+    EXPECT_EQ (result, 4);
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ (retrieved[i], (double)(i + 3));
+        EXPECT_EQ (retrieved[4 + i], 10.0 + i + 3);
+        EXPECT_EQ (retrieved[8 + i], 20.0 + i + 3);
+    }
+
+    result = buffer.get_data (2, retrieved);
+
+    EXPECT_EQ (result, 2);
+    EXPECT_EQ (retrieved[0], 3.0);
+    EXPECT_EQ (retrieved[1], 13.0);
+    EXPECT_EQ (retrieved[2], 23.0);
+    EXPECT_EQ (retrieved[3], 4.0);
+    EXPECT_EQ (buffer.get_data_count (), 2);
+}
+
+TEST (SPSCDataBufferTest, AddDataBatch_BatchWrapsAroundAndExceedsCapacity_StoreNewestData)
+{
+    SPSCDataBuffer sample_major (2, 4);
+    SPSCDataBuffer channel_major (2, 4, DataBufferLayout::CHANNEL_MAJOR);
+    double values[12];
+    for (int i = 0; i < 6; i++)
+    {
+        values[2 * i] = (double)i;
+        values[2 * i + 1] = 10.0 + i;
+    }
+    double retrieved[8];
+
+    for (SPSCDataBuffer *buffer : {&sample_major, &channel_major})
+    {
+        buffer->add_data (values, 3);
+        buffer->add_data (values + 6, 3);
+        EXPECT_EQ (buffer->get_data_count (), 4);
+        auto result = buffer->get_data_by_channels (4, retrieved);
+        EXPECT_EQ (result, 4);
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ (retrieved[i], (double)(i + 2));
+            EXPECT_EQ (retrieved[4 + i], 10.0 + i + 2);
+        }
+
+        buffer->add_data (values, 6);
+        EXPECT_EQ (buffer->get_data_count (), 4);
+        result = buffer->get_data (4, retrieved);
+        EXPECT_EQ (result, 4);
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ (retrieved[2 * i], (double)(i + 2));
+            EXPECT_EQ (retrieved[2 * i + 1], 10.0 + i + 2);
+        }
+    }
+}
+
+TEST (SPSCDataBufferTest, IsReady_BufferCannotFitInMemory_ReturnFalse)
+{
+    SPSCDataBuffer buffer (INT_MAX, SIZE_MAX);
+    EXPECT_EQ (buffer.is_ready (), false);
+}
+
+TEST (SPSCDataBufferTest, AddData_ChunkedStorage_CommitsChunksOnlyForWrittenData)
+{
+    // 10 slots in 4 chunks of 3 packages, batches cross chunk borders and ring end
+    std::vector<ChannelStorage> storage;
+    SPSCDataBuffer sample_major (
+        2, 9, DataBufferLayout::SAMPLE_MAJOR, DataBufferMemory::HEAP, storage, 3);
+    SPSCDataBuffer channel_major (
+        2, 9, DataBufferLayout::CHANNEL_MAJOR, DataBufferMemory::HUGEPAGES, storage, 3);
+    double values[16];
+    for (int i = 0; i < 8; i++)
+    {
+        values[2 * i] = (double)i;
+        values[2 * i + 1] = 10.0 + i;
+    }
+    double retrieved[18];
+
+    for (SPSCDataBuffer *buffer : {&sample_major, &channel_major})
+    {
+        EXPECT_EQ (buffer->is_ready (), true);
+        EXPECT_EQ (buffer->get_committed_bytes (), 0);
+        buffer->add_data (values, 4);
+        EXPECT_EQ (buffer->get_committed_bytes (), 2 * 3 * 2 * sizeof (double));
+
+        buffer->add_data (values, 8);
+        EXPECT_EQ (buffer->get_committed_bytes (), 4 * 3 * 2 * sizeof (double));
+        EXPECT_EQ (buffer->get_data_count (), 9);
+        auto result = buffer->get_data_by_channels (9, retrieved);
+        EXPECT_EQ (result, 9);
+        EXPECT_EQ (retrieved[0], 3.0);
+        EXPECT_EQ (retrieved[9], 13.0);
+        for (int i = 1; i < 9; i++)
+        {
+            EXPECT_EQ (retrieved[i], (double)(i - 1));
+            EXPECT_EQ (retrieved[9 + i], 10.0 + i - 1);
+        }
+
+        buffer->add_data (values, 5);
+        result = buffer->get_current_data (3, retrieved);
+        EXPECT_EQ (result, 3);
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ (retrieved[2 * i], (double)(i + 2));
+            EXPECT_EQ (retrieved[2 * i + 1], 10.0 + i + 2);
+        }
+    }
+}
+
+TEST (SPSCDataBufferTest, GetData_CompactStorage_ConvertValuesOnRead)
+{
+    // timestamp like value needs double, others fit into float and scaled int32
+    std::vector<ChannelStorage> storage = {ChannelStorage (DataBufferStorage::INT32, 0.5),
+        ChannelStorage (DataBufferStorage::FLOAT64), ChannelStorage (DataBufferStorage::FLOAT32)};
+    SPSCDataBuffer sample_major (
+        3, 4, DataBufferLayout::SAMPLE_MAJOR, DataBufferMemory::HEAP, storage, 3);
+    SPSCDataBuffer channel_major (
+        3, 4, DataBufferLayout::CHANNEL_MAJOR, DataBufferMemory::HEAP, storage, 3);
+    double values[18];
+    for (int i = 0; i < 6; i++)
+    {
+        values[3 * i] = 1.5 * i;
+        values[3 * i + 1] = 1700000000.123 + i;
+        values[3 * i + 2] = 0.25 * i;
+    }
+    values[3] = std::nan ("");
+    double retrieved[12];
+
+    for (SPSCDataBuffer *buffer : {&sample_major, &channel_major})
+    {
+        EXPECT_EQ (buffer->get_committed_bytes (), 0);
+        buffer->add_data (values, 6);
+        // 2 chunks of 3 slots with 16 bytes per slot
+        EXPECT_EQ (buffer->get_committed_bytes (), 2 * 3 * 16);
+        auto result = buffer->get_current_data_by_channels (4, retrieved);
+        EXPECT_EQ (result, 4);
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ (retrieved[i], 1.5 * (i + 2));
+            EXPECT_EQ (retrieved[4 + i], 1700000000.123 + i + 2);
+            EXPECT_EQ (retrieved[8 + i], 0.25 * (i + 2));
+        }
+
+        buffer->add_data (values, 2);
+        result = buffer->get_data (4, retrieved);
+        EXPECT_EQ (result, 4);
+        EXPECT_EQ (retrieved[0], 1.5 * 4);
+        EXPECT_EQ (retrieved[1], 1700000000.123 + 4);
+        EXPECT_EQ (retrieved[2], 0.25 * 4);
+        EXPECT_EQ (retrieved[6], 0.0);
+        EXPECT_TRUE (std::isnan (retrieved[9]));
+        EXPECT_EQ (retrieved[10], 1700000000.123 + 1);
+    }
+}
+
+TEST (SPSCDataBufferTest, GetDataByChannelsSince_SeveralReaders_EachReaderGetsAllDataOnce)
+{
+    SPSCDataBuffer buffer (2, 4);
+    double values[12];
+    for (int i = 0; i < 6; i++)
+    {
+        values[2 * i] = i;
+        values[2 * i + 1] = 100.0 + i;
+    }
+    double retrieved[8];
+    uint64_t fast_reader = 0;
+    uint64_t slow_reader = 0;
+    uint64_t skipped = 0;
+
+    buffer.add_data (values, 3);
+    // destructive read does not affect cursors
+    buffer.get_data (3, retrieved);
+    auto result = buffer.get_data_by_channels_since (&fast_reader, 2, retrieved, &skipped);
+    EXPECT_EQ (result, 2);
+    EXPECT_EQ (skipped, 0);
+    EXPECT_EQ (fast_reader, 2);
+    EXPECT_EQ (retrieved[0], 0.0);
+    EXPECT_EQ (retrieved[1], 1.0);
+    EXPECT_EQ (retrieved[2], 100.0);
+    EXPECT_EQ (retrieved[3], 101.0);
+    EXPECT_EQ (buffer.get_data_count_since (fast_reader, &skipped), 1);
+
+    buffer.add_data (values + 6, 3);
+    result = buffer.get_data_by_channels_since (&fast_reader, 10, retrieved, &skipped);
+    EXPECT_EQ (result, 4);
+    EXPECT_EQ (skipped, 0);
+    EXPECT_EQ (retrieved[0], 2.0);
+    EXPECT_EQ (retrieved[7], 105.0);
+    EXPECT_EQ (buffer.get_data_count_since (fast_reader, &skipped), 0);
+
+    // slow reader lost 2 oldest packages, the rest is still there
+    EXPECT_EQ (buffer.get_data_count_since (slow_reader, &skipped), 4);
+    EXPECT_EQ (skipped, 2);
+    result = buffer.get_data_by_channels_since (&slow_reader, 10, retrieved, &skipped);
+    EXPECT_EQ (result, 4);
+    EXPECT_EQ (skipped, 2);
+    EXPECT_EQ (slow_reader, buffer.get_write_position ());
+    EXPECT_EQ (retrieved[0], 2.0);
+    EXPECT_EQ (retrieved[4], 102.0);
+}
+
+TEST (SPSCDataBufferTest, GetOverwrittenCount_ConsumerIsSlow_CountOnlyNotRemovedPackages)
+{
+    SPSCDataBuffer buffer (1, 4);
+    double values[10] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+    double retrieved[4];
+
+    buffer.add_data (values, 3);
+    buffer.get_data (2, retrieved);
+    buffer.add_data (values, 4);
+    EXPECT_EQ (buffer.get_overwritten_count (), 1);
+    buffer.add_data (values, 1);
+    EXPECT_EQ (buffer.get_overwritten_count (), 2);
+    buffer.add_data (values, 10);
+    EXPECT_EQ (buffer.get_overwritten_count (), 12);
+    // every package is either removed, overwritten or still in buffer
+    EXPECT_EQ (buffer.get_write_position (), 2 + buffer.get_overwritten_count () + 4);
+    EXPECT_EQ (buffer.get_data_count (), 4);
+}
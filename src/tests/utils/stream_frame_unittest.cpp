@@ -0,0 +1,144 @@
+#include <gmock/gmock-matchers.h>
+#include <gmock/gmock.h>
+#include <limits>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+#include "brainflow_constants.h"
+#include "stream_frame.h"
+
+using namespace testing;
+
+
+// package num, eeg in uV, timestamp
+static std::vector<double> make_samples (int num_samples)
+{
+    std::vector<double> samples;
+    for (int i = 0; i < num_samples; i++)
+    {
+        samples.push_back ((double)(i % 256));
+        samples.push_back (100.0 * sin (i * 0.3) + 0.123456789);
+        samples.push_back (1700000000.0 + i * 0.004);
+    }
+    return samples;
+}
+
+static int decode (const std::vector<char> &frame, StreamFrameHeader &header, double *samples)
+{
+    int res = stream_frame_decode_header (frame.data (), frame.size (), header);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        return res;
+    }
+    return stream_frame_decode (frame.data (), frame.size (), header, samples);
+}
+
+TEST (StreamFrameTest, Decode_Float64Frame_ReturnSameHeaderAndExactValues)
+{
+    std::vector<double> samples = make_samples (10);
+    StreamFrameHeader header;
+    header.num_rows = 3;
+    header.num_samples = 10;
+    header.preset = 2;
+    header.sequence = 12345;
+    header.send_timestamp = 1700000000.5;
+    std::vector<char> frame;
+    stream_frame_encode (header, samples.data (), frame);
+    StreamFrameHeader decoded_header;
+    std::vector<double> decoded (samples.size ());
+
+    ASSERT_EQ (decode (frame, decoded_header, decoded.data ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_EQ (frame.size (), stream_frame_size (StreamFrameEncodings::FLOAT64, 3, 10));
+    EXPECT_EQ (decoded_header.preset, 2);
+    EXPECT_EQ (decoded_header.sequence, 12345u);
+    EXPECT_EQ (decoded_header.num_samples, 10);
+    EXPECT_EQ (decoded_header.send_timestamp, 1700000000.5);
+    EXPECT_EQ (memcmp (decoded.data (), samples.data (), samples.size () * sizeof (double)), 0);
+}
+
+TEST (StreamFrameTest, Decode_Int24Frame_ReturnExactIntegersAndCloseValues)
+{
+    std::vector<double> samples = make_samples (20);
+    samples[4] = std::numeric_limits<double>::quiet_NaN ();
+    StreamFrameHeader header;
+    header.encoding = StreamFrameEncodings::INT24;
+    header.num_rows = 3;
+    header.num_samples = 20;
+    std::vector<char> frame;
+    stream_frame_encode (header, samples.data (), frame);
+    StreamFrameHeader decoded_header;
+    std::vector<double> decoded (samples.size ());
+
+    ASSERT_EQ (decode (frame, decoded_header, decoded.data ()), (int)BrainFlowExitCodes::STATUS_OK);
+    EXPECT_LT (frame.size (), stream_frame_size (StreamFrameEncodings::FLOAT64, 3, 20) * 6 / 10);
+    EXPECT_TRUE (std::isnan (decoded[4]));
+    for (int i = 0; i < 20; i++)
+    {
+        EXPECT_EQ (decoded[i * 3], samples[i * 3]);
+        if (i != 1)
+        {
+            EXPECT_NEAR (decoded[i * 3 + 1], samples[i * 3 + 1], 1e-4);
+        }
+        EXPECT_NEAR (decoded[i * 3 + 2], samples[i * 3 + 2], 1e-6);
+    }
+}
+
+TEST (StreamFrameTest, DecodeHeader_FrameIsTruncatedOrRaw_ReturnError)
+{
+    std::vector<double> samples = make_samples (5);
+    StreamFrameHeader header;
+    header.encoding = StreamFrameEncodings::FLOAT32;
+    header.num_rows = 3;
+    header.num_samples = 5;
+    std::vector<char> frame;
+    stream_frame_encode (header, samples.data (), frame);
+    StreamFrameHeader decoded_header;
+
+    EXPECT_EQ (stream_frame_decode_header (frame.data (), frame.size () - 1, decoded_header),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+    size_t raw_size = samples.size () * sizeof (double);
+    EXPECT_EQ (
+        stream_frame_decode_header ((const char *)samples.data (), raw_size, decoded_header),
+        (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR);
+}
+
+TEST (StreamFrameTest, MaxSamples_SmallMtu_FrameFitsIntoMtu)
+{
+    int max_samples = stream_frame_max_samples (StreamFrameEncodings::FLOAT64, 32, 1472);
+
+    EXPECT_EQ (max_samples, 5);
+    EXPECT_LE (stream_frame_size (StreamFrameEncodings::FLOAT64, 32, max_samples), 1472u);
+    EXPECT_GT (stream_frame_size (StreamFrameEncodings::FLOAT64, 32, max_samples + 1), 1472u);
+    EXPECT_EQ (stream_frame_max_samples (StreamFrameEncodings::FLOAT64, 1000, 1472), 1);
+}
+
+TEST (StreamFrameSequenceTest, Check_FramesAreLostAndReordered_CountGapsAndLateFrames)
+{
+    StreamFrameSequence sequence;
+
+    EXPECT_TRUE (sequence.check (10000));
+    EXPECT_TRUE (sequence.check (10001));
+    EXPECT_TRUE (sequence.check (10004)); // 10002 and 10003 are missing
+    EXPECT_FALSE (sequence.check (10002)); // late
+    EXPECT_TRUE (sequence.check (10005));
+    EXPECT_EQ (sequence.received, 5u);
+    EXPECT_EQ (sequence.gaps, 1u);
+    EXPECT_EQ (sequence.lost, 1u);
+    EXPECT_EQ (sequence.out_of_order, 1u);
+    // sender restart
+    EXPECT_TRUE (sequence.check (0));
+    EXPECT_EQ (sequence.restarts, 1u);
+    EXPECT_TRUE (sequence.check (1));
+    EXPECT_EQ (sequence.gaps, 1u);
+}
+
+TEST (StreamFrameSequenceTest, Check_SequenceWrapsAround_NoGaps)
+{
+    StreamFrameSequence sequence;
+
+    EXPECT_TRUE (sequence.check (0xFFFFFFFF));
+    EXPECT_TRUE (sequence.check (0));
+    EXPECT_EQ (sequence.gaps, 0u);
+    EXPECT_EQ (sequence.restarts, 0u);
+}
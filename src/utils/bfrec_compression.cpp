@@ -0,0 +1,576 @@
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+#include "bfrec_compression.h"
+#include "bfrec_format.h"
+#include "brainflow_constants.h"
+
+#define MAX_PREDICTOR_ORDER 2
+#define MAX_RICE_PARAMETER 40
+#define RICE_ESCAPE 32 // unary part of this length is followed by raw 64 bit value
+#define MAX_INTEGER_VALUE (1LL << 40)
+
+
+class BitWriter
+{
+    std::vector<char> &out;
+    uint64_t acc;
+    int bits;
+
+public:
+    explicit BitWriter (std::vector<char> &out) : out (out), acc (0), bits (0)
+    {
+    }
+
+    // count <= 32
+    void put (uint64_t value, int count)
+    {
+        acc = (acc << count) | (value & ((1ULL << count) - 1));
+        bits += count;
+        while (bits >= 8)
+        {
+            out.push_back ((char)((acc >> (bits - 8)) & 0xFF));
+            bits -= 8;
+        }
+        acc &= (1ULL << bits) - 1;
+    }
+
+    void put_long (uint64_t value, int count)
+    {
+        if (count > 32)
+        {
+            put (value >> 32, count - 32);
+            count = 32;
+        }
+        put (value, count);
+    }
+
+    void flush ()
+    {
+        if (bits > 0)
+        {
+            put (0, 8 - bits);
+        }
+    }
+};
+
+class BitReader
+{
+    const unsigned char *data;
+    size_t size;
+    size_t pos;
+    uint64_t acc;
+    int bits;
+
+public:
+    BitReader (const char *data, size_t size)
+        : data ((const unsigned char *)data), size (size), pos (0), acc (0), bits (0)
+    {
+    }
+
+    // count <= 32, returns false if there is not enough data
+    bool get (int count, uint64_t &value)
+    {
+        while (bits < count)
+        {
+            if (pos >= size)
+            {
+                return false;
+            }
+            acc = (acc << 8) | data[pos++];
+            bits += 8;
+        }
+        value = (acc >> (bits - count)) & ((1ULL << count) - 1);
+        bits -= count;
+        acc &= (1ULL << bits) - 1;
+        return true;
+    }
+
+    bool get_long (int count, uint64_t &value)
+    {
+        uint64_t high = 0;
+        if (count > 32)
+        {
+            if (!get (count - 32, high))
+            {
+                return false;
+            }
+            count = 32;
+        }
+        uint64_t low = 0;
+        if (!get (count, low))
+        {
+            return false;
+        }
+        value = (high << count) | low;
+        return true;
+    }
+};
+
+// byte level reader with bounds checks for decoder
+struct ByteReader
+{
+    const char *data;
+    size_t size;
+    size_t pos;
+
+    bool get_bytes (void *dst, size_t len)
+    {
+        if (size - pos < len)
+        {
+            return false;
+        }
+        memcpy (dst, data + pos, len);
+        pos += len;
+        return true;
+    }
+
+    bool get_varint (uint64_t &value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            unsigned char byte = 0;
+            if (!get_bytes (&byte, 1))
+            {
+                return false;
+            }
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool get_double (double &value)
+    {
+        char bytes[sizeof (double)];
+        if (!get_bytes (bytes, sizeof (bytes)))
+        {
+            return false;
+        }
+        bfrec_decode (bytes, 1, &value);
+        return true;
+    }
+};
+
+static void put_varint (std::vector<char> &out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back ((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back ((char)value);
+}
+
+static void put_double (std::vector<char> &out, double value)
+{
+    char bytes[sizeof (double)];
+    bfrec_encode (&value, 1, bytes);
+    out.insert (out.end (), bytes, bytes + sizeof (bytes));
+}
+
+static inline uint64_t to_bits (double value)
+{
+    uint64_t bits;
+    memcpy (&bits, &value, sizeof (bits));
+    return bits;
+}
+
+static inline double from_bits (uint64_t bits)
+{
+    double value;
+    memcpy (&value, &bits, sizeof (value));
+    return value;
+}
+
+static inline uint64_t zigzag (int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t unzigzag (uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+// inlined rounding, libm calls dominate encoding time otherwise. Values near .5 may be rounded
+// in a wrong direction, it only fails the exact check below
+static inline double fast_round (double value)
+{
+    return (double)(int64_t)(value + ((value >= 0.0) ? 0.5 : -0.5));
+}
+
+// n[i] = round (column[i] / quantum), true if n[i] * quantum restores every value bitwise
+static bool check_quantum (const std::vector<double> &column, double quantum, int64_t *values)
+{
+    for (size_t i = 0; i < column.size (); i++)
+    {
+        double ratio = column[i] / quantum;
+        if (!(fabs (ratio) <= (double)MAX_INTEGER_VALUE)) // nan as well
+        {
+            return false;
+        }
+        values[i] = (int64_t)fast_round (ratio);
+        if (to_bits ((double)values[i] * quantum) != to_bits (column[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// euclid algorithm for doubles, remainders close to zero or to divisor are treated as zero
+static double approx_gcd (double a, double b, double tolerance)
+{
+    if (a < b)
+    {
+        double tmp = a;
+        a = b;
+        b = tmp;
+    }
+    for (int i = 0; (i < 64) && (b > tolerance); i++)
+    {
+        // fmod is slow for large quotients, a / b is below 1 / 1e-9 here
+        double r = a - (double)(int64_t)(a / b) * b;
+        if ((r <= tolerance) || (b - r <= tolerance))
+        {
+            return b;
+        }
+        a = b;
+        b = r;
+    }
+    return 0.0;
+}
+
+// values of adc based channels are raw codes multiplied by scale factor, quantum is estimated as
+// approximate gcd of differences and refined using the largest value, candidates are checked
+// exactly so wrong estimation only means that channel is stored in xor mode
+static bool find_quantum (const std::vector<double> &column, double &quantum, int64_t *values)
+{
+    double max_abs = 0.0;
+    for (size_t i = 0; i < column.size (); i++)
+    {
+        if (!std::isfinite (column[i]))
+        {
+            return false;
+        }
+        max_abs = std::max (max_abs, fabs (column[i]));
+    }
+    if (check_quantum (column, 1.0, values))
+    {
+        quantum = 1.0;
+        return true;
+    }
+    double tolerance = max_abs * 1e-9;
+    double gcd = fabs (column[0]);
+    for (size_t i = 1; i < column.size (); i++)
+    {
+        double diff = fabs (column[i] - column[i - 1]);
+        if (diff <= tolerance)
+        {
+            continue;
+        }
+        gcd = (gcd <= tolerance) ? diff : approx_gcd (gcd, diff, tolerance);
+        if (gcd <= tolerance)
+        {
+            return false;
+        }
+    }
+    if (gcd <= tolerance)
+    {
+        return false;
+    }
+    size_t largest = 0;
+    for (size_t i = 1; i < column.size (); i++)
+    {
+        if (fabs (column[i]) > fabs (column[largest]))
+        {
+            largest = i;
+        }
+    }
+    double ratio = column[largest] / gcd;
+    if (!(fabs (ratio) <= (double)MAX_INTEGER_VALUE))
+    {
+        return false;
+    }
+    double n = fast_round (ratio);
+    if (n == 0.0)
+    {
+        return false;
+    }
+    // exact quantum is within couple ulps of this estimation
+    double candidate = column[largest] / n;
+    double candidates[5] = {candidate, nextafter (candidate, 0.0),
+        nextafter (candidate, 2 * candidate), 0.0, 0.0};
+    candidates[3] = nextafter (candidates[1], 0.0);
+    candidates[4] = nextafter (candidates[2], 2 * candidate);
+    for (int i = 0; i < 5; i++)
+    {
+        if (check_quantum (column, candidates[i], values))
+        {
+            quantum = candidates[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline int64_t predict (const int64_t *values, int i, int order)
+{
+    switch (order)
+    {
+        case 0:
+            return 0;
+        case 1:
+            return values[i - 1];
+        default:
+            return 2 * values[i - 1] - values[i - 2];
+    }
+}
+
+static void compress_integer_channel (
+    const int64_t *values, int num_samples, double quantum, std::vector<char> &out)
+{
+    // pick fixed predictor with the smallest residuals
+    int order = 0;
+    uint64_t best_sum = 0;
+    for (int cur_order = 0; cur_order <= MAX_PREDICTOR_ORDER; cur_order++)
+    {
+        uint64_t sum = 0;
+        for (int i = cur_order; i < num_samples; i++)
+        {
+            sum += zigzag (values[i] - predict (values, i, cur_order));
+        }
+        if ((cur_order == 0) || (sum < best_sum))
+        {
+            best_sum = sum;
+            order = cur_order;
+        }
+    }
+    order = std::min (order, num_samples);
+    int num_residuals = num_samples - order;
+    // rice parameter from mean residual, neighbours are checked exactly
+    int estimation = 0;
+    if (num_residuals > 0)
+    {
+        uint64_t mean = best_sum / num_residuals;
+        while ((estimation < MAX_RICE_PARAMETER) && ((mean >> estimation) > 1))
+        {
+            estimation++;
+        }
+    }
+    int k = 0;
+    uint64_t best_bits = 0;
+    for (int cur_k = std::max (0, estimation - 2);
+         cur_k <= std::min (MAX_RICE_PARAMETER, estimation + 2); cur_k++)
+    {
+        uint64_t bits = 0;
+        for (int i = order; i < num_samples; i++)
+        {
+            uint64_t quotient = zigzag (values[i] - predict (values, i, order)) >> cur_k;
+            bits += (quotient < RICE_ESCAPE) ? quotient + 1 + cur_k : RICE_ESCAPE + 64;
+        }
+        if ((best_bits == 0) || (bits < best_bits))
+        {
+            best_bits = bits;
+            k = cur_k;
+        }
+    }
+
+    put_double (out, quantum);
+    out.push_back ((char)order);
+    out.push_back ((char)k);
+    for (int i = 0; i < order; i++)
+    {
+        put_varint (out, zigzag (values[i]));
+    }
+    BitWriter writer (out);
+    for (int i = order; i < num_samples; i++)
+    {
+        uint64_t residual = zigzag (values[i] - predict (values, i, order));
+        uint64_t quotient = residual >> k;
+        if (quotient < RICE_ESCAPE)
+        {
+            writer.put (((1ULL << quotient) - 1) << 1, (int)quotient + 1);
+            writer.put_long (residual, k);
+        }
+        else
+        {
+            writer.put ((1ULL << RICE_ESCAPE) - 1, RICE_ESCAPE);
+            writer.put_long (residual, 64);
+        }
+    }
+    writer.flush ();
+}
+
+static bool decompress_integer_channel (
+    ByteReader &reader, int num_samples, int num_rows, int channel, double *samples)
+{
+    double quantum = 0.0;
+    unsigned char order = 0;
+    unsigned char k = 0;
+    if ((!reader.get_double (quantum)) || (!reader.get_bytes (&order, 1)) ||
+        (!reader.get_bytes (&k, 1)) || (order > MAX_PREDICTOR_ORDER) ||
+        (k > MAX_RICE_PARAMETER) || (order > num_samples))
+    {
+        return false;
+    }
+    std::vector<int64_t> values (num_samples);
+    for (int i = 0; i < order; i++)
+    {
+        uint64_t value = 0;
+        if (!reader.get_varint (value))
+        {
+            return false;
+        }
+        values[i] = unzigzag (value);
+    }
+    BitReader bits (reader.data + reader.pos, reader.size - reader.pos);
+    size_t used_bits = 0;
+    for (int i = order; i < num_samples; i++)
+    {
+        uint64_t quotient = 0;
+        uint64_t bit = 1;
+        while ((quotient < RICE_ESCAPE) && (bit == 1))
+        {
+            if (!bits.get (1, bit))
+            {
+                return false;
+            }
+            quotient += bit;
+        }
+        uint64_t residual = 0;
+        if (quotient == RICE_ESCAPE)
+        {
+            if (!bits.get_long (64, residual))
+            {
+                return false;
+            }
+            used_bits += RICE_ESCAPE + 64;
+        }
+        else
+        {
+            uint64_t remainder = 0;
+            if (!bits.get_long (k, remainder))
+            {
+                return false;
+            }
+            residual = (quotient << k) | remainder;
+            used_bits += quotient + 1 + k;
+        }
+        values[i] = unzigzag (residual) + predict (values.data (), i, order);
+    }
+    reader.pos += (used_bits + 7) / 8;
+    for (int i = 0; i < num_samples; i++)
+    {
+        samples[i * num_rows + channel] = (double)values[i] * quantum;
+    }
+    return true;
+}
+
+void bfrec_compress_block (
+    const double *samples, int num_samples, int num_rows, std::vector<char> &out)
+{
+    std::vector<double> column (num_samples);
+    std::vector<int64_t> values (num_samples);
+    for (int channel = 0; channel < num_rows; channel++)
+    {
+        bool is_constant = true;
+        for (int i = 0; i < num_samples; i++)
+        {
+            column[i] = samples[i * num_rows + channel];
+            is_constant = is_constant && (to_bits (column[i]) == to_bits (column[0]));
+        }
+        double quantum = 0.0;
+        if (is_constant)
+        {
+            out.push_back ((char)BFRecChannelModes::CONSTANT);
+            put_double (out, column[0]);
+        }
+        else if (find_quantum (column, quantum, values.data ()))
+        {
+            out.push_back ((char)BFRecChannelModes::INTEGER);
+            compress_integer_channel (values.data (), num_samples, quantum, out);
+        }
+        else
+        {
+            size_t start = out.size ();
+            out.push_back ((char)BFRecChannelModes::XOR);
+            uint64_t prev = 0;
+            for (int i = 0; i < num_samples; i++)
+            {
+                uint64_t cur = to_bits (column[i]);
+                put_varint (out, cur ^ prev);
+                prev = cur;
+            }
+            // noise like values, varints would be larger than values themselves
+            if (out.size () - start > 1 + num_samples * sizeof (double))
+            {
+                out.resize (start);
+                out.push_back ((char)BFRecChannelModes::RAW);
+                for (int i = 0; i < num_samples; i++)
+                {
+                    put_double (out, column[i]);
+                }
+            }
+        }
+    }
+}
+
+int bfrec_decompress_block (
+    const char *data, size_t size, int num_samples, int num_rows, double *samples)
+{
+    ByteReader reader = {data, size, 0};
+    for (int channel = 0; channel < num_rows; channel++)
+    {
+        unsigned char mode = 0;
+        if (!reader.get_bytes (&mode, 1))
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+        bool res = false;
+        if (mode == (unsigned char)BFRecChannelModes::CONSTANT)
+        {
+            double value = 0.0;
+            res = reader.get_double (value);
+            for (int i = 0; (res) && (i < num_samples); i++)
+            {
+                samples[i * num_rows + channel] = value;
+            }
+        }
+        else if (mode == (unsigned char)BFRecChannelModes::INTEGER)
+        {
+            res = decompress_integer_channel (reader, num_samples, num_rows, channel, samples);
+        }
+        else if (mode == (unsigned char)BFRecChannelModes::XOR)
+        {
+            uint64_t prev = 0;
+            res = true;
+            for (int i = 0; (res) && (i < num_samples); i++)
+            {
+                uint64_t value = 0;
+                res = reader.get_varint (value);
+                prev ^= value;
+                samples[i * num_rows + channel] = from_bits (prev);
+            }
+        }
+        else if (mode == (unsigned char)BFRecChannelModes::RAW)
+        {
+            res = true;
+            for (int i = 0; (res) && (i < num_samples); i++)
+            {
+                res = reader.get_double (samples[i * num_rows + channel]);
+            }
+        }
+        if (!res)
+        {
+            return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
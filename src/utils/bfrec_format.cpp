@@ -0,0 +1,371 @@
+// fseeko and ftello use 64 bit off_t on 32 bit linux as well
+#define _FILE_OFFSET_BITS 64
+
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+#include "bfrec_compression.h"
+#include "bfrec_format.h"
+#include "brainflow_constants.h"
+
+#define BFREC_MAX_BLOCK_SAMPLES (1 << 20)
+
+
+static inline bool is_little_endian ()
+{
+    uint16_t value = 1;
+    return *((char *)&value) == 1;
+}
+
+static inline void swap_bytes (char *data, size_t size)
+{
+    for (size_t i = 0; i < size / 2; i++)
+    {
+        char tmp = data[i];
+        data[i] = data[size - 1 - i];
+        data[size - 1 - i] = tmp;
+    }
+}
+
+int bfrec_seek (FILE *fp, int64_t offset, int origin)
+{
+#ifdef _WIN32
+    return _fseeki64 (fp, offset, origin);
+#else
+    return fseeko (fp, (off_t)offset, origin);
+#endif
+}
+
+int64_t bfrec_tell (FILE *fp)
+{
+#ifdef _WIN32
+    return _ftelli64 (fp);
+#else
+    return (int64_t)ftello (fp);
+#endif
+}
+
+bool bfrec_check_magic (FILE *fp)
+{
+    char magic[4] = {0};
+    int64_t pos = bfrec_tell (fp);
+    size_t res = fread (magic, 1, sizeof (magic), fp);
+    bfrec_seek (fp, pos, SEEK_SET);
+    return (res == sizeof (magic)) && ((memcmp (magic, BFREC_MAGIC, sizeof (magic)) == 0) ||
+                                          (memcmp (magic, BFREC_COMPRESSED_MAGIC, 4) == 0));
+}
+
+int bfrec_read_header (FILE *fp, BFRecHeader &header)
+{
+    char fixed[BFREC_FIXED_HEADER_SIZE];
+    if (fread (fixed, 1, sizeof (fixed), fp) != sizeof (fixed))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    header.compressed = (memcmp (fixed, BFREC_COMPRESSED_MAGIC, 4) == 0);
+    if ((!header.compressed) && (memcmp (fixed, BFREC_MAGIC, 4) != 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    uint32_t version = bfrec_get_uint32 (fixed + 4);
+    uint32_t header_size = bfrec_get_uint32 (fixed + 8);
+    uint32_t descr_size = bfrec_get_uint32 (fixed + 24);
+    header.board_id = (int32_t)bfrec_get_uint32 (fixed + 12);
+    header.preset = (int32_t)bfrec_get_uint32 (fixed + 16);
+    header.num_rows = (int32_t)bfrec_get_uint32 (fixed + 20);
+    if ((version != BFREC_VERSION) || (header.num_rows <= 0) ||
+        ((uint64_t)header_size < (uint64_t)BFREC_FIXED_HEADER_SIZE + descr_size))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    std::vector<char> descr (descr_size + 1, 0);
+    if ((descr_size > 0) && (fread (descr.data (), 1, descr_size, fp) != descr_size))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    header.descr = std::string (descr.data (), descr_size);
+    header.header_size = (int64_t)header_size;
+    if (bfrec_seek (fp, header.header_size, SEEK_SET) != 0)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int bfrec_write_header (FILE *fp, BFRecHeader &header)
+{
+    size_t descr_size = header.descr.size ();
+    size_t header_size = BFREC_FIXED_HEADER_SIZE + descr_size;
+    header_size = (header_size + 7) / 8 * 8; // samples are aligned for mmap based readers
+    std::vector<char> bytes (header_size, 0);
+    memcpy (bytes.data (), header.compressed ? BFREC_COMPRESSED_MAGIC : BFREC_MAGIC, 4);
+    bfrec_put_uint32 (bytes.data () + 4, BFREC_VERSION);
+    bfrec_put_uint32 (bytes.data () + 8, (uint32_t)header_size);
+    bfrec_put_uint32 (bytes.data () + 12, (uint32_t)header.board_id);
+    bfrec_put_uint32 (bytes.data () + 16, (uint32_t)header.preset);
+    bfrec_put_uint32 (bytes.data () + 20, (uint32_t)header.num_rows);
+    bfrec_put_uint32 (bytes.data () + 24, (uint32_t)descr_size);
+    if (descr_size > 0)
+    {
+        memcpy (bytes.data () + BFREC_FIXED_HEADER_SIZE, header.descr.c_str (), descr_size);
+    }
+    if (fwrite (bytes.data (), 1, header_size, fp) != header_size)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    header.header_size = (int64_t)header_size;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+long bfrec_get_num_samples (FILE *fp, const BFRecHeader &header)
+{
+    int64_t pos = bfrec_tell (fp);
+    bfrec_seek (fp, 0, SEEK_END);
+    int64_t file_size = bfrec_tell (fp);
+    bfrec_seek (fp, pos, SEEK_SET);
+    if (file_size <= header.header_size)
+    {
+        return 0;
+    }
+    return (long)((file_size - header.header_size) /
+        ((int64_t)header.num_rows * (int64_t)sizeof (double)));
+}
+
+int bfrec_write_block (
+    FILE *fp, const double *samples, int num_samples, int num_rows, std::vector<char> &buffer)
+{
+    buffer.resize (BFREC_BLOCK_HEADER_SIZE);
+    bfrec_compress_block (samples, num_samples, num_rows, buffer);
+    bfrec_put_uint32 (buffer.data (), (uint32_t)(buffer.size () - BFREC_BLOCK_HEADER_SIZE));
+    bfrec_put_uint32 (buffer.data () + 4, (uint32_t)num_samples);
+    // single write per block, so killed writer leaves at most one incomplete block
+    if (fwrite (buffer.data (), 1, buffer.size (), fp) != buffer.size ())
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int bfrec_read_block (FILE *fp, int64_t offset, int num_rows, std::vector<char> &bytes,
+    std::vector<double> &samples, long *num_samples)
+{
+    char block_header[BFREC_BLOCK_HEADER_SIZE];
+    if ((bfrec_seek (fp, offset, SEEK_SET) != 0) ||
+        (fread (block_header, 1, sizeof (block_header), fp) != sizeof (block_header)))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    long payload_size = (long)bfrec_get_uint32 (block_header);
+    long block_samples = (long)bfrec_get_uint32 (block_header + 4);
+    if ((block_samples <= 0) || (block_samples > BFREC_MAX_BLOCK_SAMPLES))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    bytes.resize ((size_t)payload_size);
+    samples.resize ((size_t)(block_samples * num_rows));
+    if (fread (bytes.data (), 1, bytes.size (), fp) != bytes.size ())
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    *num_samples = block_samples;
+    return bfrec_decompress_block (
+        bytes.data (), bytes.size (), (int)block_samples, num_rows, samples.data ());
+}
+
+void bfrec_encode (const double *src, size_t count, char *dst)
+{
+    memcpy (dst, src, count * sizeof (double));
+    if (!is_little_endian ())
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            swap_bytes (dst + i * sizeof (double), sizeof (double));
+        }
+    }
+}
+
+void bfrec_decode (const char *src, size_t count, double *dst)
+{
+    memcpy (dst, src, count * sizeof (double));
+    if (!is_little_endian ())
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            swap_bytes ((char *)(dst + i), sizeof (double));
+        }
+    }
+}
+
+BFRecReader::BFRecReader ()
+{
+    fp = NULL;
+    num_samples = 0;
+    position = 0;
+    data_end = 0;
+    current_block = -1;
+}
+
+BFRecReader::~BFRecReader ()
+{
+    close ();
+}
+
+int BFRecReader::open (const char *file_name)
+{
+    close ();
+    fp = fopen (file_name, "rb");
+    if (fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int res = (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    if (bfrec_check_magic (fp))
+    {
+        res = bfrec_read_header (fp, header);
+    }
+    if ((res == (int)BrainFlowExitCodes::STATUS_OK) && (header.compressed))
+    {
+        res = index_blocks ();
+    }
+    else if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        num_samples = bfrec_get_num_samples (fp, header);
+        data_end = header.header_size +
+            (int64_t)num_samples * header.num_rows * (int64_t)sizeof (double);
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        close ();
+        return res;
+    }
+    return seek (0);
+}
+
+void BFRecReader::close ()
+{
+    if (fp != NULL)
+    {
+        fclose (fp);
+        fp = NULL;
+    }
+    header = BFRecHeader ();
+    num_samples = 0;
+    position = 0;
+    data_end = 0;
+    block_offsets.clear ();
+    block_starts.clear ();
+    current_block = -1;
+}
+
+int BFRecReader::index_blocks ()
+{
+    bfrec_seek (fp, 0, SEEK_END);
+    int64_t file_size = bfrec_tell (fp);
+    int64_t offset = header.header_size;
+    num_samples = 0;
+    block_starts.push_back (0);
+    while (offset + BFREC_BLOCK_HEADER_SIZE <= file_size)
+    {
+        char block_header[BFREC_BLOCK_HEADER_SIZE];
+        bfrec_seek (fp, offset, SEEK_SET);
+        if (fread (block_header, 1, sizeof (block_header), fp) != sizeof (block_header))
+        {
+            break;
+        }
+        long payload_size = (long)bfrec_get_uint32 (block_header);
+        long block_samples = (long)bfrec_get_uint32 (block_header + 4);
+        if ((block_samples <= 0) || (block_samples > BFREC_MAX_BLOCK_SAMPLES) ||
+            (offset + BFREC_BLOCK_HEADER_SIZE + payload_size > file_size))
+        {
+            break;
+        }
+        block_offsets.push_back (offset);
+        num_samples += block_samples;
+        block_starts.push_back (num_samples);
+        offset += BFREC_BLOCK_HEADER_SIZE + payload_size;
+    }
+    data_end = offset;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int BFRecReader::load_block (long block_index)
+{
+    if (block_index == current_block)
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    current_block = -1;
+    long block_samples = 0;
+    int res = bfrec_read_block (
+        fp, block_offsets[block_index], header.num_rows, bytes, block, &block_samples);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        current_block = block_index;
+    }
+    return res;
+}
+
+int BFRecReader::seek (long sample)
+{
+    if ((fp == NULL) || (sample < 0) || (sample > num_samples))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    position = sample;
+    if (!header.compressed)
+    {
+        int64_t offset =
+            header.header_size + (int64_t)sample * header.num_rows * (int64_t)sizeof (double);
+        if (bfrec_seek (fp, offset, SEEK_SET) != 0)
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+long BFRecReader::read (long max_samples, double *samples)
+{
+    if (fp == NULL)
+    {
+        return 0;
+    }
+    long count = std::min (max_samples, num_samples - position);
+    if (count <= 0)
+    {
+        return 0;
+    }
+    if (!header.compressed)
+    {
+        size_t len = (size_t)count * header.num_rows;
+        bytes.resize (len * sizeof (double));
+        if (fread (bytes.data (), sizeof (double), len, fp) != len)
+        {
+            return 0;
+        }
+        bfrec_decode (bytes.data (), len, samples);
+        position += count;
+        return count;
+    }
+    long done = 0;
+    while (done < count)
+    {
+        // block which contains position
+        long block_index = (long)(std::upper_bound (block_starts.begin (), block_starts.end (),
+                                      position) -
+                               block_starts.begin ()) -
+            1;
+        if (load_block (block_index) != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            break;
+        }
+        long offset = position - block_starts[block_index];
+        long len = std::min (count - done, block_starts[block_index + 1] - position);
+        memcpy (samples + done * header.num_rows, block.data () + offset * header.num_rows,
+            sizeof (double) * len * header.num_rows);
+        done += len;
+        position += len;
+    }
+    return done;
+}
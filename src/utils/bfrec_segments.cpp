@@ -0,0 +1,265 @@
+#include <string.h>
+
+#include "bfrec_segments.h"
+#include "brainflow_constants.h"
+
+
+std::string bfrec_segment_file_name (const std::string &prefix, int segment)
+{
+    char suffix[32];
+    snprintf (suffix, sizeof (suffix), "_%06d.bfrec", segment);
+    return prefix + suffix;
+}
+
+std::string bfrec_index_file_name (const std::string &prefix)
+{
+    return prefix + ".bfidx";
+}
+
+int bfrec_write_index_header (FILE *fp, int num_rows, int timestamp_channel)
+{
+    char bytes[BFREC_INDEX_HEADER_SIZE];
+    memcpy (bytes, BFREC_INDEX_MAGIC, 4);
+    bfrec_put_uint32 (bytes + 4, BFREC_INDEX_VERSION);
+    bfrec_put_uint32 (bytes + 8, (uint32_t)num_rows);
+    bfrec_put_uint32 (bytes + 12, (uint32_t)timestamp_channel);
+    if (fwrite (bytes, 1, sizeof (bytes), fp) != sizeof (bytes))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int bfrec_read_index_header (FILE *fp, int *num_rows, int *timestamp_channel)
+{
+    char bytes[BFREC_INDEX_HEADER_SIZE];
+    if ((fseek (fp, 0, SEEK_SET) != 0) || (fread (bytes, 1, sizeof (bytes), fp) != sizeof (bytes)))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    if ((memcmp (bytes, BFREC_INDEX_MAGIC, 4) != 0) ||
+        (bfrec_get_uint32 (bytes + 4) != BFREC_INDEX_VERSION))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    *num_rows = (int32_t)bfrec_get_uint32 (bytes + 8);
+    *timestamp_channel = (int32_t)bfrec_get_uint32 (bytes + 12);
+    if ((*num_rows <= 0) || (*timestamp_channel < 0) || (*timestamp_channel >= *num_rows))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int bfrec_write_index_entry (FILE *fp, const BFRecIndexEntry &entry)
+{
+    char bytes[BFREC_INDEX_ENTRY_SIZE];
+    double timestamps[2] = {entry.first_timestamp, entry.last_timestamp};
+    bfrec_encode (timestamps, 2, bytes);
+    uint64_t offset = (uint64_t)entry.offset;
+    bfrec_put_uint32 (bytes + 16, (uint32_t)(offset & 0xFFFFFFFF));
+    bfrec_put_uint32 (bytes + 20, (uint32_t)(offset >> 32));
+    bfrec_put_uint32 (bytes + 24, (uint32_t)entry.segment);
+    bfrec_put_uint32 (bytes + 28, (uint32_t)entry.num_samples);
+    if (fwrite (bytes, 1, sizeof (bytes), fp) != sizeof (bytes))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int bfrec_read_index_entry (FILE *fp, long entry_num, BFRecIndexEntry &entry)
+{
+    char bytes[BFREC_INDEX_ENTRY_SIZE];
+    int64_t offset = BFREC_INDEX_HEADER_SIZE + (int64_t)entry_num * BFREC_INDEX_ENTRY_SIZE;
+    if ((bfrec_seek (fp, offset, SEEK_SET) != 0) ||
+        (fread (bytes, 1, sizeof (bytes), fp) != sizeof (bytes)))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    double timestamps[2];
+    bfrec_decode (bytes, 2, timestamps);
+    entry.first_timestamp = timestamps[0];
+    entry.last_timestamp = timestamps[1];
+    entry.offset = (int64_t)((uint64_t)bfrec_get_uint32 (bytes + 16) |
+        ((uint64_t)bfrec_get_uint32 (bytes + 20) << 32));
+    entry.segment = (int32_t)bfrec_get_uint32 (bytes + 24);
+    entry.num_samples = (int32_t)bfrec_get_uint32 (bytes + 28);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+long bfrec_get_num_index_entries (FILE *fp)
+{
+    int64_t pos = bfrec_tell (fp);
+    bfrec_seek (fp, 0, SEEK_END);
+    int64_t file_size = bfrec_tell (fp);
+    bfrec_seek (fp, pos, SEEK_SET);
+    if (file_size <= BFREC_INDEX_HEADER_SIZE)
+    {
+        return 0;
+    }
+    return (long)((file_size - BFREC_INDEX_HEADER_SIZE) / BFREC_INDEX_ENTRY_SIZE);
+}
+
+BFRecRangeReader::BFRecRangeReader ()
+{
+    index_fp = NULL;
+    segment_fp = NULL;
+    num_rows = 0;
+    timestamp_channel = -1;
+    num_entries = 0;
+    current_segment = -1;
+}
+
+BFRecRangeReader::~BFRecRangeReader ()
+{
+    close ();
+}
+
+int BFRecRangeReader::open (const char *prefix)
+{
+    close ();
+    this->prefix = prefix;
+    index_fp = fopen (bfrec_index_file_name (this->prefix).c_str (), "rb");
+    if (index_fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    int res = bfrec_read_index_header (index_fp, &num_rows, &timestamp_channel);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        close ();
+        return res;
+    }
+    num_entries = bfrec_get_num_index_entries (index_fp);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void BFRecRangeReader::close ()
+{
+    if (index_fp != NULL)
+    {
+        fclose (index_fp);
+        index_fp = NULL;
+    }
+    if (segment_fp != NULL)
+    {
+        fclose (segment_fp);
+        segment_fp = NULL;
+    }
+    num_rows = 0;
+    timestamp_channel = -1;
+    num_entries = 0;
+    current_segment = -1;
+}
+
+long BFRecRangeReader::find_first_entry (double start_time)
+{
+    // first entry with last_timestamp >= start_time
+    long left = 0;
+    long right = num_entries;
+    BFRecIndexEntry entry;
+    while (left < right)
+    {
+        long mid = left + (right - left) / 2;
+        if (bfrec_read_index_entry (index_fp, mid, entry) != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return num_entries;
+        }
+        if (entry.last_timestamp < start_time)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+int BFRecRangeReader::open_segment (int segment)
+{
+    if ((segment == current_segment) && (segment_fp != NULL))
+    {
+        return (int)BrainFlowExitCodes::STATUS_OK;
+    }
+    if (segment_fp != NULL)
+    {
+        fclose (segment_fp);
+    }
+    current_segment = -1;
+    segment_fp = fopen (bfrec_segment_file_name (prefix, segment).c_str (), "rb");
+    if (segment_fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    BFRecHeader header;
+    if ((bfrec_read_header (segment_fp, header) != (int)BrainFlowExitCodes::STATUS_OK) ||
+        (!header.compressed) || (header.num_rows != num_rows))
+    {
+        fclose (segment_fp);
+        segment_fp = NULL;
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    current_segment = segment;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+long BFRecRangeReader::get_max_samples (double start_time, double end_time)
+{
+    long max_samples = 0;
+    BFRecIndexEntry entry;
+    for (long i = find_first_entry (start_time); i < num_entries; i++)
+    {
+        if ((bfrec_read_index_entry (index_fp, i, entry) != (int)BrainFlowExitCodes::STATUS_OK) ||
+            (entry.first_timestamp > end_time))
+        {
+            break;
+        }
+        max_samples += entry.num_samples;
+    }
+    return max_samples;
+}
+
+int BFRecRangeReader::read_range (double start_time, double end_time, std::vector<double> &samples)
+{
+    if (index_fp == NULL)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    BFRecIndexEntry entry;
+    for (long i = find_first_entry (start_time); i < num_entries; i++)
+    {
+        int res = bfrec_read_index_entry (index_fp, i, entry);
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        if (entry.first_timestamp > end_time)
+        {
+            break;
+        }
+        res = open_segment (entry.segment);
+        long block_samples = 0;
+        if (res == (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            res = bfrec_read_block (
+                segment_fp, entry.offset, num_rows, bytes, block, &block_samples);
+        }
+        if (res != (int)BrainFlowExitCodes::STATUS_OK)
+        {
+            return res;
+        }
+        for (long j = 0; j < block_samples; j++)
+        {
+            const double *sample = block.data () + j * num_rows;
+            double timestamp = sample[timestamp_channel];
+            if ((timestamp >= start_time) && (timestamp <= end_time))
+            {
+                samples.insert (samples.end (), sample, sample + num_rows);
+            }
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
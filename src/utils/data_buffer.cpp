@@ -2,11 +2,46 @@
 
 #include <new>
 
-DataBuffer::DataBuffer (int num_samples, size_t buffer_size)
+// 32x32 doubles is 8KB per tile, source and destination tiles fit into L1 together
+#define TRANSPOSE_BLOCK_SIZE 32
+
+
+void BaseDataBuffer::transpose (
+    size_t count, const double *buf, double *output_buf, size_t output_stride)
+{
+    for (size_t first_package = 0; first_package < count; first_package += TRANSPOSE_BLOCK_SIZE)
+    {
+        size_t last_package = first_package + TRANSPOSE_BLOCK_SIZE;
+        if (last_package > count)
+        {
+            last_package = count;
+        }
+        for (size_t first_channel = 0; first_channel < num_samples;
+             first_channel += TRANSPOSE_BLOCK_SIZE)
+        {
+            size_t last_channel = first_channel + TRANSPOSE_BLOCK_SIZE;
+            if (last_channel > num_samples)
+            {
+                last_channel = num_samples;
+            }
+            for (size_t j = first_channel; j < last_channel; j++)
+            {
+                double *output_row = output_buf + j * output_stride;
+                for (size_t i = first_package; i < last_package; i++)
+                {
+                    output_row[i] = buf[i * num_samples + j];
+                }
+            }
+        }
+    }
+}
+
+DataBuffer::DataBuffer (int num_samples, size_t buffer_size) : BaseDataBuffer (num_samples)
 {
     this->buffer_size = buffer_size;
-    this->num_samples = num_samples;
     first_free = first_used = count = 0;
+    total_count = 0;
+    overwritten_count = 0;
 
     if (buffer_size == 0)
     {
@@ -44,41 +79,91 @@ void DataBuffer::add_data (double *value)
 
     lock.lock ();
 
-    if (count == 0)
-    {
-        first_used = first_free = 0;
-    }
-    else if (first_free == first_used)
+    if (count == buffer_size)
     {
         first_used = next (first_used);
         count--;
+        overwritten_count++;
     }
 
     memcpy (this->data + first_free * num_samples, value, sizeof (double) * num_samples);
     first_free = next (first_free);
     count++;
+    total_count++;
 
     lock.unlock ();
 }
 
-void DataBuffer::get_chunk (size_t start, size_t size, double *data_buf)
+void DataBuffer::add_data (const double *values, size_t count)
 {
-    if (start + size < buffer_size)
+    if ((!is_ready ()) || (count == 0))
+    {
+        return;
+    }
+    uint64_t added = count;
+    // only the newest buffer_size packages survive
+    size_t dropped = 0;
+    if (count > buffer_size)
+    {
+        dropped = count - buffer_size;
+        values += dropped * num_samples;
+        count = buffer_size;
+    }
+
+    lock.lock ();
+
+    if (this->count + added > buffer_size)
     {
-        memcpy (data_buf, data + start * num_samples, size * sizeof (double) * num_samples);
+        overwritten_count += this->count + added - buffer_size;
+    }
+    // package at position p is always in slot p % buffer_size, cursors rely on it
+    first_free = (first_free + dropped) % buffer_size;
+    size_t first_half = buffer_size - first_free;
+    if (first_half > count)
+    {
+        first_half = count;
+    }
+    size_t second_half = count - first_half;
+    memcpy (data + first_free * num_samples, values, sizeof (double) * num_samples * first_half);
+    memcpy (data, values + first_half * num_samples, sizeof (double) * num_samples * second_half);
+    first_free = (first_free + count) % buffer_size;
+    this->count += count;
+    if (this->count > buffer_size)
+    {
+        this->count = buffer_size;
+    }
+    if (this->count == buffer_size)
+    {
+        first_used = first_free;
+    }
+    total_count += added;
+
+    lock.unlock ();
+}
+
+// wraparound is handled here, by_channels transposes each contiguous part directly to data_buf
+void DataBuffer::get_chunk (size_t start, size_t size, double *data_buf, bool by_channels)
+{
+    size_t first_half = size;
+    if (start + size > buffer_size)
+    {
+        first_half = buffer_size - start;
+    }
+    size_t second_half = size - first_half;
+    if (by_channels)
+    {
+        transpose (first_half, data + start * num_samples, data_buf, size);
+        transpose (second_half, data, data_buf + first_half, size);
     }
     else
     {
-        size_t first_half = buffer_size - start;
-        size_t second_half = size - first_half;
         memcpy (data_buf, data + start * num_samples, first_half * sizeof (double) * num_samples);
         memcpy (
             data_buf + first_half * num_samples, data, second_half * sizeof (double) * num_samples);
     }
 }
 
-// Removes data from buffer
-size_t DataBuffer::get_data (size_t max_count, double *data_buf)
+size_t DataBuffer::read_data (size_t max_count, double *data_buf, bool by_channels)
 {
     lock.lock ();
     size_t result_count = max_count;
@@ -88,7 +173,7 @@ size_t DataBuffer::get_data (size_t max_count, double *data_buf)
     }
     if (result_count)
     {
-        get_chunk (first_used, result_count, data_buf);
+        get_chunk (first_used, result_count, data_buf, by_channels);
         first_used = (first_used + result_count) % buffer_size;
         count -= result_count;
     }
@@ -96,8 +181,7 @@ size_t DataBuffer::get_data (size_t max_count, double *data_buf)
     return result_count;
 }
 
-// Doesn't remove data from buffer
-size_t DataBuffer::get_current_data (size_t max_count, double *data_buf)
+size_t DataBuffer::read_current_data (size_t max_count, double *data_buf, bool by_channels)
 {
     lock.lock ();
     size_t result_count = max_count;
@@ -106,12 +190,34 @@ size_t DataBuffer::get_current_data (size_t max_count, double *data_buf)
     if (result_count)
     {
         size_t first_return = (first_used + (count - result_count)) % buffer_size;
-        get_chunk (first_return, result_count, data_buf);
+        get_chunk (first_return, result_count, data_buf, by_channels);
     }
     lock.unlock ();
     return result_count;
 }
 
+// Removes data from buffer
+size_t DataBuffer::get_data (size_t max_count, double *data_buf)
+{
+    return read_data (max_count, data_buf, false);
+}
+
+// Doesn't remove data from buffer
+size_t DataBuffer::get_current_data (size_t max_count, double *data_buf)
+{
+    return read_current_data (max_count, data_buf, false);
+}
+
+size_t DataBuffer::get_data_by_channels (size_t max_count, double *data_buf)
+{
+    return read_data (max_count, data_buf, true);
+}
+
+size_t DataBuffer::get_current_data_by_channels (size_t max_count, double *data_buf)
+{
+    return read_current_data (max_count, data_buf, true);
+}
+
 size_t DataBuffer::get_data_count ()
 {
     lock.lock ();
@@ -119,3 +225,62 @@ size_t DataBuffer::get_data_count ()
     lock.unlock ();
     return result;
 }
+
+uint64_t DataBuffer::get_overwritten_count ()
+{
+    lock.lock ();
+    uint64_t result = overwritten_count;
+    lock.unlock ();
+    return result;
+}
+
+uint64_t DataBuffer::get_first_since (uint64_t position)
+{
+    if (position > total_count)
+    {
+        return total_count;
+    }
+    if (total_count - position > buffer_size)
+    {
+        return total_count - buffer_size;
+    }
+    return position;
+}
+
+uint64_t DataBuffer::get_write_position ()
+{
+    lock.lock ();
+    uint64_t result = total_count;
+    lock.unlock ();
+    return result;
+}
+
+size_t DataBuffer::get_data_count_since (uint64_t position, uint64_t *skipped)
+{
+    lock.lock ();
+    uint64_t first = get_first_since (position);
+    *skipped = (first > position) ? first - position : 0;
+    size_t result = (size_t)(total_count - first);
+    lock.unlock ();
+    return result;
+}
+
+size_t DataBuffer::get_data_by_channels_since (
+    uint64_t *position, size_t max_count, double *data_buf, uint64_t *skipped)
+{
+    lock.lock ();
+    uint64_t first = get_first_since (*position);
+    size_t result_count = max_count;
+    if (result_count > total_count - first)
+    {
+        result_count = (size_t)(total_count - first);
+    }
+    if (result_count)
+    {
+        get_chunk ((size_t)(first % buffer_size), result_count, data_buf, true);
+    }
+    *skipped = (first > *position) ? first - *position : 0;
+    *position = first + result_count;
+    lock.unlock ();
+    return result_count;
+}
@@ -0,0 +1,236 @@
+#include <string.h>
+
+#include "datagram_batch.h"
+#include "timestamp.h"
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+
+DatagramBatch::DatagramBatch (int max_datagrams, int max_size)
+{
+    this->max_datagrams = (max_datagrams < 1) ? 1 : max_datagrams;
+    this->max_size = (max_size < 1) ? 1 : max_size;
+    count = 0;
+    arena.resize ((size_t)this->max_datagrams * this->max_size);
+    sizes.resize (this->max_datagrams, 0);
+    arrival_times.resize (this->max_datagrams, 0.0);
+#ifndef _WIN32
+    control.resize ((size_t)this->max_datagrams * DATAGRAM_BATCH_CONTROL_SIZE);
+#endif
+#ifdef DATAGRAM_BATCH_USE_MMSG
+    msgs.resize (this->max_datagrams);
+    iovecs.resize (this->max_datagrams);
+    memset (msgs.data (), 0, sizeof (struct mmsghdr) * this->max_datagrams);
+    for (int i = 0; i < this->max_datagrams; i++)
+    {
+        iovecs[i].iov_base = get_datagram (i);
+        iovecs[i].iov_len = this->max_size;
+        msgs[i].msg_hdr.msg_iov = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+#endif
+}
+
+bool DatagramBatch::add (const void *data, int size)
+{
+    if ((count == max_datagrams) || (size < 0) || (size > max_size))
+    {
+        return false;
+    }
+    memcpy (get_datagram (count), data, size);
+    sizes[count] = size;
+    count++;
+    return true;
+}
+
+#ifdef _WIN32
+
+bool DatagramBatch::enable_kernel_timestamps (datagram_socket_t sock)
+{
+    return false;
+}
+
+#else
+
+bool DatagramBatch::enable_kernel_timestamps (datagram_socket_t sock)
+{
+    int value = 1;
+#ifdef SO_TIMESTAMPNS
+    return setsockopt (sock, SOL_SOCKET, SO_TIMESTAMPNS, &value, sizeof (value)) == 0;
+#else
+    return setsockopt (sock, SOL_SOCKET, SO_TIMESTAMP, &value, sizeof (value)) == 0;
+#endif
+}
+
+// returns 0 if there is no kernel timestamp in ancillary data
+static double get_kernel_timestamp (struct msghdr *msg)
+{
+    if (msg->msg_controllen == 0)
+    {
+        return 0.0;
+    }
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR (msg); cmsg != NULL; cmsg = CMSG_NXTHDR (msg, cmsg))
+    {
+        if (cmsg->cmsg_level != SOL_SOCKET)
+        {
+            continue;
+        }
+#ifdef SCM_TIMESTAMPNS
+        if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+        {
+            struct timespec ts;
+            memcpy (&ts, CMSG_DATA (cmsg), sizeof (ts));
+            return (double)ts.tv_sec + (double)ts.tv_nsec / 1000000000.0;
+        }
+#endif
+        if (cmsg->cmsg_type == SCM_TIMESTAMP)
+        {
+            struct timeval tv;
+            memcpy (&tv, CMSG_DATA (cmsg), sizeof (tv));
+            return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+        }
+    }
+    return 0.0;
+}
+
+#endif
+
+#ifdef DATAGRAM_BATCH_USE_MMSG
+
+int DatagramBatch::recv (datagram_socket_t sock)
+{
+    count = 0;
+    for (int i = 0; i < max_datagrams; i++)
+    {
+        iovecs[i].iov_len = max_size;
+        msgs[i].msg_hdr.msg_name = NULL;
+        msgs[i].msg_hdr.msg_namelen = 0;
+        msgs[i].msg_hdr.msg_control = control.data () + (size_t)i * DATAGRAM_BATCH_CONTROL_SIZE;
+        msgs[i].msg_hdr.msg_controllen = DATAGRAM_BATCH_CONTROL_SIZE;
+        msgs[i].msg_hdr.msg_flags = 0;
+        msgs[i].msg_len = 0;
+    }
+    // MSG_WAITFORONE makes only the first datagram blocking
+    int res = recvmmsg (sock, msgs.data (), max_datagrams, MSG_WAITFORONE, NULL);
+    if (res < 0)
+    {
+        return -1;
+    }
+    double recv_time = get_timestamp ();
+    for (int i = 0; i < res; i++)
+    {
+        sizes[i] = (int)msgs[i].msg_len;
+        double kernel_time = get_kernel_timestamp (&msgs[i].msg_hdr);
+        arrival_times[i] = (kernel_time > 0) ? kernel_time : recv_time;
+    }
+    count = res;
+    return res;
+}
+
+int DatagramBatch::send (datagram_socket_t sock, const struct sockaddr_in *addr)
+{
+    for (int i = 0; i < count; i++)
+    {
+        iovecs[i].iov_len = sizes[i];
+        msgs[i].msg_hdr.msg_name = (void *)addr;
+        msgs[i].msg_hdr.msg_namelen = (socklen_t)sizeof (struct sockaddr_in);
+        msgs[i].msg_hdr.msg_control = NULL;
+        msgs[i].msg_hdr.msg_controllen = 0;
+        msgs[i].msg_hdr.msg_flags = 0;
+    }
+    int sent = 0;
+    while (sent < count)
+    {
+        int res = sendmmsg (sock, msgs.data () + sent, count - sent, 0);
+        if (res <= 0)
+        {
+            break;
+        }
+        sent += res;
+    }
+    count = 0;
+    return (sent > 0) ? sent : -1;
+}
+
+#else
+
+// receives single datagram to slot of batch, flags are passed to recv call
+static int recv_datagram (datagram_socket_t sock, char *data, int size, char *control, int flags,
+    double *arrival_time)
+{
+#ifdef _WIN32
+    int res = recvfrom (sock, data, size, flags, NULL, NULL);
+    *arrival_time = get_timestamp ();
+#else
+    struct iovec iov;
+    iov.iov_base = data;
+    iov.iov_len = size;
+    struct msghdr msg;
+    memset (&msg, 0, sizeof (msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = DATAGRAM_BATCH_CONTROL_SIZE;
+    int res = (int)recvmsg (sock, &msg, flags);
+    double kernel_time = (res >= 0) ? get_kernel_timestamp (&msg) : 0.0;
+    *arrival_time = (kernel_time > 0) ? kernel_time : get_timestamp ();
+#endif
+    return res;
+}
+
+int DatagramBatch::recv (datagram_socket_t sock)
+{
+    count = 0;
+#ifdef _WIN32
+    char *control_data = NULL;
+#else
+    char *control_data = control.data ();
+#endif
+    int res = recv_datagram (sock, get_datagram (0), max_size, control_data, 0, &arrival_times[0]);
+    if (res < 0)
+    {
+        return -1;
+    }
+    sizes[count++] = res;
+    while (count < max_datagrams)
+    {
+#ifdef _WIN32
+        u_long pending = 0;
+        if ((ioctlsocket (sock, FIONREAD, &pending) != 0) || (pending == 0))
+        {
+            break;
+        }
+        res = recv_datagram (sock, get_datagram (count), max_size, NULL, 0, &arrival_times[count]);
+#else
+        res = recv_datagram (sock, get_datagram (count), max_size,
+            control_data + (size_t)count * DATAGRAM_BATCH_CONTROL_SIZE, MSG_DONTWAIT,
+            &arrival_times[count]);
+#endif
+        if (res < 0)
+        {
+            break;
+        }
+        sizes[count++] = res;
+    }
+    return count;
+}
+
+int DatagramBatch::send (datagram_socket_t sock, const struct sockaddr_in *addr)
+{
+    int sent = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int res = sendto (sock, get_datagram (i), sizes[i], 0, (const struct sockaddr *)addr,
+            (int)sizeof (struct sockaddr_in));
+        if (res >= 0)
+        {
+            sent++;
+        }
+    }
+    count = 0;
+    return (sent > 0) ? sent : -1;
+}
+
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#define BFREC_BLOCK_SAMPLES 512
+
+
+// lossless compression of one block of samples, each channel is encoded independently:
+//   constant channel: single value
+//   integer channel, all values are n * quantum with integer n (raw adc codes scaled by board,
+//   package num, markers): fixed polynomial predictor of order 0-2 and rice coded residuals with
+//   parameter per block, same approach as FLAC uses for audio
+//   other channels: xor with previous value stored as varint, it keeps leading zero bytes out,
+//   or values as is if xor does not help
+// every value is checked during encoding, if exact reconstruction is not possible channel falls
+// back to the next mode, so decoded doubles are bitwise equal to input
+enum class BFRecChannelModes : uint8_t
+{
+    CONSTANT = 0,
+    INTEGER = 1,
+    XOR = 2,
+    RAW = 3
+};
+
+// samples are sample major, output is appended to out
+void bfrec_compress_block (
+    const double *samples, int num_samples, int num_rows, std::vector<char> &out);
+// returns BrainFlowExitCodes, samples are sample major
+int bfrec_decompress_block (
+    const char *data, size_t size, int num_samples, int num_rows, double *samples);
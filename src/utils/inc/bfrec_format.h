@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#define BFREC_MAGIC "BFRC"
+#define BFREC_COMPRESSED_MAGIC "BFRZ"
+#define BFREC_VERSION 1
+// magic, version, header size, board id, preset, num rows, descr size
+#define BFREC_FIXED_HEADER_SIZE 28
+// payload size, num samples
+#define BFREC_BLOCK_HEADER_SIZE 8
+
+
+// binary recording, all numbers are little endian:
+//   char magic[4], uint32 version, uint32 header_size, int32 board_id, int32 preset,
+//   int32 num_rows, uint32 descr_size, char descr[descr_size], zero padding up to header_size
+// descr is json description of the preset, it is the channel map of recorded data. Header size
+// is a multiple of 8, after it there are samples of num_rows float64 values each, so sample i
+// starts at header_size + i * num_rows * 8 and readers can seek without an index. Incomplete
+// sample at the end of file (if writer was killed) is ignored by readers
+// Compressed recordings have BFRZ magic and the same header, after it there are blocks:
+//   uint32 payload_size, uint32 num_samples, payload from bfrec_compress_block
+// blocks are independent so any of them can be decoded without previous ones, incomplete block
+// at the end of file is ignored
+struct BFRecHeader
+{
+    int board_id;
+    int preset;
+    int num_rows;
+    bool compressed;
+    std::string descr;
+    int64_t header_size; // offset of the first sample, filled by read and write methods
+
+    BFRecHeader () : board_id (-100), preset (0), num_rows (0), compressed (false), header_size (0)
+    {
+    }
+};
+
+inline void bfrec_put_uint32 (char *dst, uint32_t value)
+{
+    dst[0] = (char)(value & 0xFF);
+    dst[1] = (char)((value >> 8) & 0xFF);
+    dst[2] = (char)((value >> 16) & 0xFF);
+    dst[3] = (char)((value >> 24) & 0xFF);
+}
+
+inline uint32_t bfrec_get_uint32 (const char *src)
+{
+    const unsigned char *bytes = (const unsigned char *)src;
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) |
+        ((uint32_t)bytes[3] << 24);
+}
+
+// 64 bit file offsets, long is 32 bit on windows and recordings can be larger than 2 GB
+int bfrec_seek (FILE *fp, int64_t offset, int origin);
+int64_t bfrec_tell (FILE *fp);
+// checks magic of both formats and restores position in file
+bool bfrec_check_magic (FILE *fp);
+// file position should be at the beginning, leaves it at the first sample
+int bfrec_read_header (FILE *fp, BFRecHeader &header);
+int bfrec_write_header (FILE *fp, BFRecHeader &header);
+// number of complete samples in raw recording, file position is not changed
+long bfrec_get_num_samples (FILE *fp, const BFRecHeader &header);
+// compresses samples and writes them as a single block, samples are sample major
+int bfrec_write_block (
+    FILE *fp, const double *samples, int num_samples, int num_rows, std::vector<char> &buffer);
+// reads and decompresses block which starts at offset, samples are resized to fit the block
+int bfrec_read_block (FILE *fp, int64_t offset, int num_rows, std::vector<char> &bytes,
+    std::vector<double> &samples, long *num_samples);
+// conversion between native doubles and little endian bytes
+void bfrec_encode (const double *src, size_t count, char *dst);
+void bfrec_decode (const char *src, size_t count, double *dst);
+
+// reads raw and compressed recordings. Compressed files are indexed by reading block headers on
+// open, seek decodes a single block
+class BFRecReader
+{
+    FILE *fp;
+    BFRecHeader header;
+    long num_samples;
+    long position; // next sample to read
+    int64_t data_end; // offset after the last complete sample or block
+    std::vector<char> bytes;
+    // compressed recordings only
+    std::vector<int64_t> block_offsets;
+    std::vector<long> block_starts; // first sample of each block and total number of samples
+    std::vector<double> block;
+    long current_block;
+
+    int index_blocks ();
+    int load_block (long block_index);
+
+public:
+    BFRecReader ();
+    ~BFRecReader ();
+
+    // returns INVALID_ARGUMENTS_ERROR if file can not be opened or it is not a bfrec recording
+    int open (const char *file_name);
+    void close ();
+    const BFRecHeader &get_header () const
+    {
+        return header;
+    }
+    long get_num_samples () const
+    {
+        return num_samples;
+    }
+    int64_t get_data_end () const
+    {
+        return data_end;
+    }
+    int seek (long sample);
+    // sample major, returns number of samples read, 0 at the end of file
+    long read (long max_samples, double *samples);
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "bfrec_format.h"
+
+#define BFREC_INDEX_MAGIC "BFIX"
+#define BFREC_INDEX_VERSION 1
+// magic, version, num rows, timestamp channel
+#define BFREC_INDEX_HEADER_SIZE 16
+// first timestamp, last timestamp, offset, segment, num samples
+#define BFREC_INDEX_ENTRY_SIZE 32
+
+
+// segmented recording is a set of compressed bfrec files prefix_000001.bfrec, prefix_000002.bfrec
+// and so on, plus sidecar index prefix.bfidx, all numbers are little endian:
+//   char magic[4], uint32 version, int32 num_rows, int32 timestamp_channel
+//   entries of fixed size, one per block:
+//   float64 first_timestamp, float64 last_timestamp, uint64 offset, uint32 segment,
+//   uint32 num_samples
+// first and last timestamps are min and max values of timestamp channel in the block, offset
+// points to block header in segment file. Entries are written after blocks, so index never
+// points to incomplete data, incomplete entry at the end is ignored
+struct BFRecIndexEntry
+{
+    double first_timestamp;
+    double last_timestamp;
+    int64_t offset;
+    int segment;
+    int num_samples;
+
+    BFRecIndexEntry ()
+        : first_timestamp (0.0), last_timestamp (0.0), offset (0), segment (0), num_samples (0)
+    {
+    }
+};
+
+std::string bfrec_segment_file_name (const std::string &prefix, int segment);
+std::string bfrec_index_file_name (const std::string &prefix);
+int bfrec_write_index_header (FILE *fp, int num_rows, int timestamp_channel);
+int bfrec_read_index_header (FILE *fp, int *num_rows, int *timestamp_channel);
+int bfrec_write_index_entry (FILE *fp, const BFRecIndexEntry &entry);
+int bfrec_read_index_entry (FILE *fp, long entry_num, BFRecIndexEntry &entry);
+// number of complete entries, file position is not changed
+long bfrec_get_num_index_entries (FILE *fp);
+
+// reads time ranges from segmented recordings, index is searched by binary search directly in
+// file and only blocks which overlap requested range are decoded. Timestamps are expected to be
+// non decreasing, it holds for data from streamers
+class BFRecRangeReader
+{
+    FILE *index_fp;
+    FILE *segment_fp;
+    std::string prefix;
+    int num_rows;
+    int timestamp_channel;
+    long num_entries;
+    int current_segment;
+    std::vector<char> bytes;
+    std::vector<double> block;
+
+    long find_first_entry (double start_time);
+    int open_segment (int segment);
+
+public:
+    BFRecRangeReader ();
+    ~BFRecRangeReader ();
+
+    // returns INVALID_ARGUMENTS_ERROR if index can not be opened
+    int open (const char *prefix);
+    void close ();
+    int get_num_rows () const
+    {
+        return num_rows;
+    }
+    long get_num_entries () const
+    {
+        return num_entries;
+    }
+    // upper bound for number of samples in range, it reads index only
+    long get_max_samples (double start_time, double end_time);
+    // appends samples with timestamps from start_time to end_time inclusive, sample major
+    int read_range (double start_time, double end_time, std::vector<double> &samples);
+};
@@ -178,6 +178,22 @@ public:
         memcpy (origin, ptr, size0 * size1 * size2 * sizeof (T));
     }
 
+    /// take ownership of memory allocated with new T[], data is not copied
+    BrainFlowArray (std::unique_ptr<T[]> ptr, const std::array<int, Dim> &size)
+        : length (product (size)), size (size), stride (make_stride (size)), origin (ptr.release ())
+    {
+    }
+
+    /// take ownership of memory allocated with new T[], data is not copied
+    BrainFlowArray (std::unique_ptr<T[]> ptr, int size0, int size1)
+        : length (size0 * size1)
+        , size (make_array (size0, size1))
+        , stride (make_stride<2> (make_array (size0, size1)))
+        , origin (ptr.release ())
+    {
+        static_assert (Dim == 2, "This function is only for BrainFlowArray<T, 2>");
+    }
+
     BrainFlowArray (const BrainFlowArray &other)
         : length (other.length), size (other.size), stride (other.stride), origin (nullptr)
     {
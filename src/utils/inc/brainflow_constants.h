@@ -31,6 +31,7 @@ enum class BrainFlowExitCodes : int
 enum class BoardIds : int
 {
     NO_BOARD = -100, // only for internal usage
+    SHARED_MEMORY_BOARD = -4,
     PLAYBACK_FILE_BOARD = -3,
     STREAMING_BOARD = -2,
     SYNTHETIC_BOARD = -1,
@@ -90,7 +91,7 @@ enum class BoardIds : int
     NTL_AXON_BLE_BOARD = 56,
     NTL_AXON_COM_BOARD = 57,
     // use it to iterate
-    FIRST = PLAYBACK_FILE_BOARD,
+    FIRST = SHARED_MEMORY_BOARD,
     LAST = EXPLORE_PLUS_32_CHAN_BOARD
 };
 
@@ -101,6 +102,20 @@ enum class IpProtocolTypes : int
     TCP = 2
 };
 
+enum class BufferStorageTypes : int
+{
+    FLOAT64 = 0,
+    FLOAT32 = 1,
+    RAW_INT32 = 2 // adc counts for boards which provide scales, float for other channels
+};
+
+enum class PackageNumCheckTypes : int
+{
+    OFF = 0,
+    COUNT_GAPS = 1, // count gaps, wraparounds and duplicates of package num channel
+    FILL_GAPS = 2   // also insert NaN packages instead of lost ones
+};
+
 enum class FilterTypes : int
 {
     BUTTERWORTH = 0,
@@ -25,3 +25,133 @@ inline int get_brainflow_batch_size (int default_size = 3)
     }
     return size;
 }
+
+// BRAINFLOW_BUFFER_LAYOUT=channel_major makes each channel of board ring buffers contiguous, it
+// makes get_board_data a set of memcpy calls but add_data writes to num_rows different places
+inline bool is_brainflow_channel_major_layout ()
+{
+    if (const char *env_p = std::getenv ("BRAINFLOW_BUFFER_LAYOUT"))
+    {
+        return (strcmp (env_p, "channel_major") == 0);
+    }
+    return false;
+}
+
+// BRAINFLOW_BUFFER_MEMORY=hugepages backs ring buffer chunks with anonymous mmap and
+// MADV_HUGEPAGE, it reduces TLB misses for long captures but each chunk takes at least 2MB
+inline bool is_brainflow_hugepages_memory ()
+{
+    if (const char *env_p = std::getenv ("BRAINFLOW_BUFFER_MEMORY"))
+    {
+        return (strcmp (env_p, "hugepages") == 0);
+    }
+    return false;
+}
+
+// streamers work in a pool of BRAINFLOW_STREAMER_THREADS workers, each streamer has a queue of
+// BRAINFLOW_STREAMER_QUEUE_SIZE packages
+inline int get_brainflow_streamer_threads (int default_threads = 1)
+{
+    int threads = default_threads;
+    if (const char *env_p = std::getenv ("BRAINFLOW_STREAMER_THREADS"))
+    {
+        std::string str_env = env_p;
+        try
+        {
+            int parsed_threads = std::stoi (str_env);
+            if ((parsed_threads > 0) && (parsed_threads <= 16))
+            {
+                threads = parsed_threads;
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+    return threads;
+}
+
+inline int get_brainflow_streamer_queue_size (int default_size = 10000)
+{
+    int size = default_size;
+    if (const char *env_p = std::getenv ("BRAINFLOW_STREAMER_QUEUE_SIZE"))
+    {
+        std::string str_env = env_p;
+        try
+        {
+            int parsed_size = std::stoi (str_env);
+            if ((parsed_size > 0) && (parsed_size <= 86400 * 250))
+            {
+                size = parsed_size;
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+    return size;
+}
+
+// BRAINFLOW_STREAMER_POLICY=block makes read threads wait for slow streamers instead of dropping
+// packages from full streamer queues
+inline bool is_brainflow_streamer_blocking ()
+{
+    if (const char *env_p = std::getenv ("BRAINFLOW_STREAMER_POLICY"))
+    {
+        return (strcmp (env_p, "block") == 0);
+    }
+    return false;
+}
+
+// wire format of multicast streamer: BRAINFLOW_STREAM_ENCODING is f64 (default, lossless), f32 or
+// int24. Frames are limited by BRAINFLOW_STREAM_MTU and hold BRAINFLOW_STREAM_LATENCY_MS of data
+inline std::string get_brainflow_stream_encoding ()
+{
+    if (const char *env_p = std::getenv ("BRAINFLOW_STREAM_ENCODING"))
+    {
+        return env_p;
+    }
+    return "f64";
+}
+
+inline int get_brainflow_stream_mtu (int default_mtu = 1500)
+{
+    int mtu = default_mtu;
+    if (const char *env_p = std::getenv ("BRAINFLOW_STREAM_MTU"))
+    {
+        std::string str_env = env_p;
+        try
+        {
+            int parsed_mtu = std::stoi (str_env);
+            if ((parsed_mtu >= 576) && (parsed_mtu <= 65535))
+            {
+                mtu = parsed_mtu;
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+    return mtu;
+}
+
+inline int get_brainflow_stream_latency_ms (int default_latency = 20)
+{
+    int latency = default_latency;
+    if (const char *env_p = std::getenv ("BRAINFLOW_STREAM_LATENCY_MS"))
+    {
+        std::string str_env = env_p;
+        try
+        {
+            int parsed_latency = std::stoi (str_env);
+            if ((parsed_latency > 0) && (parsed_latency <= 1000))
+            {
+                latency = parsed_latency;
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+    return latency;
+}
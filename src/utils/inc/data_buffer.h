@@ -1,10 +1,92 @@
 #pragma once
 
 #include "spinlock.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-class DataBuffer
+
+enum class DataBufferLayout : int
+{
+    SAMPLE_MAJOR = 0,  // all channels of a package are stored together
+    CHANNEL_MAJOR = 1, // each channel is stored in its own ring
+};
+
+enum class DataBufferMemory : int
+{
+    HEAP = 0,      // chunks are allocated with new
+    HUGEPAGES = 1, // chunks are anonymous mmap regions with MADV_HUGEPAGE, heap on windows
+};
+
+enum class DataBufferStorage : int
+{
+    FLOAT64 = 0,
+    FLOAT32 = 1,
+    INT32 = 2, // value / scale rounded to integer, multiplied back on read, NaN is INT32_MIN
+};
+
+// how a single channel is stored, api always returns doubles
+struct ChannelStorage
+{
+    DataBufferStorage type;
+    double scale; // used only for INT32
+
+    ChannelStorage (DataBufferStorage type = DataBufferStorage::FLOAT64, double scale = 1.0)
+        : type (type), scale (scale)
+    {
+    }
+};
+
+// common interface for ring buffers which store data packages, full buffer overwrites the oldest
+// packages
+class BaseDataBuffer
+{
+public:
+    BaseDataBuffer (int num_samples)
+    {
+        this->num_samples = num_samples;
+    }
+
+    virtual ~BaseDataBuffer ()
+    {
+    }
+
+    virtual void add_data (double *value) = 0;
+    // adds count sample major packages at once
+    virtual void add_data (const double *values, size_t count) = 0;
+    virtual size_t get_data (size_t max_count, double *data_buf) = 0;
+    virtual size_t get_current_data (size_t max_count, double *data_buf) = 0;
+    virtual size_t get_data_count () = 0;
+    virtual bool is_ready () = 0;
+    // number of packages which were overwritten before get_data removed them
+    virtual uint64_t get_overwritten_count () = 0;
+
+    // the same as above but output is channel major: data_buf[channel * returned_count + package],
+    // data is written directly to data_buf without temporary buffers
+    virtual size_t get_data_by_channels (size_t max_count, double *data_buf) = 0;
+    virtual size_t get_current_data_by_channels (size_t max_count, double *data_buf) = 0;
+
+    // cursors for readers which do not remove data: position is a monotonic package number, the
+    // next package added to the buffer gets get_write_position ()
+    virtual uint64_t get_write_position () = 0;
+    // number of packages after position which are still in buffer, skipped is the number of
+    // packages after position which are already lost
+    virtual size_t get_data_count_since (uint64_t position, uint64_t *skipped) = 0;
+    // non destructive channel major read of up to max_count packages after position, lost
+    // packages are skipped and counted, position is moved past returned packages
+    virtual size_t get_data_by_channels_since (
+        uint64_t *position, size_t max_count, double *data_buf, uint64_t *skipped) = 0;
+
+protected:
+    size_t num_samples;
+
+    // copies count sample major packages to channel major output_buf with output_stride elements
+    // per channel, uses square tiles to keep both source and destination in cache
+    void transpose (size_t count, const double *buf, double *output_buf, size_t output_stride);
+};
+
+// safe to use from any number of producers and consumers
+class DataBuffer : public BaseDataBuffer
 {
 
     SpinLock lock;
@@ -13,22 +95,38 @@ class DataBuffer
     size_t buffer_size;
     size_t first_used, first_free;
     size_t count;
-    size_t num_samples;
+    uint64_t total_count; // packages added since creation
+    uint64_t overwritten_count;
+
+    // first position after given one which is not overwritten yet, caller holds the lock
+    uint64_t get_first_since (uint64_t position);
 
     size_t next (size_t index)
     {
         return (index + 1) % buffer_size;
     }
 
-    void get_chunk (size_t start, size_t size, double *data_buf);
+    void get_chunk (size_t start, size_t size, double *data_buf, bool by_channels);
+    size_t read_data (size_t max_count, double *data_buf, bool by_channels);
+    size_t read_current_data (size_t max_count, double *data_buf, bool by_channels);
 
 public:
     DataBuffer (int num_samples, size_t buffer_size);
     ~DataBuffer ();
 
     void add_data (double *value);
+    void add_data (const double *values, size_t count);
     size_t get_data (size_t max_count, double *data_buf);
     size_t get_current_data (size_t max_count, double *data_buf);
+    size_t get_data_by_channels (size_t max_count, double *data_buf);
+    size_t get_current_data_by_channels (size_t max_count, double *data_buf);
     size_t get_data_count ();
     bool is_ready ();
+    uint64_t get_overwritten_count ();
+    // like in SPSCDataBuffer cursors ignore get_data, removed packages stay readable until
+    // they are overwritten
+    uint64_t get_write_position ();
+    size_t get_data_count_since (uint64_t position, uint64_t *skipped);
+    size_t get_data_by_channels_since (
+        uint64_t *position, size_t max_count, double *data_buf, uint64_t *skipped);
 };
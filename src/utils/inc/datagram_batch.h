@@ -0,0 +1,96 @@
+#pragma once
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+#include <vector>
+
+// recvmmsg and sendmmsg are linux only, old android api levels dont have them
+#if defined(__linux__) && !defined(__ANDROID__)
+#define DATAGRAM_BATCH_USE_MMSG
+#endif
+
+#define DATAGRAM_BATCH_DEFAULT_SIZE 64
+#define DATAGRAM_BATCH_CONTROL_SIZE 64 // ancillary data with receive timestamp
+
+#ifdef _WIN32
+typedef SOCKET datagram_socket_t;
+#else
+typedef int datagram_socket_t;
+#endif
+
+
+// preallocated buffers to receive or send several udp datagrams per call, recvmmsg and sendmmsg
+// are used on linux, other platforms fall back to one call per datagram. Arrival time of each
+// datagram is taken from kernel timestamps if they are enabled for socket, otherwise it is time
+// when receive call returned
+class DatagramBatch
+{
+
+public:
+    DatagramBatch (int max_datagrams, int max_size);
+    DatagramBatch (const DatagramBatch &other) = delete;
+    DatagramBatch &operator= (const DatagramBatch &other) = delete;
+
+    int get_max_datagrams () const
+    {
+        return max_datagrams;
+    }
+    int get_max_size () const
+    {
+        return max_size;
+    }
+    int get_count () const
+    {
+        return count;
+    }
+    char *get_datagram (int i)
+    {
+        return arena.data () + (size_t)i * max_size;
+    }
+    int get_size (int i) const
+    {
+        return sizes[i];
+    }
+    // in seconds, same clock as get_timestamp ()
+    double get_arrival_time (int i) const
+    {
+        return arrival_times[i];
+    }
+    void clear ()
+    {
+        count = 0;
+    }
+    // copies datagram to batch for send, returns false if batch is full or datagram is too big
+    bool add (const void *data, int size);
+
+    // waits for the first datagram up to socket timeout and takes datagrams which are already
+    // pending without waiting, returns number of received datagrams or -1
+    int recv (datagram_socket_t sock);
+    // sends all datagrams from batch and clears it, returns number of sent datagrams or -1
+    int send (datagram_socket_t sock, const struct sockaddr_in *addr);
+
+    // asks kernel to timestamp received datagrams, SO_TIMESTAMPNS on linux and SO_TIMESTAMP on
+    // other unix systems, returns false if it's not supported
+    static bool enable_kernel_timestamps (datagram_socket_t sock);
+
+private:
+    int max_datagrams;
+    int max_size;
+    int count;
+    std::vector<char> arena;
+    std::vector<int> sizes;
+    std::vector<double> arrival_times;
+#ifndef _WIN32
+    std::vector<char> control;
+#endif
+#ifdef DATAGRAM_BATCH_USE_MMSG
+    std::vector<struct mmsghdr> msgs;
+    std::vector<struct iovec> iovecs;
+#endif
+};
@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "datagram_batch.h"
+
 
 enum class MultiCastReturnCodes : int
 {
@@ -35,6 +37,10 @@ public:
 
     int init ();
     int recv (void *data, int size);
+    // drains pending datagrams, returns number of received datagrams or -1
+    int recv_batch (DatagramBatch &batch);
+    // arrival times in batch are taken from kernel timestamps after this call
+    int enable_kernel_timestamps ();
     void close ();
 
 
@@ -16,6 +16,8 @@ public:
 
     int init ();
     int send (void *data, int size);
+    // sends all datagrams from batch and clears it, returns number of sent datagrams or -1
+    int send_batch (DatagramBatch &batch);
     void close ();
 
 private:
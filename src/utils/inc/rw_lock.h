@@ -0,0 +1,76 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+
+// reader-writer lock, std::shared_mutex is not available in c++11
+// waiting writers block new readers, so steady stream of readers can not starve them
+class RWLock
+{
+
+    std::mutex m;
+    std::condition_variable cv;
+    int readers;
+    int waiting_writers;
+    bool writer;
+
+public:
+    RWLock () : readers (0), waiting_writers (0), writer (false)
+    {
+    }
+
+    void lock ()
+    {
+        std::unique_lock<std::mutex> lk (m);
+        waiting_writers++;
+        cv.wait (lk, [this] { return (!writer) && (readers == 0); });
+        waiting_writers--;
+        writer = true;
+    }
+
+    void unlock ()
+    {
+        std::lock_guard<std::mutex> lk (m);
+        writer = false;
+        cv.notify_all ();
+    }
+
+    void lock_shared ()
+    {
+        std::unique_lock<std::mutex> lk (m);
+        cv.wait (lk, [this] { return (!writer) && (waiting_writers == 0); });
+        readers++;
+    }
+
+    void unlock_shared ()
+    {
+        std::lock_guard<std::mutex> lk (m);
+        readers--;
+        if (readers == 0)
+        {
+            cv.notify_all ();
+        }
+    }
+};
+
+// std::lock_guard analogue for shared ownership
+class SharedLockGuard
+{
+
+    RWLock &lck;
+
+public:
+    explicit SharedLockGuard (RWLock &lck) : lck (lck)
+    {
+        lck.lock_shared ();
+    }
+
+    ~SharedLockGuard ()
+    {
+        lck.unlock_shared ();
+    }
+
+    SharedLockGuard (const SharedLockGuard &) = delete;
+    SharedLockGuard &operator= (const SharedLockGuard &) = delete;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define SHARED_MEMORY_RING_MAGIC "BFSM"
+#define SHARED_MEMORY_RING_VERSION 1
+#define SHARED_MEMORY_RING_HEADER_SIZE 192
+
+
+// header of shared memory segment, followed by ring of capacity * num_rows float64 values in
+// sample major order. Writer reserves samples in write_begin, writes them and publishes them in
+// write_end, seqlock style. Readers copy samples up to write_end and drop samples which were
+// overwritten while they were copied, it's checked by write_begin loaded after the copy. Counters
+// are never reset, sample with index i is stored in slot i % capacity. Generation is 0 while
+// writer initializes header and it changes when writer is restarted
+struct SharedMemoryRingHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t num_rows;
+    int32_t board_id;
+    int32_t preset;
+    uint64_t capacity;
+    std::atomic<uint64_t> generation;
+    char pad1[24];
+    // counters are in separate cache lines
+    std::atomic<uint64_t> write_begin;
+    char pad2[56];
+    std::atomic<uint64_t> write_end;
+    char pad3[56];
+};
+
+// single writer and any number of readers in different processes on the same host, posix shared
+// memory or named file mapping on windows. Writer unlinks segment on close
+class SharedMemoryRing
+{
+
+public:
+    SharedMemoryRing ();
+    ~SharedMemoryRing ();
+
+    // recreates segment if it exists
+    int create (const char *name, int num_rows, int capacity, int board_id, int preset);
+    // maps existing segment read only, readers start from the latest sample
+    int open (const char *name);
+    void close ();
+
+    void write (const double *samples, int count);
+    // returns number of copied samples, lost is increased by samples which were overwritten
+    // before reader got them
+    int read (double *samples, int max_samples, uint64_t *lost);
+    // true if writer was restarted or segment was recreated, reader should be reopened
+    bool is_replaced ();
+
+    int get_num_rows ()
+    {
+        return (header == NULL) ? 0 : (int)header->num_rows;
+    }
+    int get_board_id ()
+    {
+        return (header == NULL) ? 0 : header->board_id;
+    }
+    int get_preset ()
+    {
+        return (header == NULL) ? 0 : header->preset;
+    }
+
+    // name of shared memory object which is used for ring name
+    static std::string get_segment_name (const char *name);
+
+private:
+    std::string name;
+    SharedMemoryRingHeader *header;
+    double *ring;
+    size_t mapping_size;
+    bool writer;
+    uint64_t generation;
+    uint64_t read_pos;
+#ifdef _WIN32
+    HANDLE mapping;
+#else
+    int fd;
+#endif
+
+    int map (bool create_segment, size_t size);
+    void copy_from_ring (uint64_t first, int count, double *samples);
+};
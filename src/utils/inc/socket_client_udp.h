@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "datagram_batch.h"
+
 
 enum class SocketClientUDPReturnCodes : int
 {
@@ -20,7 +22,8 @@ enum class SocketClientUDPReturnCodes : int
     CONNECT_ERROR = 3,
     PTON_ERROR = 4,
     INVALID_ARGUMENT_ERROR = 5,
-    SOCKET_ALREADY_CREATED_ERROR = 6
+    SOCKET_ALREADY_CREATED_ERROR = 6,
+    SET_OPT_ERROR = 7
 };
 
 
@@ -41,6 +44,11 @@ public:
     int set_timeout (int num_seconds);
     int send (const char *data, int size);
     int recv (void *data, int size);
+    // drains pending datagrams, returns number of received datagrams or -1
+    int recv_batch (DatagramBatch &batch);
+    int send_batch (DatagramBatch &batch);
+    // arrival times in batch are taken from kernel timestamps after this call
+    int enable_kernel_timestamps ();
     void close ();
     int get_local_ip_addr (const char *local_ip);
     char *get_ip_addr ()
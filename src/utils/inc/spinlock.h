@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <stdint.h>
 
 class SpinLock
 {
@@ -15,8 +16,45 @@ public:
         }
     }
 
+    inline bool try_lock ()
+    {
+        return !lck.test_and_set (std::memory_order_acquire);
+    }
+
     inline void unlock ()
     {
         lck.clear (std::memory_order_release);
     }
 };
+
+// the same but counts how many times lock was already taken by another thread
+class CountingSpinLock
+{
+
+    SpinLock lck;
+    std::atomic<uint64_t> contentions;
+
+public:
+    CountingSpinLock () : contentions (0)
+    {
+    }
+
+    inline void lock ()
+    {
+        if (!lck.try_lock ())
+        {
+            contentions.fetch_add (1, std::memory_order_relaxed);
+            lck.lock ();
+        }
+    }
+
+    inline void unlock ()
+    {
+        lck.unlock ();
+    }
+
+    inline uint64_t get_contentions ()
+    {
+        return contentions.load (std::memory_order_relaxed);
+    }
+};
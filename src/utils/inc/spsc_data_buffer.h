@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "data_buffer.h"
+
+#define BRAINFLOW_CACHE_LINE_SIZE 64
+#define BRAINFLOW_CHUNK_BYTES (2 * 1024 * 1024) // size of huge page on x86 and arm64
+
+
+// ring buffer for exactly one producer thread and one consumer thread, no locks at all.
+// add_data is wait free and overwrites the oldest packages if consumer is too slow, consumer
+// validates copied packages against producer position and retries if they were overwritten
+// during copy. head and tail are monotonic counters of packages, not indices. There is one extra
+// slot in storage, producer writes into it while the oldest package is still readable. Before
+// writing producer announces write_end, the end of packages it is going to write, so batches can
+// be written with a single head update.
+// Storage is split into chunks of chunk_slots packages, producer allocates a chunk when it writes
+// there for the first time, so memory usage is proportional to captured data instead of
+// buffer_size. Chunks are never freed before destruction, consumer reads only written slots so
+// it never sees a missing chunk.
+// Channels can be stored as float or scaled int32 to save memory and bandwidth, conversion is
+// done in the same loops which copy data in and out. 8 byte channels are placed before 4 byte
+// ones so all elements stay aligned
+class SPSCDataBuffer : public BaseDataBuffer
+{
+    // head and tail are placed in different cache lines to avoid false sharing
+    char pad0[BRAINFLOW_CACHE_LINE_SIZE];
+    std::atomic<uint64_t> head;      // written only by producer
+    std::atomic<uint64_t> write_end; // written only by producer
+    std::atomic<uint64_t> overwritten; // written only by producer
+    char pad1[BRAINFLOW_CACHE_LINE_SIZE - 3 * sizeof (std::atomic<uint64_t>)];
+    std::atomic<uint64_t> tail; // written only by consumer
+    char pad2[BRAINFLOW_CACHE_LINE_SIZE - sizeof (std::atomic<uint64_t>)];
+
+    std::atomic<char *> *chunks; // written only by producer, NULL until first write
+    size_t num_chunks;
+    size_t chunk_slots;
+    size_t slot_bytes;
+    std::vector<ChannelStorage> storage;
+    std::vector<size_t> channel_offsets; // in bytes, inside slot or inside chunk per slot
+    bool compact; // false if all channels are FLOAT64, it allows plain memcpy and transpose
+    std::atomic<size_t> committed_chunks;
+    size_t buffer_size;
+    size_t num_slots;
+    DataBufferLayout layout;
+    DataBufferMemory memory;
+
+    uint64_t get_first_available (uint64_t head_pos, uint64_t tail_pos)
+    {
+        if (head_pos - tail_pos > buffer_size)
+        {
+            return head_pos - buffer_size;
+        }
+        return tail_pos;
+    }
+
+    // readers with cursors ignore tail, data removed by get_data stays readable until overwritten
+    uint64_t get_first_since (uint64_t head_pos, uint64_t position)
+    {
+        if (position > head_pos)
+        {
+            return head_pos;
+        }
+        if (head_pos - position > buffer_size)
+        {
+            return head_pos - buffer_size;
+        }
+        return position;
+    }
+
+    // calls func (chunk, offset, len, done) for each part of ring slots [start, start + size) which
+    // is contiguous in one chunk, done is the number of packages before this part
+    template <typename Func>
+    void for_each_part (size_t start, size_t size, Func func)
+    {
+        size_t done = 0;
+        while (done < size)
+        {
+            size_t slot = (start + done) % num_slots;
+            size_t chunk = slot / chunk_slots;
+            size_t offset = slot % chunk_slots;
+            size_t len = std::min (size - done, chunk_slots - offset);
+            len = std::min (len, num_slots - slot);
+            func (chunk, offset, len, done);
+            done += len;
+        }
+    }
+
+    size_t get_element_size (size_t channel)
+    {
+        return (storage[channel].type == DataBufferStorage::FLOAT64) ? sizeof (double) : 4;
+    }
+
+    // address of the element and distance to the same channel of the next slot in chunk
+    char *get_address (char *chunk, size_t offset, size_t channel, size_t &stride)
+    {
+        if (layout == DataBufferLayout::CHANNEL_MAJOR)
+        {
+            stride = get_element_size (channel);
+            return chunk + channel_offsets[channel] * chunk_slots + offset * stride;
+        }
+        stride = slot_bytes;
+        return chunk + offset * slot_bytes + channel_offsets[channel];
+    }
+
+    void encode (size_t channel, const double *src, size_t src_stride, char *dst,
+        size_t dst_stride, size_t len);
+    void decode (size_t channel, const char *src, size_t src_stride, double *dst,
+        size_t dst_stride, size_t len);
+    char *allocate_chunk ();
+    void free_chunk (char *chunk);
+    bool commit (size_t start, size_t size);
+    void put_chunk (size_t start, size_t size, const double *values);
+    size_t read (size_t max_count, double *data_buf, bool remove, bool by_channels);
+    void get_chunk (size_t start, size_t size, double *data_buf);
+    void get_chunk_by_channels (size_t start, size_t size, double *data_buf);
+    bool is_overwritten (uint64_t first);
+
+public:
+    // empty storage means FLOAT64 for all channels, chunk_slots == 0 picks chunk size close to 2MB
+    SPSCDataBuffer (int num_samples, size_t buffer_size,
+        DataBufferLayout layout = DataBufferLayout::SAMPLE_MAJOR,
+        DataBufferMemory memory = DataBufferMemory::HEAP,
+        const std::vector<ChannelStorage> &storage = std::vector<ChannelStorage> (),
+        size_t chunk_slots = 0);
+    ~SPSCDataBuffer ();
+
+    // producer methods
+    void add_data (double *value);
+    void add_data (const double *values, size_t count);
+    // consumer methods
+    size_t get_data (size_t max_count, double *data_buf);
+    size_t get_current_data (size_t max_count, double *data_buf);
+    size_t get_data_by_channels (size_t max_count, double *data_buf);
+    size_t get_current_data_by_channels (size_t max_count, double *data_buf);
+    size_t get_data_count ();
+    bool is_ready ();
+    uint64_t get_overwritten_count ();
+    // cursor reads do not modify buffer, so any number of them can run concurrently
+    uint64_t get_write_position ();
+    size_t get_data_count_since (uint64_t position, uint64_t *skipped);
+    size_t get_data_by_channels_since (
+        uint64_t *position, size_t max_count, double *data_buf, uint64_t *skipped);
+    // can be called from any thread
+    size_t get_committed_bytes ();
+};
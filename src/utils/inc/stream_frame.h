@@ -0,0 +1,93 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#define STREAM_FRAME_MAGIC "BFST"
+#define STREAM_FRAME_VERSION 1
+#define STREAM_FRAME_HEADER_SIZE 32
+#define STREAM_FRAME_MAX_SIZE 65507 // max udp payload
+#define STREAM_FRAME_IP_UDP_OVERHEAD 28
+// late frames within this distance are counted as out of order, larger jumps back or many late
+// frames in a row mean that sender was restarted
+#define STREAM_FRAME_REORDER_WINDOW 1024
+#define STREAM_FRAME_MAX_LATE_IN_ROW 16
+
+
+// datagram of multicast streamer, all numbers are little endian:
+//   char magic[4], uint8 version, uint8 encoding, uint16 header_size, uint16 num_rows,
+//   uint16 preset, uint32 sequence, uint32 num_samples, float64 send_timestamp, uint32 reserved
+// payload starts at header_size, so fields can be added without breaking old receivers:
+//   FLOAT64: num_samples * num_rows float64 values, sample major
+//   FLOAT32: float64 base per row, num_samples * num_rows float32 offsets from base
+//   INT24: float64 base and float64 scale per row, num_samples * num_rows int24 codes,
+//   value = base + code * scale, NaN and inf are sent as NaN
+// FLOAT32 and INT24 are lossy, base keeps timestamps precise. Rows with integer values (package
+// num, markers) which fit into int24 use scale 1 and are exact
+enum class StreamFrameEncodings : uint8_t
+{
+    FLOAT64 = 0,
+    FLOAT32 = 1,
+    INT24 = 2
+};
+
+struct StreamFrameHeader
+{
+    StreamFrameEncodings encoding;
+    int num_rows;
+    int preset;
+    uint32_t sequence;
+    int num_samples;
+    double send_timestamp;
+
+    StreamFrameHeader ()
+        : encoding (StreamFrameEncodings::FLOAT64)
+        , num_rows (0)
+        , preset (0)
+        , sequence (0)
+        , num_samples (0)
+        , send_timestamp (0.0)
+    {
+    }
+};
+
+size_t stream_frame_size (StreamFrameEncodings encoding, int num_rows, int num_samples);
+// max number of samples in frame which fits into max_size bytes, at least 1
+int stream_frame_max_samples (StreamFrameEncodings encoding, int num_rows, int max_size);
+// samples are sample major, out is resized to frame size
+void stream_frame_encode (
+    const StreamFrameHeader &header, const double *samples, std::vector<char> &out);
+// returns INVALID_ARGUMENTS_ERROR if data is not a valid frame
+int stream_frame_decode_header (const char *data, size_t size, StreamFrameHeader &header);
+// samples should have space for header.num_samples * header.num_rows values
+int stream_frame_decode (
+    const char *data, size_t size, const StreamFrameHeader &header, double *samples);
+
+// counts lost and reordered frames by sequence numbers
+struct StreamFrameSequence
+{
+    uint64_t received;
+    uint64_t gaps;
+    uint64_t lost; // frames which have not arrived yet, late frames decrease it
+    uint64_t out_of_order;
+    uint64_t restarts;
+    uint32_t expected;
+    int late_in_row;
+    bool started;
+
+    StreamFrameSequence ()
+        : received (0)
+        , gaps (0)
+        , lost (0)
+        , out_of_order (0)
+        , restarts (0)
+        , expected (0)
+        , late_in_row (0)
+        , started (false)
+    {
+    }
+
+    // returns false for late frames, their data is older than data which is pushed already
+    bool check (uint32_t sequence);
+};
@@ -3,6 +3,21 @@
 #include "multicast_client.h"
 #include "socket_client_udp.h"
 
+
+int MultiCastClient::recv_batch (DatagramBatch &batch)
+{
+    return batch.recv (client_socket);
+}
+
+int MultiCastClient::enable_kernel_timestamps ()
+{
+    if (!DatagramBatch::enable_kernel_timestamps (client_socket))
+    {
+        return (int)MultiCastReturnCodes::SET_OPT_ERROR;
+    }
+    return (int)MultiCastReturnCodes::STATUS_OK;
+}
+
 ///////////////////////////////
 /////////// WINDOWS ///////////
 //////////////////////////////
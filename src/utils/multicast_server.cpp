@@ -1,6 +1,12 @@
 #include "multicast_server.h"
 
 
+int MultiCastServer::send_batch (DatagramBatch &batch)
+{
+    return batch.send (server_socket, &server_addr);
+}
+
+
 ///////////////////////////////
 /////////// WINDOWS ///////////
 //////////////////////////////
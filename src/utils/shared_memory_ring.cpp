@@ -0,0 +1,390 @@
+#include <algorithm>
+#include <string.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "brainflow_constants.h"
+#include "shared_memory_ring.h"
+#include "timestamp.h"
+
+static_assert (sizeof (SharedMemoryRingHeader) == SHARED_MEMORY_RING_HEADER_SIZE,
+    "shared memory header layout is a part of the format");
+
+
+static bool is_valid_name (const char *name)
+{
+    if ((name == NULL) || (name[0] == '\0') || (strlen (name) > 200))
+    {
+        return false;
+    }
+    return (strchr (name, '/') == NULL) && (strchr (name, '\\') == NULL);
+}
+
+#if !defined(_WIN32) && !defined(__ANDROID__)
+// name can be unlinked and reused by another writer while old segment is still mapped
+static bool is_segment_replaced (int fd, const std::string &segment)
+{
+    int new_fd = shm_open (segment.c_str (), O_RDONLY, 0);
+    if (new_fd < 0)
+    {
+        return false;
+    }
+    struct stat old_st;
+    struct stat new_st;
+    bool replaced = (fstat (fd, &old_st) == 0) && (fstat (new_fd, &new_st) == 0) &&
+        ((old_st.st_ino != new_st.st_ino) || (old_st.st_dev != new_st.st_dev));
+    ::close (new_fd);
+    return replaced;
+}
+#endif
+
+std::string SharedMemoryRing::get_segment_name (const char *name)
+{
+#ifdef _WIN32
+    return std::string ("Local\\brainflow_") + name;
+#else
+    return std::string ("/brainflow_") + name;
+#endif
+}
+
+SharedMemoryRing::SharedMemoryRing ()
+{
+    header = NULL;
+    ring = NULL;
+    mapping_size = 0;
+    writer = false;
+    generation = 0;
+    read_pos = 0;
+#ifdef _WIN32
+    mapping = NULL;
+#else
+    fd = -1;
+#endif
+}
+
+SharedMemoryRing::~SharedMemoryRing ()
+{
+    close ();
+}
+
+int SharedMemoryRing::create (
+    const char *name, int num_rows, int capacity, int board_id, int preset)
+{
+    close ();
+    if ((!is_valid_name (name)) || (num_rows <= 0) || (capacity <= 0))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    this->name = name;
+    writer = true;
+    size_t size = SHARED_MEMORY_RING_HEADER_SIZE + (size_t)capacity * num_rows * sizeof (double);
+    int res = map (true, size);
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        close ();
+        return res;
+    }
+    // readers dont use header until generation is set
+    header->generation.store (0, std::memory_order_release);
+    memcpy (header->magic, SHARED_MEMORY_RING_MAGIC, 4);
+    header->version = SHARED_MEMORY_RING_VERSION;
+    header->header_size = SHARED_MEMORY_RING_HEADER_SIZE;
+    header->num_rows = (uint32_t)num_rows;
+    header->board_id = board_id;
+    header->preset = preset;
+    header->capacity = (uint64_t)capacity;
+    header->write_begin.store (0, std::memory_order_relaxed);
+    header->write_end.store (0, std::memory_order_relaxed);
+    ring = (double *)((char *)header + SHARED_MEMORY_RING_HEADER_SIZE);
+    generation = (uint64_t)(get_timestamp () * 1000000.0);
+    header->generation.store (generation, std::memory_order_release);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int SharedMemoryRing::open (const char *name)
+{
+    close ();
+    if (!is_valid_name (name))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    this->name = name;
+    writer = false;
+    int res = map (false, 0);
+    if (res == (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        generation = header->generation.load (std::memory_order_acquire);
+        if ((generation == 0) || (memcmp (header->magic, SHARED_MEMORY_RING_MAGIC, 4) != 0) ||
+            (header->version != SHARED_MEMORY_RING_VERSION) ||
+            (header->header_size < SHARED_MEMORY_RING_HEADER_SIZE) || (header->num_rows == 0) ||
+            (header->capacity == 0) ||
+            (header->header_size + header->capacity * header->num_rows * sizeof (double) >
+                mapping_size))
+        {
+            res = (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+    }
+    if (res != (int)BrainFlowExitCodes::STATUS_OK)
+    {
+        close ();
+        return res;
+    }
+    ring = (double *)((char *)header + header->header_size);
+    read_pos = header->write_end.load (std::memory_order_acquire);
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void SharedMemoryRing::write (const double *samples, int count)
+{
+    if ((!writer) || (header == NULL) || (count <= 0))
+    {
+        return;
+    }
+    uint64_t capacity = header->capacity;
+    size_t num_rows = header->num_rows;
+    uint64_t end = header->write_end.load (std::memory_order_relaxed);
+    uint64_t new_end = end + count;
+    header->write_begin.store (new_end, std::memory_order_relaxed);
+    // reservation is visible before any sample in ring is changed
+    std::atomic_thread_fence (std::memory_order_release);
+    // samples which dont fit into ring would be overwritten right away
+    int skip = ((uint64_t)count > capacity) ? (int)(count - capacity) : 0;
+    uint64_t first = end + skip;
+    int done = skip;
+    while (done < count)
+    {
+        size_t slot = (size_t)(first % capacity);
+        int chunk = (int)std::min<uint64_t> (count - done, capacity - slot);
+        memcpy (ring + slot * num_rows, samples + (size_t)done * num_rows,
+            sizeof (double) * num_rows * chunk);
+        done += chunk;
+        first += chunk;
+    }
+    header->write_end.store (new_end, std::memory_order_release);
+}
+
+void SharedMemoryRing::copy_from_ring (uint64_t first, int count, double *samples)
+{
+    uint64_t capacity = header->capacity;
+    size_t num_rows = header->num_rows;
+    int done = 0;
+    while (done < count)
+    {
+        size_t slot = (size_t)(first % capacity);
+        int chunk = (int)std::min<uint64_t> (count - done, capacity - slot);
+        memcpy (samples + (size_t)done * num_rows, ring + slot * num_rows,
+            sizeof (double) * num_rows * chunk);
+        done += chunk;
+        first += chunk;
+    }
+}
+
+int SharedMemoryRing::read (double *samples, int max_samples, uint64_t *lost)
+{
+    if ((writer) || (header == NULL) || (max_samples <= 0) ||
+        (header->generation.load (std::memory_order_acquire) != generation))
+    {
+        return 0;
+    }
+    uint64_t capacity = header->capacity;
+    size_t num_rows = header->num_rows;
+    uint64_t end = header->write_end.load (std::memory_order_acquire);
+    if (end < read_pos)
+    {
+        read_pos = end;
+        return 0;
+    }
+    uint64_t first = read_pos;
+    if (end - first > capacity)
+    {
+        *lost += end - capacity - first;
+        first = end - capacity;
+    }
+    int count = (int)std::min<uint64_t> (end - first, (uint64_t)max_samples);
+    if (count == 0)
+    {
+        return 0;
+    }
+    copy_from_ring (first, count, samples);
+    std::atomic_thread_fence (std::memory_order_acquire);
+    uint64_t begin = header->write_begin.load (std::memory_order_relaxed);
+    if (header->generation.load (std::memory_order_relaxed) != generation)
+    {
+        return 0;
+    }
+    read_pos = first + count;
+    // slots of samples before oldest_valid could be reused by writer during the copy
+    uint64_t oldest_valid = (begin > capacity) ? begin - capacity : 0;
+    if (first >= oldest_valid)
+    {
+        return count;
+    }
+    int overwritten = (int)std::min<uint64_t> (oldest_valid - first, (uint64_t)count);
+    *lost += overwritten;
+    memmove (samples, samples + (size_t)overwritten * num_rows,
+        sizeof (double) * num_rows * (count - overwritten));
+    return count - overwritten;
+}
+
+bool SharedMemoryRing::is_replaced ()
+{
+    if (header == NULL)
+    {
+        return true;
+    }
+    if (header->generation.load (std::memory_order_acquire) != generation)
+    {
+        return true;
+    }
+#if !defined(_WIN32) && !defined(__ANDROID__)
+    // new writer creates new segment with the same name, old one stays mapped until it's closed
+    if ((!writer) && (is_segment_replaced (fd, get_segment_name (name.c_str ()))))
+    {
+        return true;
+    }
+#endif
+    return false;
+}
+
+///////////////////////////////
+/////////// WINDOWS ///////////
+//////////////////////////////
+#ifdef _WIN32
+
+int SharedMemoryRing::map (bool create_segment, size_t size)
+{
+    std::string segment = get_segment_name (name.c_str ());
+    void *view = NULL;
+    if (create_segment)
+    {
+        // existing mapping is reused if readers still have it open, it can't be resized
+        mapping = CreateFileMappingA (INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+            (DWORD)((uint64_t)size >> 32), (DWORD)(size & 0xFFFFFFFF), segment.c_str ());
+        if (mapping == NULL)
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        view = MapViewOfFile (mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    }
+    else
+    {
+        mapping = OpenFileMappingA (FILE_MAP_READ, FALSE, segment.c_str ());
+        if (mapping == NULL)
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        view = MapViewOfFile (mapping, FILE_MAP_READ, 0, 0, 0);
+        MEMORY_BASIC_INFORMATION info;
+        if ((view != NULL) && (VirtualQuery (view, &info, sizeof (info)) != 0))
+        {
+            size = info.RegionSize;
+        }
+    }
+    if ((view == NULL) || (size < SHARED_MEMORY_RING_HEADER_SIZE))
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    header = (SharedMemoryRingHeader *)view;
+    mapping_size = size;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+void SharedMemoryRing::close ()
+{
+    if (header != NULL)
+    {
+        UnmapViewOfFile (header);
+        header = NULL;
+    }
+    if (mapping != NULL)
+    {
+        CloseHandle (mapping);
+        mapping = NULL;
+    }
+    ring = NULL;
+    mapping_size = 0;
+    writer = false;
+    generation = 0;
+    read_pos = 0;
+}
+
+///////////////////////////////
+//////////// UNIX /////////////
+///////////////////////////////
+#else
+
+int SharedMemoryRing::map (bool create_segment, size_t size)
+{
+#ifdef __ANDROID__
+    // no posix shared memory in bionic
+    return (int)BrainFlowExitCodes::UNSUPPORTED_BOARD_ERROR;
+#else
+    std::string segment = get_segment_name (name.c_str ());
+    if (create_segment)
+    {
+        // readers of the previous segment keep it mapped and detect new one by inode
+        shm_unlink (segment.c_str ());
+        fd = shm_open (segment.c_str (), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if ((fd < 0) || (ftruncate (fd, (off_t)size) != 0))
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+    }
+    else
+    {
+        fd = shm_open (segment.c_str (), O_RDONLY, 0);
+        struct stat st;
+        if ((fd < 0) || (fstat (fd, &st) != 0))
+        {
+            return (int)BrainFlowExitCodes::GENERAL_ERROR;
+        }
+        size = (size_t)st.st_size;
+    }
+    if (size < SHARED_MEMORY_RING_HEADER_SIZE)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    int prot = create_segment ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void *view = mmap (NULL, size, prot, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        return (int)BrainFlowExitCodes::GENERAL_ERROR;
+    }
+    header = (SharedMemoryRingHeader *)view;
+    mapping_size = size;
+    return (int)BrainFlowExitCodes::STATUS_OK;
+#endif
+}
+
+void SharedMemoryRing::close ()
+{
+    if (header != NULL)
+    {
+        munmap ((void *)header, mapping_size);
+        header = NULL;
+    }
+    if (fd >= 0)
+    {
+#ifndef __ANDROID__
+        std::string segment = get_segment_name (name.c_str ());
+        if ((writer) && (!is_segment_replaced (fd, segment)))
+        {
+            shm_unlink (segment.c_str ());
+        }
+#endif
+        ::close (fd);
+        fd = -1;
+    }
+    ring = NULL;
+    mapping_size = 0;
+    writer = false;
+    generation = 0;
+    read_pos = 0;
+}
+
+#endif
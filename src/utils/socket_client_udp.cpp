@@ -2,6 +2,26 @@
 
 #include "socket_client_udp.h"
 
+
+int SocketClientUDP::recv_batch (DatagramBatch &batch)
+{
+    return batch.recv (connect_socket);
+}
+
+int SocketClientUDP::send_batch (DatagramBatch &batch)
+{
+    return batch.send (connect_socket, &socket_addr);
+}
+
+int SocketClientUDP::enable_kernel_timestamps ()
+{
+    if (!DatagramBatch::enable_kernel_timestamps (connect_socket))
+    {
+        return (int)SocketClientUDPReturnCodes::SET_OPT_ERROR;
+    }
+    return (int)SocketClientUDPReturnCodes::STATUS_OK;
+}
+
 ///////////////////////////////
 /////////// WINDOWS ///////////
 //////////////////////////////
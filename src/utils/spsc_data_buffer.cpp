@@ -0,0 +1,552 @@
+#include "spsc_data_buffer.h"
+
+#include <cmath>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+
+SPSCDataBuffer::SPSCDataBuffer (int num_samples, size_t buffer_size, DataBufferLayout layout,
+    DataBufferMemory memory, const std::vector<ChannelStorage> &storage, size_t chunk_slots)
+    : BaseDataBuffer (num_samples)
+{
+    this->buffer_size = buffer_size;
+    this->num_slots = buffer_size + 1;
+    this->layout = layout;
+    this->memory = memory;
+    head.store (0, std::memory_order_relaxed);
+    write_end.store (0, std::memory_order_relaxed);
+    overwritten.store (0, std::memory_order_relaxed);
+    tail.store (0, std::memory_order_relaxed);
+    committed_chunks.store (0, std::memory_order_relaxed);
+    chunks = NULL;
+    num_chunks = 0;
+    this->chunk_slots = 0;
+    slot_bytes = 0;
+    compact = false;
+
+    if ((buffer_size == 0) || (num_slots == 0) || (num_samples <= 0) ||
+        ((!storage.empty ()) && (storage.size () != (size_t)num_samples)))
+    {
+        return;
+    }
+    this->storage = storage;
+    this->storage.resize (num_samples);
+    channel_offsets.resize (num_samples);
+    bool has_doubles = false;
+    for (size_t j = 0; j < this->storage.size (); j++)
+    {
+        if (this->storage[j].type == DataBufferStorage::FLOAT64)
+        {
+            channel_offsets[j] = slot_bytes;
+            slot_bytes += sizeof (double);
+            has_doubles = true;
+        }
+    }
+    for (size_t j = 0; j < this->storage.size (); j++)
+    {
+        if (this->storage[j].type != DataBufferStorage::FLOAT64)
+        {
+            channel_offsets[j] = slot_bytes;
+            slot_bytes += 4;
+            compact = true;
+        }
+    }
+    // keep the next slot aligned for doubles
+    if ((has_doubles) && (slot_bytes % sizeof (double) != 0))
+    {
+        slot_bytes += sizeof (double) - slot_bytes % sizeof (double);
+    }
+    if (chunk_slots == 0)
+    {
+        chunk_slots = std::max ((size_t)1, BRAINFLOW_CHUNK_BYTES / slot_bytes);
+    }
+    this->chunk_slots = std::min (chunk_slots, num_slots);
+    num_chunks = (num_slots + this->chunk_slots - 1) / this->chunk_slots;
+    // check that storage size fits into size_t, memory itself is allocated later
+    if (num_slots > SIZE_MAX / slot_bytes)
+    {
+        return;
+    }
+    try
+    {
+        chunks = new std::atomic<char *>[num_chunks];
+    }
+    catch (const std::bad_alloc &)
+    {
+        chunks = NULL;
+        return;
+    }
+    for (size_t i = 0; i < num_chunks; i++)
+    {
+        chunks[i].store (NULL, std::memory_order_relaxed);
+    }
+}
+
+SPSCDataBuffer::~SPSCDataBuffer ()
+{
+    if (chunks != NULL)
+    {
+        for (size_t i = 0; i < num_chunks; i++)
+        {
+            free_chunk (chunks[i].load (std::memory_order_relaxed));
+        }
+        delete[] chunks;
+    }
+}
+
+char *SPSCDataBuffer::allocate_chunk ()
+{
+    size_t chunk_bytes = chunk_slots * slot_bytes;
+#if !defined(_WIN32) && defined(MAP_ANONYMOUS)
+    if (memory == DataBufferMemory::HUGEPAGES)
+    {
+        // huge pages require aligned address, map more and trim both ends
+        size_t len = (chunk_bytes + BRAINFLOW_CHUNK_BYTES - 1) / BRAINFLOW_CHUNK_BYTES *
+            BRAINFLOW_CHUNK_BYTES;
+        void *ptr = mmap (NULL, len + BRAINFLOW_CHUNK_BYTES, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+        {
+            return NULL;
+        }
+        uintptr_t start = (uintptr_t)ptr;
+        uintptr_t aligned =
+            (start + BRAINFLOW_CHUNK_BYTES - 1) / BRAINFLOW_CHUNK_BYTES * BRAINFLOW_CHUNK_BYTES;
+        if (aligned > start)
+        {
+            munmap (ptr, aligned - start);
+        }
+        if (start + BRAINFLOW_CHUNK_BYTES > aligned)
+        {
+            munmap ((void *)(aligned + len), start + BRAINFLOW_CHUNK_BYTES - aligned);
+        }
+#ifdef MADV_HUGEPAGE
+        madvise ((void *)aligned, len, MADV_HUGEPAGE); // only a hint, ignore errors
+#endif
+        return (char *)aligned;
+    }
+#endif
+    try
+    {
+        return new char[chunk_bytes];
+    }
+    catch (const std::bad_alloc &)
+    {
+        return NULL;
+    }
+}
+
+void SPSCDataBuffer::free_chunk (char *chunk)
+{
+    if (chunk == NULL)
+    {
+        return;
+    }
+#if !defined(_WIN32) && defined(MAP_ANONYMOUS)
+    if (memory == DataBufferMemory::HUGEPAGES)
+    {
+        size_t chunk_bytes = chunk_slots * slot_bytes;
+        size_t len = (chunk_bytes + BRAINFLOW_CHUNK_BYTES - 1) / BRAINFLOW_CHUNK_BYTES *
+            BRAINFLOW_CHUNK_BYTES;
+        munmap (chunk, len);
+        return;
+    }
+#endif
+    delete[] chunk;
+}
+
+// producer only, allocates chunks for slots which are going to be written
+bool SPSCDataBuffer::commit (size_t start, size_t size)
+{
+    bool res = true;
+    for_each_part (start, size, [this, &res] (size_t chunk, size_t, size_t, size_t) {
+        if ((res) && (chunks[chunk].load (std::memory_order_relaxed) == NULL))
+        {
+            char *ptr = allocate_chunk ();
+            if (ptr == NULL)
+            {
+                res = false;
+                return;
+            }
+            // published to consumer by release store of head
+            chunks[chunk].store (ptr, std::memory_order_relaxed);
+            committed_chunks.fetch_add (1, std::memory_order_relaxed);
+        }
+    });
+    return res;
+}
+
+size_t SPSCDataBuffer::get_committed_bytes ()
+{
+    return committed_chunks.load (std::memory_order_relaxed) * chunk_slots * slot_bytes;
+}
+
+bool SPSCDataBuffer::is_ready ()
+{
+    return (chunks != NULL);
+}
+
+void SPSCDataBuffer::add_data (double *value)
+{
+    add_data (value, 1);
+}
+
+void SPSCDataBuffer::add_data (const double *values, size_t count)
+{
+    if ((!is_ready ()) || (count == 0))
+    {
+        return;
+    }
+
+    uint64_t head_pos = head.load (std::memory_order_relaxed);
+    // only the newest buffer_size packages survive, skip the rest but count them
+    size_t skipped = 0;
+    if (count > buffer_size)
+    {
+        skipped = count - buffer_size;
+    }
+    size_t start = (size_t)((head_pos + skipped) % num_slots);
+    if (!commit (start, count - skipped))
+    {
+        return; // out of memory, drop packages but keep already stored data consistent
+    }
+    write_end.store (head_pos + count, std::memory_order_relaxed);
+    // write_end should be visible before we start to overwrite slots, consumer relies on it to
+    // detect packages overwritten during copy
+    std::atomic_thread_fence (std::memory_order_release);
+    put_chunk (start, count - skipped, values + skipped * num_samples);
+    head.store (head_pos + count, std::memory_order_release);
+
+    // packages before lost_end are not readable anymore, count those which were not removed
+    if (head_pos + count > buffer_size)
+    {
+        uint64_t lost_end = head_pos + count - buffer_size;
+        uint64_t lost_start = tail.load (std::memory_order_acquire);
+        if ((head_pos > buffer_size) && (lost_start < head_pos - buffer_size))
+        {
+            lost_start = head_pos - buffer_size; // counted by previous calls
+        }
+        if (lost_end > lost_start)
+        {
+            overwritten.store (overwritten.load (std::memory_order_relaxed) + lost_end - lost_start,
+                std::memory_order_relaxed);
+        }
+    }
+}
+
+void SPSCDataBuffer::encode (
+    size_t channel, const double *src, size_t src_stride, char *dst, size_t dst_stride, size_t len)
+{
+    switch (storage[channel].type)
+    {
+        case DataBufferStorage::FLOAT64:
+            for (size_t i = 0; i < len; i++)
+            {
+                *(double *)(dst + i * dst_stride) = src[i * src_stride];
+            }
+            break;
+        case DataBufferStorage::FLOAT32:
+            for (size_t i = 0; i < len; i++)
+            {
+                *(float *)(dst + i * dst_stride) = (float)src[i * src_stride];
+            }
+            break;
+        case DataBufferStorage::INT32:
+        {
+            double scale = storage[channel].scale;
+            for (size_t i = 0; i < len; i++)
+            {
+                double counts = src[i * src_stride] / scale;
+                int32_t value = INT32_MIN;
+                if (!std::isnan (counts))
+                {
+                    counts = std::max (counts, (double)(INT32_MIN + 1));
+                    counts = std::min (counts, (double)INT32_MAX);
+                    value = (int32_t)std::llround (counts);
+                }
+                *(int32_t *)(dst + i * dst_stride) = value;
+            }
+            break;
+        }
+    }
+}
+
+void SPSCDataBuffer::decode (
+    size_t channel, const char *src, size_t src_stride, double *dst, size_t dst_stride, size_t len)
+{
+    switch (storage[channel].type)
+    {
+        case DataBufferStorage::FLOAT64:
+            for (size_t i = 0; i < len; i++)
+            {
+                dst[i * dst_stride] = *(const double *)(src + i * src_stride);
+            }
+            break;
+        case DataBufferStorage::FLOAT32:
+            for (size_t i = 0; i < len; i++)
+            {
+                dst[i * dst_stride] = (double)*(const float *)(src + i * src_stride);
+            }
+            break;
+        case DataBufferStorage::INT32:
+        {
+            double scale = storage[channel].scale;
+            for (size_t i = 0; i < len; i++)
+            {
+                int32_t value = *(const int32_t *)(src + i * src_stride);
+                dst[i * dst_stride] = (value == INT32_MIN) ? std::nan ("") : value * scale;
+            }
+            break;
+        }
+    }
+}
+
+// input is sample major
+void SPSCDataBuffer::put_chunk (size_t start, size_t size, const double *values)
+{
+    for_each_part (start, size, [this, values] (size_t chunk, size_t offset, size_t len,
+                                    size_t done) {
+        char *dst = chunks[chunk].load (std::memory_order_relaxed);
+        const double *src = values + done * num_samples;
+        if (compact)
+        {
+            for (size_t j = 0; j < num_samples; j++)
+            {
+                size_t stride = 0;
+                char *element = get_address (dst, offset, j, stride);
+                encode (j, src + j, num_samples, element, stride, len);
+            }
+        }
+        else if (layout == DataBufferLayout::CHANNEL_MAJOR)
+        {
+            for (size_t j = 0; j < num_samples; j++)
+            {
+                double *channel = (double *)dst + j * chunk_slots + offset;
+                for (size_t i = 0; i < len; i++)
+                {
+                    channel[i] = src[i * num_samples + j];
+                }
+            }
+        }
+        else
+        {
+            memcpy ((double *)dst + offset * num_samples, src,
+                len * sizeof (double) * num_samples);
+        }
+    });
+}
+
+// output is sample major
+void SPSCDataBuffer::get_chunk (size_t start, size_t size, double *data_buf)
+{
+    for_each_part (start, size, [this, data_buf] (size_t chunk, size_t offset, size_t len,
+                                    size_t done) {
+        char *src = chunks[chunk].load (std::memory_order_relaxed);
+        double *dst = data_buf + done * num_samples;
+        if (compact)
+        {
+            for (size_t j = 0; j < num_samples; j++)
+            {
+                size_t stride = 0;
+                const char *element = get_address (src, offset, j, stride);
+                decode (j, element, stride, dst + j, num_samples, len);
+            }
+        }
+        else if (layout == DataBufferLayout::CHANNEL_MAJOR)
+        {
+            const double *channels = (const double *)src;
+            for (size_t i = 0; i < len; i++)
+            {
+                for (size_t j = 0; j < num_samples; j++)
+                {
+                    dst[i * num_samples + j] = channels[j * chunk_slots + offset + i];
+                }
+            }
+        }
+        else
+        {
+            memcpy (dst, (const double *)src + offset * num_samples,
+                len * sizeof (double) * num_samples);
+        }
+    });
+}
+
+// output is channel major, for channel major layout it is one memcpy per channel and chunk, for
+// sample major layout each contiguous part of the ring is transposed directly to data_buf
+void SPSCDataBuffer::get_chunk_by_channels (size_t start, size_t size, double *data_buf)
+{
+    for_each_part (start, size, [this, data_buf, size] (size_t chunk, size_t offset, size_t len,
+                                    size_t done) {
+        char *src = chunks[chunk].load (std::memory_order_relaxed);
+        if (compact)
+        {
+            for (size_t j = 0; j < num_samples; j++)
+            {
+                size_t stride = 0;
+                const char *element = get_address (src, offset, j, stride);
+                decode (j, element, stride, data_buf + j * size + done, 1, len);
+            }
+        }
+        else if (layout == DataBufferLayout::CHANNEL_MAJOR)
+        {
+            for (size_t j = 0; j < num_samples; j++)
+            {
+                memcpy (data_buf + j * size + done, (const double *)src + j * chunk_slots + offset,
+                    len * sizeof (double));
+            }
+        }
+        else
+        {
+            transpose (len, (const double *)src + offset * num_samples, data_buf + done, size);
+        }
+    });
+}
+
+// producer may write packages from head to write_end right now, they use the same slots as
+// packages which are num_slots older, so everything starting from first is valid only if first is
+// not older than write_end - num_slots
+bool SPSCDataBuffer::is_overwritten (uint64_t first)
+{
+    std::atomic_thread_fence (std::memory_order_acquire);
+    uint64_t write_end_pos = write_end.load (std::memory_order_relaxed);
+    return (write_end_pos > first + num_slots);
+}
+
+// remove == true returns the oldest packages and removes them, otherwise returns the newest
+size_t SPSCDataBuffer::read (size_t max_count, double *data_buf, bool remove, bool by_channels)
+{
+    if (!is_ready ())
+    {
+        return 0;
+    }
+
+    uint64_t tail_pos = tail.load (std::memory_order_relaxed);
+    uint64_t first = 0;
+    size_t result_count = 0;
+    do
+    {
+        uint64_t head_pos = head.load (std::memory_order_acquire);
+        uint64_t first_available = get_first_available (head_pos, tail_pos);
+        result_count = max_count;
+        if (result_count > head_pos - first_available)
+        {
+            result_count = (size_t)(head_pos - first_available);
+        }
+        if (result_count == 0)
+        {
+            return 0;
+        }
+        first = remove ? first_available : head_pos - result_count;
+        if (by_channels)
+        {
+            get_chunk_by_channels ((size_t)(first % num_slots), result_count, data_buf);
+        }
+        else
+        {
+            get_chunk ((size_t)(first % num_slots), result_count, data_buf);
+        }
+    } while (is_overwritten (first));
+
+    if (remove)
+    {
+        tail.store (first + result_count, std::memory_order_release);
+    }
+    return result_count;
+}
+
+// Removes data from buffer
+size_t SPSCDataBuffer::get_data (size_t max_count, double *data_buf)
+{
+    return read (max_count, data_buf, true, false);
+}
+
+// Doesn't remove data from buffer
+size_t SPSCDataBuffer::get_current_data (size_t max_count, double *data_buf)
+{
+    return read (max_count, data_buf, false, false);
+}
+
+size_t SPSCDataBuffer::get_data_by_channels (size_t max_count, double *data_buf)
+{
+    return read (max_count, data_buf, true, true);
+}
+
+size_t SPSCDataBuffer::get_current_data_by_channels (size_t max_count, double *data_buf)
+{
+    return read (max_count, data_buf, false, true);
+}
+
+size_t SPSCDataBuffer::get_data_count ()
+{
+    if (!is_ready ())
+    {
+        return 0;
+    }
+    uint64_t head_pos = head.load (std::memory_order_acquire);
+    uint64_t tail_pos = tail.load (std::memory_order_acquire);
+    return (size_t)(head_pos - get_first_available (head_pos, tail_pos));
+}
+
+uint64_t SPSCDataBuffer::get_overwritten_count ()
+{
+    return overwritten.load (std::memory_order_relaxed);
+}
+
+uint64_t SPSCDataBuffer::get_write_position ()
+{
+    return head.load (std::memory_order_acquire);
+}
+
+size_t SPSCDataBuffer::get_data_count_since (uint64_t position, uint64_t *skipped)
+{
+    *skipped = 0;
+    if (!is_ready ())
+    {
+        return 0;
+    }
+    uint64_t head_pos = head.load (std::memory_order_acquire);
+    uint64_t first = get_first_since (head_pos, position);
+    if (first > position)
+    {
+        *skipped = first - position;
+    }
+    return (size_t)(head_pos - first);
+}
+
+size_t SPSCDataBuffer::get_data_by_channels_since (
+    uint64_t *position, size_t max_count, double *data_buf, uint64_t *skipped)
+{
+    *skipped = 0;
+    if (!is_ready ())
+    {
+        return 0;
+    }
+
+    uint64_t first = 0;
+    size_t result_count = 0;
+    do
+    {
+        uint64_t head_pos = head.load (std::memory_order_acquire);
+        first = get_first_since (head_pos, *position);
+        result_count = max_count;
+        if (result_count > head_pos - first)
+        {
+            result_count = (size_t)(head_pos - first);
+        }
+        if (result_count == 0)
+        {
+            break;
+        }
+        get_chunk_by_channels ((size_t)(first % num_slots), result_count, data_buf);
+    } while (is_overwritten (first));
+
+    if (first > *position)
+    {
+        *skipped = first - *position;
+    }
+    *position = first + result_count;
+    return result_count;
+}
@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string.h>
+
+#include "brainflow_constants.h"
+#include "stream_frame.h"
+
+#define INT24_MAX_CODE 8388607
+#define INT24_NAN_CODE (-8388608)
+
+
+static void put_uint (char *dst, uint64_t value, int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        dst[i] = (char)((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static uint64_t get_uint (const char *src, int size)
+{
+    const unsigned char *bytes = (const unsigned char *)src;
+    uint64_t value = 0;
+    for (int i = 0; i < size; i++)
+    {
+        value |= (uint64_t)bytes[i] << (8 * i);
+    }
+    return value;
+}
+
+static void put_double (char *dst, double value)
+{
+    uint64_t bits;
+    memcpy (&bits, &value, sizeof (bits));
+    put_uint (dst, bits, 8);
+}
+
+static double get_double (const char *src)
+{
+    uint64_t bits = get_uint (src, 8);
+    double value;
+    memcpy (&value, &bits, sizeof (value));
+    return value;
+}
+
+static void put_float (char *dst, float value)
+{
+    uint32_t bits;
+    memcpy (&bits, &value, sizeof (bits));
+    put_uint (dst, bits, 4);
+}
+
+static float get_float (const char *src)
+{
+    uint32_t bits = (uint32_t)get_uint (src, 4);
+    float value;
+    memcpy (&value, &bits, sizeof (value));
+    return value;
+}
+
+// bytes of per row params and bytes per value
+static void get_encoding_sizes (
+    StreamFrameEncodings encoding, size_t *row_bytes, size_t *value_bytes)
+{
+    switch (encoding)
+    {
+        case StreamFrameEncodings::FLOAT32:
+            *row_bytes = 8;
+            *value_bytes = 4;
+            break;
+        case StreamFrameEncodings::INT24:
+            *row_bytes = 16;
+            *value_bytes = 3;
+            break;
+        default:
+            *row_bytes = 0;
+            *value_bytes = 8;
+            break;
+    }
+}
+
+size_t stream_frame_size (StreamFrameEncodings encoding, int num_rows, int num_samples)
+{
+    size_t row_bytes = 0;
+    size_t value_bytes = 0;
+    get_encoding_sizes (encoding, &row_bytes, &value_bytes);
+    return STREAM_FRAME_HEADER_SIZE + row_bytes * num_rows +
+        value_bytes * (size_t)num_rows * num_samples;
+}
+
+int stream_frame_max_samples (StreamFrameEncodings encoding, int num_rows, int max_size)
+{
+    size_t row_bytes = 0;
+    size_t value_bytes = 0;
+    get_encoding_sizes (encoding, &row_bytes, &value_bytes);
+    long space = (long)max_size - STREAM_FRAME_HEADER_SIZE - (long)(row_bytes * num_rows);
+    long max_samples = space / (long)(value_bytes * num_rows);
+    return (max_samples < 1) ? 1 : (int)max_samples;
+}
+
+// base and scale of int24 codes for a single row
+static void get_int24_params (
+    const double *samples, int num_samples, int num_rows, int row, double *base, double *scale)
+{
+    double min_value = std::numeric_limits<double>::infinity ();
+    double max_value = -std::numeric_limits<double>::infinity ();
+    bool integers = true;
+    for (int i = 0; i < num_samples; i++)
+    {
+        double value = samples[i * num_rows + row];
+        if (!std::isfinite (value))
+        {
+            continue;
+        }
+        min_value = std::min (min_value, value);
+        max_value = std::max (max_value, value);
+        integers = integers && (value == std::floor (value));
+    }
+    if (min_value > max_value)
+    {
+        *base = 0.0;
+        *scale = 1.0;
+        return;
+    }
+    if ((integers) && (max_value - min_value <= 2.0 * INT24_MAX_CODE))
+    {
+        *base = std::floor ((min_value + max_value) / 2.0);
+        *scale = 1.0;
+        return;
+    }
+    *base = (min_value + max_value) / 2.0;
+    *scale = (max_value - min_value) / 2.0 / INT24_MAX_CODE;
+    if (!(*scale > 0.0) || !std::isfinite (*scale))
+    {
+        *scale = 1.0;
+    }
+}
+
+void stream_frame_encode (
+    const StreamFrameHeader &header, const double *samples, std::vector<char> &out)
+{
+    int num_rows = header.num_rows;
+    int num_samples = header.num_samples;
+    out.resize (stream_frame_size (header.encoding, num_rows, num_samples));
+    char *dst = out.data ();
+    memcpy (dst, STREAM_FRAME_MAGIC, 4);
+    put_uint (dst + 4, STREAM_FRAME_VERSION, 1);
+    put_uint (dst + 5, (uint8_t)header.encoding, 1);
+    put_uint (dst + 6, STREAM_FRAME_HEADER_SIZE, 2);
+    put_uint (dst + 8, (uint16_t)num_rows, 2);
+    put_uint (dst + 10, (uint16_t)header.preset, 2);
+    put_uint (dst + 12, header.sequence, 4);
+    put_uint (dst + 16, (uint32_t)num_samples, 4);
+    put_double (dst + 20, header.send_timestamp);
+    put_uint (dst + 28, 0, 4);
+    dst += STREAM_FRAME_HEADER_SIZE;
+
+    size_t count = (size_t)num_rows * num_samples;
+    if (header.encoding == StreamFrameEncodings::FLOAT64)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            put_double (dst + i * 8, samples[i]);
+        }
+    }
+    else if (header.encoding == StreamFrameEncodings::FLOAT32)
+    {
+        std::vector<double> bases (num_rows, 0.0);
+        for (int j = 0; j < num_rows; j++)
+        {
+            for (int i = 0; i < num_samples; i++)
+            {
+                if (std::isfinite (samples[i * num_rows + j]))
+                {
+                    bases[j] = samples[i * num_rows + j];
+                    break;
+                }
+            }
+            put_double (dst + j * 8, bases[j]);
+        }
+        dst += num_rows * 8;
+        for (size_t i = 0; i < count; i++)
+        {
+            put_float (dst + i * 4, (float)(samples[i] - bases[i % num_rows]));
+        }
+    }
+    else
+    {
+        std::vector<double> bases (num_rows);
+        std::vector<double> scales (num_rows);
+        for (int j = 0; j < num_rows; j++)
+        {
+            get_int24_params (samples, num_samples, num_rows, j, &bases[j], &scales[j]);
+            put_double (dst + j * 16, bases[j]);
+            put_double (dst + j * 16 + 8, scales[j]);
+        }
+        dst += num_rows * 16;
+        for (size_t i = 0; i < count; i++)
+        {
+            int32_t code = INT24_NAN_CODE;
+            if (std::isfinite (samples[i]))
+            {
+                size_t row = i % num_rows;
+                double scaled = std::round ((samples[i] - bases[row]) / scales[row]);
+                scaled = std::min (scaled, (double)INT24_MAX_CODE);
+                code = (int32_t)std::max (scaled, -(double)INT24_MAX_CODE);
+            }
+            put_uint (dst + i * 3, (uint32_t)code & 0xFFFFFF, 3);
+        }
+    }
+}
+
+int stream_frame_decode_header (const char *data, size_t size, StreamFrameHeader &header)
+{
+    if ((size < STREAM_FRAME_HEADER_SIZE) || (memcmp (data, STREAM_FRAME_MAGIC, 4) != 0) ||
+        (get_uint (data + 4, 1) != STREAM_FRAME_VERSION))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    uint8_t encoding = (uint8_t)get_uint (data + 5, 1);
+    size_t header_size = (size_t)get_uint (data + 6, 2);
+    if ((encoding > (uint8_t)StreamFrameEncodings::INT24) ||
+        (header_size < STREAM_FRAME_HEADER_SIZE))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    header.encoding = (StreamFrameEncodings)encoding;
+    header.num_rows = (int)get_uint (data + 8, 2);
+    header.preset = (int)get_uint (data + 10, 2);
+    header.sequence = (uint32_t)get_uint (data + 12, 4);
+    header.num_samples = (int)get_uint (data + 16, 4);
+    header.send_timestamp = get_double (data + 20);
+    // header may be longer in newer versions
+    if ((header.num_rows <= 0) || (header.num_samples <= 0) ||
+        (header.num_samples > STREAM_FRAME_MAX_SIZE) ||
+        (size != stream_frame_size (header.encoding, header.num_rows, header.num_samples) -
+                STREAM_FRAME_HEADER_SIZE + header_size))
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+int stream_frame_decode (
+    const char *data, size_t size, const StreamFrameHeader &header, double *samples)
+{
+    size_t header_size = (size_t)get_uint (data + 6, 2);
+    int num_rows = header.num_rows;
+    size_t count = (size_t)num_rows * header.num_samples;
+    if (size != stream_frame_size (header.encoding, num_rows, header.num_samples) -
+            STREAM_FRAME_HEADER_SIZE + header_size)
+    {
+        return (int)BrainFlowExitCodes::INVALID_ARGUMENTS_ERROR;
+    }
+    const char *src = data + header_size;
+    if (header.encoding == StreamFrameEncodings::FLOAT64)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            samples[i] = get_double (src + i * 8);
+        }
+    }
+    else if (header.encoding == StreamFrameEncodings::FLOAT32)
+    {
+        const char *values = src + num_rows * 8;
+        for (size_t i = 0; i < count; i++)
+        {
+            double base = get_double (src + (i % num_rows) * 8);
+            samples[i] = base + (double)get_float (values + i * 4);
+        }
+    }
+    else
+    {
+        const char *values = src + num_rows * 16;
+        for (size_t i = 0; i < count; i++)
+        {
+            int32_t code = (int32_t)get_uint (values + i * 3, 3);
+            if (code & 0x800000)
+            {
+                code -= 0x1000000; // sign extension
+            }
+            if (code == INT24_NAN_CODE)
+            {
+                samples[i] = std::numeric_limits<double>::quiet_NaN ();
+                continue;
+            }
+            size_t row = i % num_rows;
+            samples[i] = get_double (src + row * 16) + code * get_double (src + row * 16 + 8);
+        }
+    }
+    return (int)BrainFlowExitCodes::STATUS_OK;
+}
+
+bool StreamFrameSequence::check (uint32_t sequence)
+{
+    received++;
+    if (!started)
+    {
+        started = true;
+        expected = sequence + 1;
+        return true;
+    }
+    // unsigned difference handles wraparound of sequence numbers
+    uint32_t ahead = sequence - expected;
+    uint32_t behind = expected - sequence;
+    if (ahead == 0)
+    {
+        expected = sequence + 1;
+        late_in_row = 0;
+        return true;
+    }
+    bool late = (behind <= STREAM_FRAME_REORDER_WINDOW);
+    if ((late) && (late_in_row < STREAM_FRAME_MAX_LATE_IN_ROW))
+    {
+        late_in_row++;
+        out_of_order++;
+        if (lost > 0)
+        {
+            lost--;
+        }
+        return false;
+    }
+    late_in_row = 0;
+    if ((late) || (ahead > STREAM_FRAME_REORDER_WINDOW * 1024))
+    {
+        // sender was restarted, sequence starts from the beginning
+        restarts++;
+        expected = sequence + 1;
+        return true;
+    }
+    gaps++;
+    lost += ahead;
+    expected = sequence + 1;
+    return true;
+}